@@ -79,7 +79,8 @@ enum Extract
 {
     EXTRACT_MAP = 1,
     EXTRACT_DBC = 2,
-    EXTRACT_CAMERA = 4
+    EXTRACT_CAMERA = 4,
+    EXTRACT_PACK_MAPS = 8
 };
 
 // Select data for extract
@@ -134,6 +135,7 @@ void Usage(char* prg)
         "-i set input path\n"\
         "-o set output path\n"\
         "-e extract only MAP(1)/DBC(2)/Camera(4) - standard: all(7)\n"\
+        "   add 8 to pack the extracted maps into one mapped file per map (or only 8 for maps extracted before)\n"\
         "-f height stored as int (less map size but lost some accuracy) 1 by default\n"\
         "Example: %s -f 0 -i \"c:\\games\\game\"", prg, prg);
     exit(1);
@@ -145,7 +147,7 @@ void HandleArgs(int argc, char* arg[])
     {
         // i - input path
         // o - output path
-        // e - extract only MAP(1)/DBC(2) - standard both(3)
+        // e - extract only MAP(1)/DBC(2)/Camera(4) - standard all(7), pack maps(8)
         // f - use float to int conversion
         // h - limit minimum height
         if (arg[c][0] != '-')
@@ -175,7 +177,7 @@ void HandleArgs(int argc, char* arg[])
                 if (c + 1 < argc)                           // all ok
                 {
                     CONF_extract = atoi(arg[(c++) + 1]);
-                    if (!(CONF_extract > 0 && CONF_extract < 8))
+                    if (!(CONF_extract > 0 && CONF_extract < 16))
                         Usage(arg[0]);
                 }
                 else
@@ -881,6 +883,169 @@ void ExtractMapsFromMpq()
     delete [] map_ids;
 }
 
+//
+// Packed map file writer: all .map tiles of a map in one file, mapped into memory by the server
+//
+
+static uint32 AlignTo(uint32 value, uint32 alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+bool ReadTileFile(char const* filename, std::vector<char>& data)
+{
+    FILE* input = fopen(filename, "rb");
+    if (!input)
+        return false;
+
+    fseek(input, 0, SEEK_END);
+    long size = ftell(input);
+    fseek(input, 0, SEEK_SET);
+
+    data.resize(size > 0 ? size : 0);
+    bool ok = size > 0 && fread(&data[0], size, 1, input) == 1;
+    fclose(input);
+    return ok;
+}
+
+// copies a .map tile with its sections moved to aligned offsets, so the server uses their arrays in place
+bool PackTile(std::vector<char> const& tile, std::vector<char>& packed)
+{
+    GridMapFileHeader header;
+    if (tile.size() < sizeof(header))
+        return false;
+
+    memcpy(&header, &tile[0], sizeof(header));
+    if (header.mapMagic != *(uint32 const*)MAP_MAGIC || header.versionMagic != *(uint32 const*)MAP_VERSION_MAGIC)
+        return false;
+
+    uint32* sections[][2] =
+    {
+        { &header.areaMapOffset, &header.areaMapSize },
+        { &header.heightMapOffset, &header.heightMapSize },
+        { &header.liquidMapOffset, &header.liquidMapSize },
+        { &header.holesOffset, &header.holesSize },
+    };
+
+    packed.assign(AlignTo(sizeof(header), PACKED_MAP_SECTION_ALIGN), 0);
+    for (auto& section : sections)
+    {
+        uint32& offset = *section[0];
+        uint32 size = *section[1];
+        if (!offset)
+            continue;
+
+        if (offset > tile.size() || size > tile.size() - offset)
+            return false;
+
+        uint32 packedOffset = packed.size();
+        packed.insert(packed.end(), tile.begin() + offset, tile.begin() + offset + size);
+        packed.resize(AlignTo(packed.size(), PACKED_MAP_SECTION_ALIGN), 0);
+        offset = packedOffset;
+    }
+
+    memcpy(&packed[0], &header, sizeof(header));
+    return true;
+}
+
+// writes maps/<map id>.pmap from the maps/<map id><x><y>.map files, false if the map has no tiles
+bool PackMapFile(uint32 mapId)
+{
+    char filename[1024];
+    char tmpname[1024];
+    sprintf(filename, "%s/maps/%03u.pmap", output_path, mapId);
+    sprintf(tmpname, "%s.tmp", filename);
+
+    GridMapPackedHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = PACKED_MAP_MAGIC;
+    header.version = PACKED_MAP_VERSION;
+    header.tileVersionMagic = *(uint32 const*)MAP_VERSION_MAGIC;
+
+    FILE* output = nullptr;
+    uint32 fileSize = AlignTo(sizeof(header), PACKED_MAP_PAGE_SIZE);
+    uint32 dataEnd = 0;
+    std::vector<char> tile;
+    std::vector<char> packed;
+    bool ok = true;
+
+    for (uint32 x = 0; x < PACKED_MAP_GRIDS && ok; ++x)
+    {
+        for (uint32 y = 0; y < PACKED_MAP_GRIDS && ok; ++y)
+        {
+            char tilename[1024];
+            sprintf(tilename, "%s/maps/%03u%02u%02u.map", output_path, mapId, x, y);
+            if (!ReadTileFile(tilename, tile))
+                continue;
+
+            if (!PackTile(tile, packed))
+            {
+                printf("Skipped the outdated or damaged map file '%s'\n", tilename);
+                continue;
+            }
+
+            if (!output)
+            {
+                output = fopen(tmpname, "wb");
+                if (!output)
+                {
+                    printf("Can't create the output file '%s'\n", tmpname);
+                    return false;
+                }
+            }
+
+            // tiles start at a page, the end of the previous one is left zeroed
+            header.tiles[x][y].offset = fileSize;
+            header.tiles[x][y].size = packed.size();
+            ++header.tileCount;
+
+            ok = fseek(output, fileSize, SEEK_SET) == 0 && fwrite(&packed[0], packed.size(), 1, output) == 1;
+            dataEnd = fileSize + packed.size();
+            fileSize = AlignTo(dataEnd, PACKED_MAP_PAGE_SIZE);
+        }
+    }
+
+    if (!output)
+        return false;
+
+    // the file ends with the last tile
+    header.fileSize = dataEnd;
+    ok = ok && fseek(output, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, output) == 1;
+    ok = fclose(output) == 0 && ok;
+
+    // replace the file only once complete, servers mapping the old one keep it
+    if (ok)
+    {
+        remove(filename);
+        ok = rename(tmpname, filename) == 0;
+    }
+
+    if (!ok)
+    {
+        printf("Can't write the output file '%s'\n", filename);
+        remove(tmpname);
+    }
+
+    return ok;
+}
+
+void PackMapFiles()
+{
+    printf("Packing map files...\n");
+
+    uint32 map_count = ReadMapDBC();
+
+    uint32 count = 0;
+    for (uint32 z = 0; z < map_count; ++z)
+    {
+        if (PackMapFile(map_ids[z].id))
+            ++count;
+    }
+    delete [] map_ids;
+
+    printf("Packed the maps files of %u maps\n", count);
+}
+
 bool ExtractFile(char const* mpq_name, std::string const& filename)
 {
     FILE* output = fopen(filename.c_str(), "wb");
@@ -1013,6 +1178,10 @@ int main(int argc, char* arg[])
     if (CONF_extract & EXTRACT_MAP)
         ExtractMapsFromMpq();
 
+    // Pack extracted maps
+    if (CONF_extract & EXTRACT_PACK_MAPS)
+        PackMapFiles();
+
     // Close MPQs
     CloseMPQFiles();
 
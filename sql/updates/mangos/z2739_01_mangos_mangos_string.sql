@@ -0,0 +1,5 @@
+ALTER TABLE db_version CHANGE COLUMN required_z2738_01_mangos_quest_template required_z2739_01_mangos_mangos_string bit;
+
+DELETE FROM `mangos_string` WHERE `entry` IN (1704);
+INSERT INTO `mangos_string` VALUES
+(1704,'Statements written: %u',NULL,NULL,NULL,NULL,NULL,NULL,NULL,NULL);
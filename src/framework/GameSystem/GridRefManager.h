@@ -21,15 +21,84 @@
 
 #include "Utilities/LinkedReference/RefManager.h"
 
+#include <limits>
+#include <vector>
+
 template<class OBJECT> class GridReference;
+template<class OBJECT> class GridRefManager;
+
+/**
+ * Position columns of the objects packed by a GridRefManager.
+ * Positions are copies kept up to date by the objects themselves, NaN for objects without position.
+ */
+class GridPackedPositions
+{
+    public:
+        // false only if the packed position is known and not within dist (center to center)
+        bool IsPackedMaybeWithinDist3d(uint32 index, float x, float y, float z, float dist) const
+        {
+            float dx = m_packedX[index] - x;
+            float dy = m_packedY[index] - y;
+            float dz = m_packedZ[index] - z;
+            return !(dx * dx + dy * dy + dz * dz >= dist * dist);
+        }
+
+    protected:
+        friend class GridPackedSlot;
+
+        std::vector<float> m_packedX;
+        std::vector<float> m_packedY;
+        std::vector<float> m_packedZ;
+};
+
+/**
+ * Place of an object in the packed arrays of the cell it is linked to, kept by its grid reference.
+ */
+class GridPackedSlot
+{
+    public:
+        GridPackedSlot() : m_packedPositions(nullptr), m_packedIndex(0), m_ownerCoords(nullptr) {}
+
+        // x, y, z of the owner as consecutive floats, copied when the owner enters a cell
+        void SetPackedOwnerCoords(float const* coords) { m_ownerCoords = coords; }
+
+        // to be called by the owner at each position change
+        void UpdatePackedPosition(float x, float y, float z)
+        {
+            if (!m_packedPositions)
+                return;
+
+            m_packedPositions->m_packedX[m_packedIndex] = x;
+            m_packedPositions->m_packedY[m_packedIndex] = y;
+            m_packedPositions->m_packedZ[m_packedIndex] = z;
+        }
 
+    private:
+        template<class OBJECT> friend class GridRefManager;
+
+        GridPackedPositions* m_packedPositions;
+        uint32 m_packedIndex;
+        float const* m_ownerCoords;
+};
+
+/**
+ * Objects of one type in a cell.
+ *
+ * The linked list keeps the objects in insertion order and stays usable while objects
+ * enter and leave the cell during a visit. Next to it the objects and their positions are
+ * packed in arrays for read-only searches; entries are swap-removed, so their order is
+ * not stable, and they must not be walked by code that can add or remove grid objects.
+ */
 template<class OBJECT>
-class MANGOS_DLL_SPEC GridRefManager : public RefManager<GridRefManager<OBJECT>, OBJECT>
+class MANGOS_DLL_SPEC GridRefManager : public RefManager<GridRefManager<OBJECT>, OBJECT>, public GridPackedPositions
 {
     public:
 
         typedef LinkedListHead::Iterator< GridReference<OBJECT> > iterator;
 
+        // unlink references while the packed arrays are still alive
+        ~GridRefManager() { this->clearReferences(); }
+
         GridReference<OBJECT>* getFirst()
         {
             return (GridReference<OBJECT>*)RefManager<GridRefManager<OBJECT>, OBJECT>::getFirst();
@@ -44,5 +113,55 @@ class MANGOS_DLL_SPEC GridRefManager : public RefManager<GridRefManager<OBJECT>,
         iterator end() { return iterator(nullptr); }
         iterator rbegin() { return iterator(getLast()); }
         iterator rend() { return iterator(nullptr); }
+
+        uint32 GetPackedCount() const { return uint32(m_packedObjects.size()); }
+        OBJECT* GetPackedObject(uint32 index) const { return m_packedObjects[index]; }
+
+        // for GridReference link and unlink only
+        void AddPacked(GridPackedSlot* slot, OBJECT* obj)
+        {
+            float const noPosition = std::numeric_limits<float>::quiet_NaN();
+            float const* coords = slot->m_ownerCoords;
+
+            slot->m_packedPositions = this;
+            slot->m_packedIndex = uint32(m_packedObjects.size());
+
+            m_packedSlots.push_back(slot);
+            m_packedObjects.push_back(obj);
+            m_packedX.push_back(coords ? coords[0] : noPosition);
+            m_packedY.push_back(coords ? coords[1] : noPosition);
+            m_packedZ.push_back(coords ? coords[2] : noPosition);
+        }
+
+        void RemovePacked(GridPackedSlot* slot)
+        {
+            if (slot->m_packedPositions != this)
+                return;
+
+            // move the last entry into the freed place
+            uint32 index = slot->m_packedIndex;
+            uint32 last = uint32(m_packedObjects.size()) - 1;
+            if (index != last)
+            {
+                m_packedSlots[index] = m_packedSlots[last];
+                m_packedSlots[index]->m_packedIndex = index;
+                m_packedObjects[index] = m_packedObjects[last];
+                m_packedX[index] = m_packedX[last];
+                m_packedY[index] = m_packedY[last];
+                m_packedZ[index] = m_packedZ[last];
+            }
+
+            m_packedSlots.pop_back();
+            m_packedObjects.pop_back();
+            m_packedX.pop_back();
+            m_packedY.pop_back();
+            m_packedZ.pop_back();
+
+            slot->m_packedPositions = nullptr;
+        }
+
+    private:
+        std::vector<GridPackedSlot*> m_packedSlots;
+        std::vector<OBJECT*> m_packedObjects;
 };
 #endif
@@ -20,11 +20,10 @@
 #define _GRIDREFERENCE_H
 
 #include "Utilities/LinkedReference/Reference.h"
-
-template<class OBJECT> class GridRefManager;
+#include "GameSystem/GridRefManager.h"
 
 template<class OBJECT>
-class GridReference : public Reference<GridRefManager<OBJECT>, OBJECT>
+class GridReference : public Reference<GridRefManager<OBJECT>, OBJECT>, public GridPackedSlot
 {
     protected:
 
@@ -33,19 +32,24 @@ class GridReference : public Reference<GridRefManager<OBJECT>, OBJECT>
             // called from link()
             this->getTarget()->insertFirst(this);
             this->getTarget()->incSize();
+            this->getTarget()->AddPacked(this, this->getSource());
         }
 
         void targetObjectDestroyLink() override
         {
             // called from unlink()
             if (this->isValid())
+            {
                 this->getTarget()->decSize();
+                this->getTarget()->RemovePacked(this);
+            }
         }
 
         void sourceObjectDestroyLink() override
         {
             // called from invalidate()
             this->getTarget()->decSize();
+            this->getTarget()->RemovePacked(this);
         }
 
     public:
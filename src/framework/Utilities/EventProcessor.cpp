@@ -22,6 +22,8 @@ EventProcessor::EventProcessor()
 {
     m_time = 0;
     m_aborting = false;
+    m_firstEvent = nullptr;
+    m_lastEvent = nullptr;
 }
 
 EventProcessor::~EventProcessor()
@@ -35,12 +37,11 @@ void EventProcessor::Update(uint32 p_time)
     m_time += p_time;
 
     // main event loop
-    EventList::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    BasicEvent* Event;
+    while ((Event = m_firstEvent) && Event->m_execTime <= m_time)
     {
         // get and remove event from queue
-        BasicEvent* Event = i->second;
-        m_events.erase(i);
+        Unlink(Event);
 
         if (!Event->to_Abort)
         {
@@ -64,38 +65,39 @@ void EventProcessor::KillAllEvents(bool force)
     m_aborting = true;
 
     // first, abort all existing events
-    for (EventList::iterator i = m_events.begin(); i != m_events.end();)
+    for (BasicEvent* event = m_firstEvent; event;)
     {
-        EventList::iterator i_old = i;
-        ++i;
+        BasicEvent* next = event->m_nextEvent;
 
-        i_old->second->to_Abort = true;
-        i_old->second->Abort(m_time);
-        if (force || i_old->second->IsDeletable())
+        event->to_Abort = true;
+        event->Abort(m_time);
+        if (force || event->IsDeletable())
         {
-            delete i_old->second;
-
             if (!force)                                     // need per-element cleanup
-                m_events.erase(i_old);
+                Unlink(event);
+
+            delete event;
         }
+
+        event = next;
     }
 
     // fast clear event list (in force case)
     if (force)
-        m_events.clear();
+    {
+        m_firstEvent = nullptr;
+        m_lastEvent = nullptr;
+    }
 }
 
 void EventProcessor::KillEvent(BasicEvent* event)
 {
-    for (EventList::iterator iter = m_events.begin(); iter != m_events.end();)
-    {
-        if (iter->second == event)
-        {
-            delete iter->second;
-            iter = m_events.erase(iter);
-        }
-        else ++iter;
-    }
+    // events are not queued while executed
+    if (!event->m_queued)
+        return;
+
+    Unlink(event);
+    delete event;
 }
 
 void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime)
@@ -104,10 +106,53 @@ void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime
         Event->m_addTime = m_time;
 
     Event->m_execTime = e_time;
-    m_events.insert(std::pair<uint64, BasicEvent*>(e_time, Event));
+
+    // after the last event executed before or at the same time
+    BasicEvent* prev = m_lastEvent;
+    while (prev && prev->m_execTime > e_time)
+        prev = prev->m_prevEvent;
+
+    BasicEvent* next = prev ? prev->m_nextEvent : m_firstEvent;
+
+    Event->m_prevEvent = prev;
+    Event->m_nextEvent = next;
+    Event->m_queued = true;
+
+    if (prev)
+        prev->m_nextEvent = Event;
+    else
+        m_firstEvent = Event;
+
+    if (next)
+        next->m_prevEvent = Event;
+    else
+        m_lastEvent = Event;
+}
+
+void EventProcessor::Unlink(BasicEvent* event)
+{
+    if (event->m_prevEvent)
+        event->m_prevEvent->m_nextEvent = event->m_nextEvent;
+    else
+        m_firstEvent = event->m_nextEvent;
+
+    if (event->m_nextEvent)
+        event->m_nextEvent->m_prevEvent = event->m_prevEvent;
+    else
+        m_lastEvent = event->m_prevEvent;
+
+    event->m_prevEvent = nullptr;
+    event->m_nextEvent = nullptr;
+    event->m_queued = false;
 }
 
 uint64 EventProcessor::CalculateTime(uint64 t_offset) const
 {
     return m_time + t_offset;
 }
+
+void EventProcessor::GetEvents(std::vector<BasicEvent*>& events) const
+{
+    for (BasicEvent* event = m_firstEvent; event; event = event->m_nextEvent)
+        events.push_back(event);
+}
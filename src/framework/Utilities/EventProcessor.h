@@ -21,7 +21,7 @@
 
 #include "Platform/Define.h"
 
-#include <map>
+#include <vector>
 
 // Note. All times are in milliseconds here.
 
@@ -30,7 +30,8 @@ class BasicEvent
     public:
 
         BasicEvent()
-            : to_Abort(false)
+            : to_Abort(false), m_addTime(0), m_execTime(0),
+              m_prevEvent(nullptr), m_nextEvent(nullptr), m_queued(false)
         {
         }
 
@@ -53,10 +54,23 @@ class BasicEvent
         // these can be used for time offset control
         uint64 m_addTime;                                   // time when the event was added to queue, filled by event handler
         uint64 m_execTime;                                  // planned time of next execution, filled by event handler
-};
 
-typedef std::multimap<uint64, BasicEvent*> EventList;
+    private:
+        friend class EventProcessor;
+
+        // the event is the node of the event list of its processor
+        BasicEvent* m_prevEvent;
+        BasicEvent* m_nextEvent;
+        bool m_queued;
+};
 
+/**
+ * Events of an object, executed in order of execution time and of addition.
+ *
+ * The events are linked into a list through the events themselves, sorted by execution time,
+ * so adding and removing them allocates nothing. A unit has only a few events at a time, and
+ * new ones are mostly the last to execute, so the list is searched from its end when adding.
+ */
 class EventProcessor
 {
     public:
@@ -69,13 +83,18 @@ class EventProcessor
         void KillEvent(BasicEvent* Event);
         void AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime = true);
         uint64 CalculateTime(uint64 t_offset) const;
-        EventList& GetEvents() { return m_events; }
+        void GetEvents(std::vector<BasicEvent*>& events) const;
 
     protected:
 
         uint64 m_time;
-        EventList m_events;
         bool m_aborting;
+
+    private:
+        void Unlink(BasicEvent* event);
+
+        BasicEvent* m_firstEvent;
+        BasicEvent* m_lastEvent;
 };
 
 #endif
@@ -0,0 +1,131 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _LOCKFREEQUEUE_H
+#define _LOCKFREEQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace MaNGOS
+{
+    /**
+     * Bounded lock-free ring buffer (D. Vyukov's bounded queue).
+     *
+     * Any number of threads may push and pop concurrently. Each cell carries a
+     * sequence number telling whether it is free for the producer of a given
+     * position or filled for its consumer, so positions are claimed with a single
+     * CAS and no ABA problem exists. Push fails when the ring is full, the caller
+     * decides what to do with the value, which is left untouched in that case.
+     */
+    template <typename T>
+    class LockFreeQueue
+    {
+        public:
+            // capacity is rounded up to a power of two
+            explicit LockFreeQueue(size_t capacity) : m_enqueuePos(0), m_dequeuePos(0)
+            {
+                size_t size = 2;
+                while (size < capacity)
+                    size <<= 1;
+
+                m_mask = size - 1;
+                m_cells.reset(new Cell[size]);
+                for (size_t i = 0; i < size; ++i)
+                    m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+
+            LockFreeQueue(LockFreeQueue const&) = delete;
+            LockFreeQueue& operator=(LockFreeQueue const&) = delete;
+
+            bool Push(T&& value)
+            {
+                Cell* cell;
+                size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+                for (;;)
+                {
+                    cell = &m_cells[pos & m_mask];
+                    size_t seq = cell->sequence.load(std::memory_order_acquire);
+                    intptr_t diff = intptr_t(seq) - intptr_t(pos);
+                    if (diff == 0)
+                    {
+                        if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                            break;
+                    }
+                    else if (diff < 0)
+                        return false;                       // full
+                    else
+                        pos = m_enqueuePos.load(std::memory_order_relaxed);
+                }
+
+                cell->data = std::move(value);
+                cell->sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+
+            bool Pop(T& value)
+            {
+                Cell* cell;
+                size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+                for (;;)
+                {
+                    cell = &m_cells[pos & m_mask];
+                    size_t seq = cell->sequence.load(std::memory_order_acquire);
+                    intptr_t diff = intptr_t(seq) - intptr_t(pos + 1);
+                    if (diff == 0)
+                    {
+                        if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                            break;
+                    }
+                    else if (diff < 0)
+                        return false;                       // empty
+                    else
+                        pos = m_dequeuePos.load(std::memory_order_relaxed);
+                }
+
+                value = std::move(cell->data);
+                cell->data = T();
+                cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+                return true;
+            }
+
+            // only a hint while other threads push or pop
+            bool Empty() const
+            {
+                return m_enqueuePos.load(std::memory_order_acquire) == m_dequeuePos.load(std::memory_order_acquire);
+            }
+
+        private:
+            struct Cell
+            {
+                std::atomic<size_t> sequence;
+                T data;
+            };
+
+            std::unique_ptr<Cell[]> m_cells;
+            size_t m_mask;
+
+            // keep producer and consumer positions on separate cache lines
+            alignas(64) std::atomic<size_t> m_enqueuePos;
+            alignas(64) std::atomic<size_t> m_dequeuePos;
+    };
+}
+
+#endif
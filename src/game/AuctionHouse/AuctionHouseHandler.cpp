@@ -435,6 +435,9 @@ void WorldSession::HandleAuctionRemoveItem(WorldPacket& recv_data)
         return;
     }
 
+    // auction rows are written on the connection of the owner, see AuctionHouseObject::AddAuction
+    SqlAsyncRoute dbRoute(CharacterDatabase, pl->GetGUIDLow());
+
     if (auction->bid)                                       // If we have a bid, we have to send him the money he paid
     {
         uint32 auctionCut = auction->GetAuctionCut();
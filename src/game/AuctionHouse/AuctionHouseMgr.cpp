@@ -438,6 +438,12 @@ bool AuctionHouseMgr::RemoveAItem(uint32 id)
     return true;
 }
 
+void AuctionHouseMgr::ClearSearchNames()
+{
+    for (auto& auctionHouse : mAuctions)
+        auctionHouse.ClearSearchNames();
+}
+
 void AuctionHouseMgr::Update()
 {
     for (auto& mAuction : mAuctions)
@@ -532,6 +538,8 @@ void AuctionHouseObject::Update()
             continue;
         }
 
+        SqlAsyncRoute dbRoute(CharacterDatabase, itr->second->owner);
+
         ///- perform the transaction if there was bidder.  this will alyways have the side effect of
         ///- removing the auction from the collection.  therefore we must increment the iterator here.
         if (itr->second->bid)
@@ -543,6 +551,7 @@ void AuctionHouseObject::Update()
 
             itr->second->DeleteFromDB();
             sAuctionMgr.RemoveAItem(itr->second->itemGuidLow);
+            m_searchIndex.Remove(itr->second);
             delete itr->second;
             AuctionsMap.erase(itr++);
         }
@@ -584,57 +593,59 @@ void AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player
 {
     int loc_idx = player->GetSession()->GetSessionDbLocaleIndex();
 
-    for (auto& AentryItr : AuctionsMap)
+    AuctionSearchFilter filter;
+    filter.name = wsearchedname;
+    filter.levelMin = levelmin;
+    filter.levelMax = levelmax;
+    filter.inventoryType = inventoryType;
+    filter.itemClass = itemClass;
+    filter.itemSubClass = itemSubClass;
+    filter.quality = quality;
+
+    // without the usable filter the index knows the matching auctions, only the listed page is collected
+    if (usable == 0x00)
     {
-        auto Aentry = AentryItr.second;
-        Item* item = sAuctionMgr.GetAItem(Aentry->itemGuidLow);
-        if (!item)
-            continue;
+        std::vector<AuctionEntry*> page;
+        totalcount = m_searchIndex.SearchPage(filter, loc_idx, listfrom, 50, page);
 
+        for (AuctionEntry* Aentry : page)
         {
-            ItemPrototype const* proto = item->GetProto();
-
-            if (itemClass != 0xffffffff && proto->Class != itemClass)
+            if (!sAuctionMgr.GetAItem(Aentry->itemGuidLow))
                 continue;
 
-            if (itemSubClass != 0xffffffff && proto->SubClass != itemSubClass)
-                continue;
+            ++count;
+            Aentry->BuildAuctionInfo(data);
+        }
+        return;
+    }
 
-            if (inventoryType != 0xffffffff && proto->InventoryType != inventoryType)
-                continue;
+    // only auctions of items matching all filters besides usable
+    std::vector<AuctionEntry*> auctions;
+    m_searchIndex.Search(filter, loc_idx, auctions);
 
-            if (quality != 0xffffffff && proto->Quality < quality)
-                continue;
+    for (AuctionEntry* Aentry : auctions)
+    {
+        Item* item = sAuctionMgr.GetAItem(Aentry->itemGuidLow);
+        if (!item)
+            continue;
 
-            if (levelmin != 0x00 && (proto->RequiredLevel < levelmin || (levelmax != 0x00 && proto->RequiredLevel > levelmax)))
-                continue;
+        if (player->CanUseItem(item) != EQUIP_ERR_OK)
+            continue;
 
-            if (usable != 0x00)
+        ItemPrototype const* proto = item->GetProto();
+        if (proto->Class == ITEM_CLASS_RECIPE)
+        {
+            if (SpellEntry const* spell = sSpellTemplate.LookupEntry<SpellEntry>(proto->Spells[0].SpellId))
             {
-                if (player->CanUseItem(item) != EQUIP_ERR_OK)
+                if (player->HasSpell(spell->EffectTriggerSpell[EFFECT_INDEX_0]))
                     continue;
-
-                if (proto->Class == ITEM_CLASS_RECIPE)
-                {
-                    if (SpellEntry const* spell = sSpellTemplate.LookupEntry<SpellEntry>(proto->Spells[0].SpellId))
-                    {
-                        if (player->HasSpell(spell->EffectTriggerSpell[EFFECT_INDEX_0]))
-                            continue;
-                    }
-                }
             }
+        }
 
-            std::string name = proto->Name1;
-            sObjectMgr.GetItemLocaleStrings(proto->ItemId, loc_idx, &name);
-
-            if (!wsearchedname.empty() && !Utf8FitTo(name, wsearchedname))
-                continue;
-
-            if (count < 50 && totalcount >= listfrom)
-            {
-                ++count;
-                Aentry->BuildAuctionInfo(data);
-            }
+        if (count < 50 && totalcount >= listfrom)
+        {
+            ++count;
+            Aentry->BuildAuctionInfo(data);
         }
 
         ++totalcount;
@@ -667,6 +678,10 @@ AuctionEntry* AuctionHouseObject::AddAuction(AuctionHouseEntry const* auctionHou
     if (pl)
         pl->MoveItemFromInventory(newItem->GetBagSlot(), newItem->GetSlot(), true);
 
+    // all rows of an auction are written on the connection of its owner, so they stay ordered with each other
+    // and with the saves of the owner the item is moved from
+    SqlAsyncRoute dbRoute(CharacterDatabase, AH->owner);
+
     CharacterDatabase.BeginTransaction();
 
     if (pl)
@@ -766,6 +781,9 @@ bool AuctionEntry::UpdateBid(uint32 newbid, Player* newbidder /*=nullptr*/)
 {
     Player* auction_owner = owner ? sObjectMgr.GetPlayer(ObjectGuid(HIGHGUID_PLAYER, owner)) : nullptr;
 
+    // the auction row is written on the connection of the owner, the money of the bidder in order with its saves
+    SqlAsyncRoute dbRoute(CharacterDatabase, owner, newbidder ? newbidder->GetGUIDLow() : owner);
+
     // bid can't be greater buyout
     if (buyout && newbid > buyout)
         newbid = buyout;
@@ -21,6 +21,7 @@
 
 #include "Common.h"
 #include "Server/DBCStructure.h"
+#include "AuctionHouse/AuctionSearchIndex.h"
 
 class Item;
 class Player;
@@ -100,6 +101,7 @@ class AuctionHouseObject
         {
             MANGOS_ASSERT(ah);
             AuctionsMap[ah->Id] = ah;
+            m_searchIndex.Add(ah);
         }
 
         AuctionEntry* GetAuction(uint32 id) const
@@ -108,7 +110,19 @@ class AuctionHouseObject
             return itr != AuctionsMap.end() ? itr->second : nullptr;
         }
 
-        bool RemoveAuction(uint32 id) { return !!AuctionsMap.erase(id); }
+        bool RemoveAuction(uint32 id)
+        {
+            AuctionEntryMap::iterator itr = AuctionsMap.find(id);
+            if (itr == AuctionsMap.end())
+                return false;
+
+            m_searchIndex.Remove(itr->second);
+            AuctionsMap.erase(itr);
+            return true;
+        }
+
+        // to be called after item locales were reloaded
+        void ClearSearchNames() { m_searchIndex.ClearNames(); }
 
         void Update();
 
@@ -121,6 +135,7 @@ class AuctionHouseObject
         AuctionEntry* AddAuction(AuctionHouseEntry const* auctionHouseEntry, Item* newItem, uint32 etime, uint32 bid, uint32 buyout = 0, uint32 deposit = 0, Player* pl = nullptr);
     private:
         AuctionEntryMap AuctionsMap;
+        AuctionSearchIndex m_searchIndex;                   // AuctionsMap by searched item fields
 };
 
 enum AuctionHouseType
@@ -170,6 +185,9 @@ class AuctionHouseMgr
         void AddAItem(Item* it);
         bool RemoveAItem(uint32 id);
 
+        // item names used by auction searches are rebuilt after item locales were reloaded
+        void ClearSearchNames();
+
         void Update();
 
     private:
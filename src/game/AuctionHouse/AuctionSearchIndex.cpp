@@ -0,0 +1,292 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "AuctionHouse/AuctionSearchIndex.h"
+#include "AuctionHouse/AuctionHouseMgr.h"
+#include "Globals/ObjectMgr.h"
+#include "Server/SQLStorages.h"
+#include "Util.h"
+
+#include <algorithm>
+
+#define BUCKET_CLASS_SHIFT          48
+#define BUCKET_SUBCLASS_SHIFT       40
+#define BUCKET_INVENTORY_TYPE_SHIFT 32
+#define BUCKET_QUALITY_SHIFT        24
+
+// 3 characters of a name, 21 bits are enough for any unicode character
+static uint64 GetTrigram(std::wstring const& name, size_t pos)
+{
+    return (uint64(name[pos] & 0x1FFFFF) << 42) | (uint64(name[pos + 1] & 0x1FFFFF) << 21) | uint64(name[pos + 2] & 0x1FFFFF);
+}
+
+uint64 AuctionSearchIndex::GetBucketKey(ItemPrototype const* proto)
+{
+    return (uint64(proto->Class & 0xFF) << BUCKET_CLASS_SHIFT) | (uint64(proto->SubClass & 0xFF) << BUCKET_SUBCLASS_SHIFT) |
+           (uint64(proto->InventoryType & 0xFF) << BUCKET_INVENTORY_TYPE_SHIFT) | (uint64(proto->Quality & 0xFF) << BUCKET_QUALITY_SHIFT) |
+           uint64(proto->RequiredLevel & 0xFFFFFF);
+}
+
+bool AuctionSearchIndex::MatchesFilter(uint64 bucketKey, AuctionSearchFilter const& filter)
+{
+    uint32 itemClass = uint32(bucketKey >> BUCKET_CLASS_SHIFT) & 0xFF;
+    uint32 itemSubClass = uint32(bucketKey >> BUCKET_SUBCLASS_SHIFT) & 0xFF;
+    uint32 inventoryType = uint32(bucketKey >> BUCKET_INVENTORY_TYPE_SHIFT) & 0xFF;
+    uint32 quality = uint32(bucketKey >> BUCKET_QUALITY_SHIFT) & 0xFF;
+    uint32 requiredLevel = uint32(bucketKey) & 0xFFFFFF;
+
+    if (filter.itemClass != 0xffffffff && itemClass != filter.itemClass)
+        return false;
+
+    if (filter.itemSubClass != 0xffffffff && itemSubClass != filter.itemSubClass)
+        return false;
+
+    if (filter.inventoryType != 0xffffffff && inventoryType != filter.inventoryType)
+        return false;
+
+    if (filter.quality != 0xffffffff && quality < filter.quality)
+        return false;
+
+    if (filter.levelMin != 0x00 && (requiredLevel < filter.levelMin || (filter.levelMax != 0x00 && requiredLevel > filter.levelMax)))
+        return false;
+
+    return true;
+}
+
+void AuctionSearchIndex::Add(AuctionEntry* auction)
+{
+    auto itr = m_items.find(auction->itemTemplate);
+    if (itr == m_items.end())
+    {
+        ItemPrototype const* proto = ObjectMgr::GetItemPrototype(auction->itemTemplate);
+        if (!proto)
+            return;
+
+        itr = m_items.insert(std::make_pair(auction->itemTemplate, ItemAuctions())).first;
+        itr->second.proto = proto;
+
+        m_buckets[GetBucketKey(proto)].insert(auction->itemTemplate);
+        for (auto& names : m_localeNames)
+            AddName(names.second, names.first, proto);
+    }
+
+    itr->second.auctions[auction->Id] = auction;
+}
+
+void AuctionSearchIndex::Remove(AuctionEntry* auction)
+{
+    auto itr = m_items.find(auction->itemTemplate);
+    if (itr == m_items.end())
+        return;
+
+    itr->second.auctions.erase(auction->Id);
+    if (!itr->second.auctions.empty())
+        return;
+
+    auto bucket = m_buckets.find(GetBucketKey(itr->second.proto));
+    bucket->second.erase(auction->itemTemplate);
+    if (bucket->second.empty())
+        m_buckets.erase(bucket);
+
+    for (auto& names : m_localeNames)
+        RemoveName(names.second, auction->itemTemplate);
+
+    m_items.erase(itr);
+}
+
+void AuctionSearchIndex::AddName(LocaleNames& names, int localeIndex, ItemPrototype const* proto)
+{
+    std::string name = proto->Name1;
+    sObjectMgr.GetItemLocaleStrings(proto->ItemId, localeIndex, &name);
+
+    std::wstring wname;
+    if (!Utf8toWStr(name, wname))
+        return;
+
+    wstrToLower(wname);
+
+    for (size_t pos = 0; pos + 3 <= wname.size(); ++pos)
+        names.templatesByTrigram[GetTrigram(wname, pos)].insert(proto->ItemId);
+
+    names.names[proto->ItemId] = wname;
+}
+
+void AuctionSearchIndex::RemoveName(LocaleNames& names, uint32 itemTemplate)
+{
+    auto itr = names.names.find(itemTemplate);
+    if (itr == names.names.end())
+        return;
+
+    std::wstring const& wname = itr->second;
+    for (size_t pos = 0; pos + 3 <= wname.size(); ++pos)
+    {
+        auto trigram = names.templatesByTrigram.find(GetTrigram(wname, pos));
+        if (trigram == names.templatesByTrigram.end())
+            continue;
+
+        trigram->second.erase(itemTemplate);
+        if (trigram->second.empty())
+            names.templatesByTrigram.erase(trigram);
+    }
+
+    names.names.erase(itr);
+}
+
+AuctionSearchIndex::LocaleNames& AuctionSearchIndex::GetLocaleNames(int localeIndex)
+{
+    auto itr = m_localeNames.find(localeIndex);
+    if (itr != m_localeNames.end())
+        return itr->second;
+
+    LocaleNames& names = m_localeNames[localeIndex];
+    for (auto const& item : m_items)
+        AddName(names, localeIndex, item.second.proto);
+
+    return names;
+}
+
+void AuctionSearchIndex::FindTemplates(AuctionSearchFilter const& filter, int localeIndex, std::vector<AuctionsById const*>& lists)
+{
+
+    if (!filter.name.empty())
+    {
+        LocaleNames& names = GetLocaleNames(localeIndex);
+
+        // templates having all pieces of the name, starting with the rarest piece
+        std::set<uint32> const* candidates = nullptr;
+        for (size_t pos = 0; pos + 3 <= filter.name.size(); ++pos)
+        {
+            auto trigram = names.templatesByTrigram.find(GetTrigram(filter.name, pos));
+            if (trigram == names.templatesByTrigram.end())
+                return;
+
+            if (!candidates || trigram->second.size() < candidates->size())
+                candidates = &trigram->second;
+        }
+
+        if (candidates)
+        {
+            for (uint32 itemTemplate : *candidates)
+            {
+                auto item = m_items.find(itemTemplate);
+                auto name = names.names.find(itemTemplate);
+                if (item == m_items.end() || name == names.names.end())
+                    continue;
+
+                if (MatchesFilter(GetBucketKey(item->second.proto), filter) && name->second.find(filter.name) != std::wstring::npos)
+                    lists.push_back(&item->second.auctions);
+            }
+        }
+        else                                                // names shorter than a piece
+        {
+            for (auto const& item : m_items)
+            {
+                auto name = names.names.find(item.first);
+                if (name == names.names.end())
+                    continue;
+
+                if (MatchesFilter(GetBucketKey(item.second.proto), filter) && name->second.find(filter.name) != std::wstring::npos)
+                    lists.push_back(&item.second.auctions);
+            }
+        }
+    }
+    else
+    {
+        // buckets are ordered by class and subclass first
+        auto begin = m_buckets.begin();
+        auto end = m_buckets.end();
+        if (filter.itemClass != 0xffffffff)
+        {
+            uint64 first = uint64(filter.itemClass & 0xFF) << BUCKET_CLASS_SHIFT;
+            uint64 last = first + (uint64(1) << BUCKET_CLASS_SHIFT);
+            if (filter.itemSubClass != 0xffffffff)
+            {
+                first |= uint64(filter.itemSubClass & 0xFF) << BUCKET_SUBCLASS_SHIFT;
+                last = first + (uint64(1) << BUCKET_SUBCLASS_SHIFT);
+            }
+
+            begin = m_buckets.lower_bound(first);
+            end = m_buckets.lower_bound(last);
+        }
+
+        for (auto itr = begin; itr != end; ++itr)
+        {
+            if (!MatchesFilter(itr->first, filter))
+                continue;
+
+            for (uint32 itemTemplate : itr->second)
+            {
+                auto item = m_items.find(itemTemplate);
+                if (item != m_items.end())
+                    lists.push_back(&item->second.auctions);
+            }
+        }
+    }
+}
+
+void AuctionSearchIndex::Merge(std::vector<AuctionsById const*> const& lists, uint32 offset, uint32 count, std::vector<AuctionEntry*>& result)
+{
+    typedef std::pair<AuctionsById::const_iterator, AuctionsById::const_iterator> Range;
+
+    // heap of the next auction of every list, lowest id on top
+    auto laterRange = [](Range const& a, Range const& b) { return a.first->first > b.first->first; };
+    std::vector<Range> heap;
+    heap.reserve(lists.size());
+    for (AuctionsById const* auctions : lists)
+        if (!auctions->empty())
+            heap.push_back(Range(auctions->begin(), auctions->end()));
+    std::make_heap(heap.begin(), heap.end(), laterRange);
+
+    uint32 position = 0;
+    uint32 taken = 0;
+    while (!heap.empty() && taken < count)
+    {
+        std::pop_heap(heap.begin(), heap.end(), laterRange);
+        Range& next = heap.back();
+        if (position++ >= offset)
+        {
+            result.push_back(next.first->second);
+            ++taken;
+        }
+
+        if (++next.first == next.second)
+            heap.pop_back();
+        else
+            std::push_heap(heap.begin(), heap.end(), laterRange);
+    }
+}
+
+void AuctionSearchIndex::Search(AuctionSearchFilter const& filter, int localeIndex, std::vector<AuctionEntry*>& result)
+{
+    std::vector<AuctionsById const*> lists;
+    FindTemplates(filter, localeIndex, lists);
+    Merge(lists, 0, 0xFFFFFFFF, result);
+}
+
+uint32 AuctionSearchIndex::SearchPage(AuctionSearchFilter const& filter, int localeIndex, uint32 offset, uint32 count, std::vector<AuctionEntry*>& result)
+{
+    std::vector<AuctionsById const*> lists;
+    FindTemplates(filter, localeIndex, lists);
+
+    uint32 total = 0;
+    for (AuctionsById const* auctions : lists)
+        total += uint32(auctions->size());
+
+    Merge(lists, offset, count, result);
+    return total;
+}
@@ -0,0 +1,99 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _AUCTION_SEARCH_INDEX_H
+#define _AUCTION_SEARCH_INDEX_H
+
+#include "Common.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct AuctionEntry;
+struct ItemPrototype;
+
+// filters of CMSG_AUCTION_LIST_ITEMS, 0xFFFFFFFF (0 for levels) when not used
+struct AuctionSearchFilter
+{
+    std::wstring name;                                      // lowercased
+    uint32 levelMin;
+    uint32 levelMax;
+    uint32 inventoryType;
+    uint32 itemClass;
+    uint32 itemSubClass;
+    uint32 quality;                                         // minimal quality
+};
+
+/**
+ * Auctions of an auction house grouped by item template, for searches not scanning all auctions.
+ *
+ * Templates are bucketed by class, subclass, inventory type, quality and required level, the
+ * fields searched for besides the name. Lowercased names and the 3 character pieces of them
+ * are kept per client locale, built at the first search in a locale, so a name search only
+ * checks the templates having the rarest piece of the searched name.
+ */
+class AuctionSearchIndex
+{
+    public:
+        void Add(AuctionEntry* auction);
+        void Remove(AuctionEntry* auction);
+
+        // the names are rebuilt at the next search, for reloaded item locales
+        void ClearNames() { m_localeNames.clear(); }
+
+        // auctions of item templates matching the filter, ordered by auction id
+        void Search(AuctionSearchFilter const& filter, int localeIndex, std::vector<AuctionEntry*>& result);
+        // only the count auctions from position offset of that order, returns the number of all matching auctions
+        uint32 SearchPage(AuctionSearchFilter const& filter, int localeIndex, uint32 offset, uint32 count, std::vector<AuctionEntry*>& result);
+
+    private:
+        typedef std::map<uint32, AuctionEntry*> AuctionsById;
+
+        // auction lists of the item templates matching the filter
+        void FindTemplates(AuctionSearchFilter const& filter, int localeIndex, std::vector<AuctionsById const*>& lists);
+        // merges the lists by auction id, skipping the first offset auctions and stopping after count
+        static void Merge(std::vector<AuctionsById const*> const& lists, uint32 offset, uint32 count, std::vector<AuctionEntry*>& result);
+
+        struct ItemAuctions
+        {
+            ItemPrototype const* proto;
+            AuctionsById auctions;
+        };
+
+        struct LocaleNames
+        {
+            std::unordered_map<uint32, std::wstring> names; // by item template
+            std::unordered_map<uint64, std::set<uint32>> templatesByTrigram;
+        };
+
+        static uint64 GetBucketKey(ItemPrototype const* proto);
+        static bool MatchesFilter(uint64 bucketKey, AuctionSearchFilter const& filter);
+
+        LocaleNames& GetLocaleNames(int localeIndex);
+        static void AddName(LocaleNames& names, int localeIndex, ItemPrototype const* proto);
+        static void RemoveName(LocaleNames& names, uint32 itemTemplate);
+
+        std::unordered_map<uint32, ItemAuctions> m_items;   // by item template
+        std::map<uint64, std::set<uint32>> m_buckets;       // item templates by GetBucketKey()
+        std::map<int, LocaleNames> m_localeNames;
+};
+
+#endif
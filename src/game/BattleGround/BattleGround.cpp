@@ -438,13 +438,14 @@ void BattleGround::SetTeamStartLoc(Team team, float X, float Y, float Z, float O
 
 void BattleGround::SendPacketToAll(WorldPacket const& packet) const
 {
+    SharedPacketContents contents;
     for (BattleGroundPlayerMap::const_iterator itr = m_Players.begin(); itr != m_Players.end(); ++itr)
     {
         if (itr->second.OfflineRemoveTime)
             continue;
 
         if (Player* plr = sObjectMgr.GetPlayer(itr->first))
-            plr->GetSession()->SendPacket(packet);
+            plr->GetSession()->SendPacket(packet, contents);
         else
             sLog.outError("BattleGround:SendPacketToAll: %s not found!", itr->first.GetString().c_str());
     }
@@ -452,6 +453,7 @@ void BattleGround::SendPacketToAll(WorldPacket const& packet) const
 
 void BattleGround::SendPacketToTeam(Team teamId, WorldPacket const& packet, Player* sender, bool self) const
 {
+    SharedPacketContents contents;
     for (BattleGroundPlayerMap::const_iterator itr = m_Players.begin(); itr != m_Players.end(); ++itr)
     {
         if (itr->second.OfflineRemoveTime)
@@ -471,7 +473,7 @@ void BattleGround::SendPacketToTeam(Team teamId, WorldPacket const& packet, Play
         if (team != ALLIANCE && team != HORDE) team = plr->GetTeam();
 
         if (team == teamId)
-            plr->GetSession()->SendPacket(packet);
+            plr->GetSession()->SendPacket(packet, contents);
     }
 }
 
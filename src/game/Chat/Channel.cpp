@@ -674,10 +674,11 @@ void Channel::SetOwner(ObjectGuid guid, bool exclaim)
 
 void Channel::SendToAll(WorldPacket const& data, ObjectGuid guid) const
 {
+    SharedPacketContents contents;
     for (PlayerList::const_iterator i = m_players.begin(); i != m_players.end(); ++i)
         if (Player* plr = sObjectMgr.GetPlayer(i->first))
             if (!guid || !plr->GetSocial()->HasIgnore(guid))
-                plr->GetSession()->SendPacket(data);
+                plr->GetSession()->SendPacket(data, contents);
 }
 
 void Channel::SendToOne(WorldPacket const& data, ObjectGuid who) const
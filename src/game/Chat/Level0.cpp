@@ -189,6 +189,7 @@ bool ChatHandler::HandleSaveCommand(char* /*args*/)
     {
         player->SaveToDB();
         SendSysMessage(LANG_PLAYER_SAVED);
+        PSendSysMessage(LANG_PLAYER_SAVED_STATEMENTS, player->GetLastSaveStatementCount());
         return true;
     }
 
@@ -37,6 +37,7 @@
 #include "Spells/SpellMgr.h"
 #ifdef _DEBUG_VMAPS
 #include "VMapFactory.h"
+#include "Maps/TerrainQueryCache.h"
 #endif
 
 //-----------------------Npc Commands-----------------------
@@ -360,6 +361,10 @@ bool ChatHandler::HandleGPSCommand(char* args)
         PSendSysMessage("Vmap Terrain Height %f", vmgr->getHeight(obj->GetMapId(), obj->GetPositionX(), obj->GetPositionY(), obj->GetPositionZ() + 2.0f, 10000.0f));
 
     PSendSysMessage("Static map height (maps and vmaps): %f", obj->GetTerrain()->GetHeightStatic(obj->GetPositionX(), obj->GetPositionY(), obj->GetPositionZ()));
+
+    uint64 hits, misses;
+    obj->GetMap()->GetTerrainQueries().GetStats(hits, misses);
+    PSendSysMessage("Line of sight and height queries: " UI64FMTD " cached, " UI64FMTD " calculated", hits, misses);
 #endif
 
     return true;
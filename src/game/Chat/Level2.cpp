@@ -4690,7 +4690,7 @@ bool ChatHandler::HandleWaterwalkCommand(char* args)
 
 bool ChatHandler::HandleMmapPathCommand(char* args)
 {
-    if (!MMAP::MMapFactory::createOrGetMMapManager()->GetNavMesh(m_session->GetPlayer()->GetMapId()))
+    if (!MMAP::NavMeshQueryLease(m_session->GetPlayer()->GetMapId()).GetNavMesh())
     {
         PSendSysMessage("NavMesh not loaded for current map.");
         return true;
@@ -4799,8 +4799,9 @@ bool ChatHandler::HandleMmapLocCommand(char* /*args*/)
     PSendSysMessage("gridloc [%i,%i]", gy, gx);
 
     // calculate navmesh tile location
-    const dtNavMesh* navmesh = MMAP::MMapFactory::createOrGetMMapManager()->GetNavMesh(player->GetMapId());
-    const dtNavMeshQuery* navmeshquery = MMAP::MMapFactory::createOrGetMMapManager()->GetNavMeshQuery(player->GetMapId(), player->GetInstanceId());
+    MMAP::NavMeshQueryLease lease(player->GetMapId());
+    const dtNavMesh* navmesh = lease.GetNavMesh();
+    const dtNavMeshQuery* navmeshquery = lease.GetNavMeshQuery();
     if (!navmesh || !navmeshquery)
     {
         PSendSysMessage("NavMesh not loaded for current map.");
@@ -4844,8 +4845,9 @@ bool ChatHandler::HandleMmapLoadedTilesCommand(char* /*args*/)
 {
     uint32 mapid = m_session->GetPlayer()->GetMapId();
 
-    const dtNavMesh* navmesh = MMAP::MMapFactory::createOrGetMMapManager()->GetNavMesh(mapid);
-    const dtNavMeshQuery* navmeshquery = MMAP::MMapFactory::createOrGetMMapManager()->GetNavMeshQuery(mapid, m_session->GetPlayer()->GetInstanceId());
+    MMAP::NavMeshQueryLease lease(mapid);
+    const dtNavMesh* navmesh = lease.GetNavMesh();
+    const dtNavMeshQuery* navmeshquery = lease.GetNavMeshQuery();
     if (!navmesh || !navmeshquery)
     {
         PSendSysMessage("NavMesh not loaded for current map.");
@@ -4874,7 +4876,8 @@ bool ChatHandler::HandleMmapStatsCommand(char* /*args*/)
     MMAP::MMapManager* manager = MMAP::MMapFactory::createOrGetMMapManager();
     PSendSysMessage(" %u maps loaded with %u tiles overall", manager->getLoadedMapsCount(), manager->getLoadedTilesCount());
 
-    const dtNavMesh* navmesh = manager->GetNavMesh(m_session->GetPlayer()->GetMapId());
+    MMAP::NavMeshQueryLease lease(m_session->GetPlayer()->GetMapId());
+    const dtNavMesh* navmesh = lease.GetNavMesh();
     if (!navmesh)
     {
         PSendSysMessage("NavMesh not loaded for current map.");
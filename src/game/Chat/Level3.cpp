@@ -1054,6 +1054,7 @@ bool ChatHandler::HandleReloadLocalesItemCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales Item ... ");
     sObjectMgr.LoadItemLocales();
+    sAuctionMgr.ClearSearchNames();
     SendGlobalSysMessage("DB table `locales_item` reloaded.");
     return true;
 }
@@ -26,6 +26,8 @@
 #include "Entities/UnitEvents.h"
 #include "Spells/SpellAuras.h"
 
+#include <algorithm>
+
 //==============================================================
 //================= ThreatCalcHelper ===========================
 //==============================================================
@@ -80,6 +82,8 @@ HostileReference::HostileReference(Unit* unit, ThreatManager* threatManager, flo
     iUnitGuid = unit->GetObjectGuid();
     m_online = true;
     iAccessible = true;
+    iContainerIndex = 0;
+    iContainerOrder = 0;
 }
 
 //============================================================
@@ -227,12 +231,62 @@ Unit* HostileReference::getSourceUnit() const
 
 void ThreatContainer::clearReferences()
 {
-    for (ThreatList::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
+    for (ThreatList::const_iterator i = iHeap.begin(); i != iHeap.end(); ++i)
     {
         (*i)->unlink();
         delete (*i);
     }
+    iHeap.clear();
     iThreatList.clear();
+    iListSorted = true;
+}
+
+//============================================================
+
+void ThreatContainer::addReference(HostileReference* hostileReference)
+{
+    hostileReference->iContainerOrder = iNextOrder++;
+    iHeap.push_back(hostileReference);
+    place(hostileReference, iHeap.size() - 1);
+    siftUp(hostileReference->iContainerIndex);
+
+    iThreatList.push_back(hostileReference);
+    iListSorted = false;
+}
+
+//============================================================
+
+void ThreatContainer::remove(HostileReference* ref)
+{
+    if (!contains(ref))
+        return;
+
+    uint32 index = ref->iContainerIndex;
+    HostileReference* last = iHeap.back();
+    iHeap.pop_back();
+    if (last != ref)
+    {
+        place(last, index);
+        siftUp(index);
+        siftDown(last->iContainerIndex);
+    }
+
+    iThreatList.erase(std::find(iThreatList.begin(), iThreatList.end(), ref));
+}
+
+//============================================================
+
+void ThreatContainer::updateReference(HostileReference* ref)
+{
+    if (!contains(ref))
+        return;
+
+    uint32 index = ref->iContainerIndex;
+    siftUp(index);
+    if (ref->iContainerIndex == index)
+        siftDown(index);
+
+    iListSorted = false;
 }
 
 //============================================================
@@ -244,7 +298,7 @@ HostileReference* ThreatContainer::getReferenceByTarget(Unit* victim)
 
     ObjectGuid guid = victim->GetObjectGuid();
 
-    for (ThreatList::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
+    for (ThreatList::const_iterator i = iHeap.begin(); i != iHeap.end(); ++i)
         if ((*i)->getUnitGuid() == guid)
             return (*i);
 
@@ -280,44 +334,108 @@ void ThreatContainer::modifyThreatPercent(Unit* victim, int32 threatPercent)
 
 //============================================================
 
-bool HostileReferenceSortPredicate(const HostileReference* lhs, const HostileReference* rhs)
+bool ThreatContainer::isMoreHated(HostileReference const* lhs, HostileReference const* rhs)
 {
     if (lhs->GetTauntState() != rhs->GetTauntState())
         return lhs->GetTauntState() > rhs->GetTauntState();
     if (lhs->GetHostileState() != rhs->GetHostileState())
         return lhs->GetHostileState() > rhs->GetHostileState();
-    return lhs->getThreat() > rhs->getThreat();             // reverse sorting
+    if (lhs->getThreat() != rhs->getThreat())
+        return lhs->getThreat() > rhs->getThreat();
+    return lhs->iContainerOrder < rhs->iContainerOrder;
+}
+
+void ThreatContainer::siftUp(uint32 index)
+{
+    HostileReference* ref = iHeap[index];
+    while (index > 0)
+    {
+        uint32 parent = (index - 1) / 2;
+        if (!isMoreHated(ref, iHeap[parent]))
+            break;
+
+        place(iHeap[parent], index);
+        index = parent;
+    }
+    place(ref, index);
+}
+
+void ThreatContainer::siftDown(uint32 index)
+{
+    HostileReference* ref = iHeap[index];
+    uint32 size = iHeap.size();
+    while (true)
+    {
+        uint32 child = 2 * index + 1;
+        if (child >= size)
+            break;
+
+        if (child + 1 < size && isMoreHated(iHeap[child + 1], iHeap[child]))
+            ++child;
+
+        if (!isMoreHated(iHeap[child], ref))
+            break;
+
+        place(iHeap[child], index);
+        index = child;
+    }
+    place(ref, index);
 }
 
 //============================================================
-// Check if the list is dirty and sort if necessary
+// Rebuild the heap after taunt or hostile states changed
 
 void ThreatContainer::update()
 {
-    if (iDirty && iThreatList.size() > 1)
+    if (iDirty && iHeap.size() > 1)
     {
-        iThreatList.sort(HostileReferenceSortPredicate);
+        for (uint32 index = iHeap.size() / 2; index > 0; --index)
+            siftDown(index - 1);
     }
     iDirty = false;
 }
 
+//============================================================
+
+ThreatList const& ThreatContainer::getThreatList() const
+{
+    if (!iListSorted)
+    {
+        std::sort(iThreatList.begin(), iThreatList.end(), isMoreHated);
+        iListSorted = true;
+    }
+    return iThreatList;
+}
+
 //============================================================
 // return the next best victim
 // could be the current victim
 
 HostileReference* ThreatContainer::selectNextVictim(Unit* attacker, HostileReference* currentVictim)
 {
-    HostileReference* pCurrentRef = nullptr;
-    bool found = false;
-    bool onlySecondChoiceTargetsFound = false;
-    bool checkedCurrentVictim = false;
+    if (iHeap.empty())
+        return nullptr;
 
-    ThreatList::const_iterator lastRef = iThreatList.end();
-    --lastRef;
+    // the references are checked in threat order, by taking the most hated of the
+    // heap positions below the ones checked already, so mostly only the top is checked
+    auto candidateOrder = [this](uint32 lhs, uint32 rhs) { return isMoreHated(iHeap[rhs], iHeap[lhs]); };
 
-    for (ThreatList::const_iterator iter = iThreatList.begin(); iter != iThreatList.end() && !found;)
+    iCandidates.clear();
+    iCandidates.push_back(0);
+
+    while (!iCandidates.empty())
     {
-        pCurrentRef = (*iter);
+        std::pop_heap(iCandidates.begin(), iCandidates.end(), candidateOrder);
+        uint32 index = iCandidates.back();
+        iCandidates.pop_back();
+
+        for (uint32 child = 2 * index + 1; child <= 2 * index + 2 && child < iHeap.size(); ++child)
+        {
+            iCandidates.push_back(child);
+            std::push_heap(iCandidates.begin(), iCandidates.end(), candidateOrder);
+        }
+
+        HostileReference* pCurrentRef = iHeap[index];
 
         Unit* pTarget = pCurrentRef->getTarget();
         MANGOS_ASSERT(pTarget);                             // if the ref has status online the target must be there!
@@ -325,61 +443,36 @@ HostileReference* ThreatContainer::selectNextVictim(Unit* attacker, HostileRefer
         bool isInMelee = attacker->CanReachWithMeleeAttack(pTarget);
         // Some bosses keep ranged targets in threat list but do not pick them with generic threat choice
         if (attacker->IsIgnoringRangedTargets() && !isInMelee)
-        {
-            ++iter;
             continue;
-        }
 
-        if (currentVictim) // select 1.3/1.1 better target in comparison current target
-        {
+        if (!currentVictim)                                 // select any
+            return pCurrentRef;
 
+        // select 1.3/1.1 better target in comparison current target
 
-            // normal case: pCurrentRef is still valid and most hated
-            if (currentVictim == pCurrentRef)
-            {
-                found = true;
-                break;
-            }
+        // normal case: pCurrentRef is still valid and most hated
+        if (currentVictim == pCurrentRef)
+            return pCurrentRef;
 
-            if (pCurrentRef->GetTauntState() > currentVictim->GetTauntState())
-            {
-                found = true;
-                break;
-            }
+        if (pCurrentRef->GetTauntState() > currentVictim->GetTauntState())
+            return pCurrentRef;
 
-            if (pCurrentRef->GetHostileState() > currentVictim->GetHostileState())
-            {
-                found = true;
-                break;
-            }
+        if (pCurrentRef->GetHostileState() > currentVictim->GetHostileState())
+            return pCurrentRef;
 
-            // list sorted and and we check current target, then this is best case
-            if (pCurrentRef->getThreat() <= 1.1f * currentVictim->getThreat())
-            {
-                pCurrentRef = currentVictim;
-                found = true;
-                break;
-            }
+        // list sorted and and we check current target, then this is best case
+        if (pCurrentRef->getThreat() <= 1.1f * currentVictim->getThreat())
+            return currentVictim;
 
-            if (pCurrentRef->getThreat() > 1.3f * currentVictim->getThreat() ||
-                (pCurrentRef->getThreat() > 1.1f * currentVictim->getThreat() && isInMelee))
-            {
-                // implement 110% threat rule for targets in melee range
-                found = true;                           // and 130% rule for targets in ranged distances
-                break;                                  // for selecting alive targets
-            }
-        }
-        else                                            // select any
+        if (pCurrentRef->getThreat() > 1.3f * currentVictim->getThreat() ||
+            (pCurrentRef->getThreat() > 1.1f * currentVictim->getThreat() && isInMelee))
         {
-            found = true;
-            break;
-        }
-        ++iter;
+            // implement 110% threat rule for targets in melee range
+            return pCurrentRef;                             // and 130% rule for targets in ranged distances
+        }                                                   // for selecting alive targets
     }
-    if (!found)
-        pCurrentRef = nullptr;
 
-    return pCurrentRef;
+    return nullptr;
 }
 
 //============================================================
@@ -500,7 +593,7 @@ void ThreatManager::TauntUpdate()
     for (auto tauntAura : tauntAuras)
         tauntStates[tauntAura->GetCasterGuid()] = TauntState(state++);
 
-    for (auto& ref : iThreatContainer.getThreatList())
+    for (auto& ref : iThreatContainer.iHeap)
     {
         if (ref->GetTauntState() == STATE_FIXATED)
             continue;
@@ -519,7 +612,7 @@ void ThreatManager::FixateTarget(Unit* victim)
     if (fixateRef)
         fixateRef->SetTauntState(STATE_FIXATED);
 
-    for (auto& ref : iThreatContainer.getThreatList())
+    for (auto& ref : iThreatContainer.iHeap)
         if (ref != fixateRef && ref->GetTauntState() == STATE_FIXATED)
             ref->SetTauntState(STATE_NONE);
 
@@ -550,35 +643,28 @@ void ThreatManager::processThreatEvent(ThreatRefStatusChangeEvent& threatRefStat
     switch (threatRefStatusChangeEvent.getType())
     {
         case UEV_THREAT_REF_THREAT_CHANGE:
-            if ((getCurrentVictim() == hostileReference && threatRefStatusChangeEvent.getFValue() < 0.0f) ||
-                    (getCurrentVictim() != hostileReference && threatRefStatusChangeEvent.getFValue() > 0.0f))
-                setDirty(true);                             // the order in the threat list might have changed
+            // the order in the threat list might have changed
+            iThreatContainer.updateReference(hostileReference);
+            iThreatOfflineContainer.updateReference(hostileReference);
             break;
         case UEV_THREAT_REF_ONLINE_STATUS:
+            // remove before adding, the reference knows its position only in one container
             if (!hostileReference->isOnline())
             {
                 if (hostileReference == getCurrentVictim())
-                {
                     setCurrentVictim(nullptr);
-                    setDirty(true);
-                }
                 iThreatContainer.remove(hostileReference);
                 iThreatOfflineContainer.addReference(hostileReference);
             }
             else
             {
-                if (getCurrentVictim() && hostileReference->getThreat() > (1.1f * getCurrentVictim()->getThreat()))
-                    setDirty(true);
-                iThreatContainer.addReference(hostileReference);
                 iThreatOfflineContainer.remove(hostileReference);
+                iThreatContainer.addReference(hostileReference);
             }
             break;
         case UEV_THREAT_REF_REMOVE_FROM_LIST:
             if (hostileReference == getCurrentVictim())
-            {
                 setCurrentVictim(nullptr);
-                setDirty(true);
-            }
             if (hostileReference->isOnline())
             {
                 iThreatContainer.remove(hostileReference);
@@ -596,7 +682,7 @@ void ThreatManager::processThreatEvent(ThreatRefStatusChangeEvent& threatRefStat
 
 void ThreatManager::ClearSuppressed(HostileReference* except)
 {
-    for (HostileReference* const curRef : iThreatContainer.getThreatList())
+    for (HostileReference* const curRef : iThreatContainer.iHeap)
         if (curRef->GetHostileState() == STATE_SUPPRESSED && curRef != except && !getOwner()->IsSuppressedTarget(curRef->getTarget()))
             curRef->SetHostileState(STATE_NORMAL);
 }
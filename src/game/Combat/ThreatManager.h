@@ -24,7 +24,7 @@
 #include "Utilities/LinkedReference/Reference.h"
 #include "Entities/UnitEvents.h"
 #include "Entities/ObjectGuid.h"
-#include <list>
+#include <vector>
 
 //==============================================================
 
@@ -130,6 +130,8 @@ class HostileReference : public Reference<Unit, ThreatManager>
 
         Unit* getSourceUnit() const;
     private:
+        friend class ThreatContainer;
+
         float iThreat;
         HostileState m_hostileState;
         bool m_suppresabilityToggle;
@@ -138,17 +140,29 @@ class HostileReference : public Reference<Unit, ThreatManager>
         ObjectGuid iUnitGuid;
         bool m_online;
         bool iAccessible;
+        uint32 iContainerIndex;                             // position in the heap of the container holding it
+        uint32 iContainerOrder;                             // order of adding to that container, older first on equal threat
 };
 
 //==============================================================
 class ThreatManager;
 
-typedef std::list<HostileReference*> ThreatList;
+typedef std::vector<HostileReference*> ThreatList;
 
+/**
+ * References of a threat manager kept in an indexed binary max-heap, ordered by taunt state,
+ * hostile state and threat, with each reference knowing its position in the heap.
+ *
+ * Threat changes move the changed reference up or down in O(log n) at once, so the most hated
+ * reference is always at the top and getting the victim does not sort the list. Taunt and
+ * suppression changes are made on many references in loops, they mark the container dirty
+ * and the heap is rebuilt in O(n) at the next update. The list given out by getThreatList()
+ * is sorted from the heap only when asked for after a change.
+ */
 class ThreatContainer
 {
     public:
-        ThreatContainer() { iDirty = false; }
+        ThreatContainer() : iDirty(false), iListSorted(true), iNextOrder(0) {}
         ~ThreatContainer() { clearReferences(); }
 
         HostileReference* addThreat(Unit* victim, float threat);
@@ -157,29 +171,42 @@ class ThreatContainer
 
         HostileReference* selectNextVictim(Unit* attacker, HostileReference* currentVictim);
 
-        void setDirty(bool dirty) { iDirty = dirty; }
+        void setDirty(bool dirty) { iDirty = dirty; if (dirty) iListSorted = false; }
 
         bool isDirty() const { return iDirty; }
 
-        bool empty() const { return iThreatList.empty(); }
+        bool empty() const { return iHeap.empty(); }
 
-        HostileReference* getMostHated() { return iThreatList.empty() ? nullptr : iThreatList.front(); }
+        HostileReference* getMostHated() { update(); return iHeap.empty() ? nullptr : iHeap.front(); }
 
         HostileReference* getReferenceByTarget(Unit* victim);
 
-        ThreatList const& getThreatList() const { return iThreatList; }
+        // sorted by threat, most hated first
+        ThreatList const& getThreatList() const;
     protected:
         friend class ThreatManager;
 
-        void remove(HostileReference* ref) { iThreatList.remove(ref); }
-        void addReference(HostileReference* hostileReference) { iThreatList.push_back(hostileReference); }
+        void remove(HostileReference* ref);
+        void addReference(HostileReference* hostileReference);
+        // Move the reference to its place after its threat changed
+        void updateReference(HostileReference* ref);
         void clearReferences();
-        // Sort the list if necessary
+        // Rebuild the heap if necessary
         void update();
 
-        ThreatList iThreatList;
+        bool contains(HostileReference const* ref) const { return ref->iContainerIndex < iHeap.size() && iHeap[ref->iContainerIndex] == ref; }
+        static bool isMoreHated(HostileReference const* lhs, HostileReference const* rhs);
+        void siftUp(uint32 index);
+        void siftDown(uint32 index);
+        void place(HostileReference* ref, uint32 index) { iHeap[index] = ref; ref->iContainerIndex = index; }
+
+        ThreatList iHeap;
+        mutable ThreatList iThreatList;                     // same references as the heap, sorted when asked for
     private:
         bool iDirty;
+        mutable bool iListSorted;
+        uint32 iNextOrder;
+        std::vector<uint32> iCandidates;                    // heap positions still to check in selectNextVictim
 };
 
 //=================================================
@@ -492,6 +492,8 @@ void WorldSession::HandlePlayerLoginOpcode(WorldPacket& recv_data)
         return;
     }
 
+    // load after the pending saves of the character
+    SqlAsyncRoute dbRoute(CharacterDatabase, playerGuid.GetCounter());
     CharacterDatabase.DelayQueryHolder(&chrHandler, &CharacterHandler::HandlePlayerLoginCallback, holder);
 }
 
@@ -514,6 +516,7 @@ void PlayerbotMgr::LoginPlayerBot(ObjectGuid playerGuid)
         delete holder;                                      // delete all unprocessed queries
         return;
     }
+    SqlAsyncRoute dbRoute(CharacterDatabase, playerGuid.GetCounter());
     CharacterDatabase.DelayQueryHolder(&chrHandler, &CharacterHandler::HandlePlayerBotLoginCallback, holder);
 }
 #endif
@@ -32,6 +32,8 @@ Corpse::Corpse(CorpseType type) : WorldObject(),
     m_objectTypeId = TYPEID_CORPSE;
     m_updateFlag = (UPDATEFLAG_TRANSPORT | UPDATEFLAG_ALL | UPDATEFLAG_HAS_POSITION);
 
+    SetGridPackedSlot(&m_gridRef);
+
     m_valuesCount = CORPSE_END;
 
     m_type = type;
@@ -146,6 +146,8 @@ Creature::Creature(CreatureSubtype subtype) : Unit(),
     m_regenTimer = 200;
     m_valuesCount = UNIT_END;
 
+    SetGridPackedSlot(&m_gridRef);
+
     for (unsigned int& m_spell : m_spells)
         m_spell = 0;
 
@@ -167,7 +169,7 @@ void Creature::AddToWorld()
 {
     ///- Register the creature for guid lookup
     if (!IsInWorld() && GetObjectGuid().GetHigh() == HIGHGUID_UNIT)
-        GetMap()->GetObjectsStore().insert<Creature>(GetObjectGuid(), (Creature*)this);
+        GetMap()->InsertObject<Creature>(GetObjectGuid(), (Creature*)this);
 
     Unit::AddToWorld();
 
@@ -185,7 +187,7 @@ void Creature::RemoveFromWorld()
     if (IsInWorld())
     {
         if (GetObjectGuid().GetHigh() == HIGHGUID_UNIT)
-            GetMap()->GetObjectsStore().erase<Creature>(GetObjectGuid(), (Creature*)nullptr);
+            GetMap()->EraseObject<Creature>(GetObjectGuid());
 
         if (m_countSpawns)
             GetMap()->RemoveFromSpawnCount(GetObjectGuid());
@@ -31,6 +31,8 @@ DynamicObject::DynamicObject() : WorldObject(), m_spellId(0), m_effIndex(), m_al
     m_objectTypeId = TYPEID_DYNAMICOBJECT;
     m_updateFlag = (UPDATEFLAG_ALL | UPDATEFLAG_HAS_POSITION);
 
+    SetGridPackedSlot(&m_gridRef);
+
     m_valuesCount = DYNAMICOBJECT_END;
 }
 
@@ -38,7 +40,7 @@ void DynamicObject::AddToWorld()
 {
     ///- Register the dynamicObject for guid lookup
     if (!IsInWorld())
-        GetMap()->GetObjectsStore().insert<DynamicObject>(GetObjectGuid(), (DynamicObject*)this);
+        GetMap()->InsertObject<DynamicObject>(GetObjectGuid(), (DynamicObject*)this);
 
     WorldObject::AddToWorld();
 }
@@ -48,7 +50,7 @@ void DynamicObject::RemoveFromWorld()
     ///- Remove the dynamicObject from the accessor
     if (IsInWorld())
     {
-        GetMap()->GetObjectsStore().erase<DynamicObject>(GetObjectGuid(), (DynamicObject*)nullptr);
+        GetMap()->EraseObject<DynamicObject>(GetObjectGuid());
         GetViewPoint().Event_RemovedFromWorld();
     }
 
@@ -51,6 +51,8 @@ GameObject::GameObject() : WorldObject(),
     m_objectTypeId = TYPEID_GAMEOBJECT;
     m_updateFlag = (UPDATEFLAG_ALL | UPDATEFLAG_HAS_POSITION);
 
+    SetGridPackedSlot(&m_gridRef);
+
     m_valuesCount = GAMEOBJECT_END;
     m_respawnTime = 0;
     m_respawnDelayTime = 25;
@@ -81,7 +83,7 @@ void GameObject::AddToWorld()
 {
     ///- Register the gameobject for guid lookup
     if (!IsInWorld())
-        GetMap()->GetObjectsStore().insert<GameObject>(GetObjectGuid(), (GameObject*)this);
+        GetMap()->InsertObject<GameObject>(GetObjectGuid(), (GameObject*)this);
 
     if (m_model)
         GetMap()->InsertGameObjectModel(*m_model);
@@ -120,7 +122,7 @@ void GameObject::RemoveFromWorld()
         if (m_model && GetMap()->ContainsGameObjectModel(*m_model))
             GetMap()->RemoveGameObjectModel(*m_model);
 
-        GetMap()->GetObjectsStore().erase<GameObject>(GetObjectGuid(), (GameObject*)nullptr);
+        GetMap()->EraseObject<GameObject>(GetObjectGuid());
     }
 
     Object::RemoveFromWorld();
@@ -1812,11 +1814,28 @@ void GameObject::UpdateCollisionState() const
     if (!m_model || !IsInWorld())
         return;
 
-    m_model->enable(IsCollisionEnabled() ? true : false);
+    // the model tree is shared by all regions of a continent, models change at the merge point
+    ObjectGuid guid = GetObjectGuid();
+    if (GetMap()->DeferToRegionMerge([guid](Map* map)
+    {
+        if (GameObject* go = map->GetGameObject(guid))
+            go->UpdateCollisionState();
+    }))
+        return;
+
+    GetMap()->EnableGameObjectModel(*m_model, IsCollisionEnabled() ? true : false);
 }
 
 void GameObject::UpdateModel()
 {
+    ObjectGuid guid = GetObjectGuid();
+    if (IsInWorld() && GetMap()->DeferToRegionMerge([guid](Map* map)
+    {
+        if (GameObject* go = map->GetGameObject(guid))
+            go->UpdateModel();
+    }))
+        return;
+
     if (m_model && IsInWorld() && GetMap()->ContainsGameObjectModel(*m_model))
         GetMap()->RemoveGameObjectModel(*m_model);
     delete m_model;
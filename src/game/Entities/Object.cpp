@@ -351,260 +351,349 @@ void Object::BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, UpdateMask* u
 
     // 2 specialized loops for speed optimization in non-unit case
     if (isType(TYPEMASK_UNIT))                              // unit (creature/player) case
+    {
+        for (uint16 index = 0; index < m_valuesCount; ++index)
+        {
+            if (updateMask->GetBit(index))
+                *data << GetUnitUpdateFieldValue(index, target);
+        }
+    }
+    else if (isType(TYPEMASK_GAMEOBJECT))                   // gameobject case
     {
         for (uint16 index = 0; index < m_valuesCount; ++index)
         {
             if (updateMask->GetBit(index))
             {
-                if (index == UNIT_NPC_FLAGS)
-                {
-                    uint32 appendValue = m_uint32Values[index];
+                // send in current format (float as float, uint32 as uint32)
+                if (index == GAMEOBJECT_DYN_FLAGS)
+                    *data << GetGameObjectDynFlagsValue(IsActivateToQuest);
+                else
+                    *data << m_uint32Values[index];         // other cases
+            }
+        }
+    }
+    else                                                    // other objects case (no special index checks)
+    {
+        for (uint16 index = 0; index < m_valuesCount; ++index)
+        {
+            if (updateMask->GetBit(index))
+            {
+                // send in current format (float as float, uint32 as uint32)
+                *data << m_uint32Values[index];
+            }
+        }
+    }
+}
 
-                    if (GetTypeId() == TYPEID_UNIT)
-                    {
-                        if (appendValue & UNIT_NPC_FLAG_TRAINER)
-                        {
-                            if (!((Creature*)this)->IsTrainerOf(target, false))
-                                appendValue &= ~UNIT_NPC_FLAG_TRAINER;
-                        }
-
-                        if (appendValue & UNIT_NPC_FLAG_STABLEMASTER)
-                        {
-                            if (target->getClass() != CLASS_HUNTER)
-                                appendValue &= ~UNIT_NPC_FLAG_STABLEMASTER;
-                        }
-
-                        if (appendValue & UNIT_NPC_FLAG_FLIGHTMASTER)
-                        {
-                            QuestRelationsMapBounds bounds = sObjectMgr.GetCreatureQuestRelationsMapBounds(((Creature*)this)->GetEntry());
-                            for (QuestRelationsMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
-                            {
-                                Quest const* pQuest = sObjectMgr.GetQuestTemplate(itr->second);
-                                if (target->CanSeeStartQuest(pQuest))
-                                {
-                                    appendValue &= ~UNIT_NPC_FLAG_FLIGHTMASTER;
-                                    break;
-                                }
-                            }
-
-                            bounds = sObjectMgr.GetCreatureQuestInvolvedRelationsMapBounds(((Creature*)this)->GetEntry());
-                            for (QuestRelationsMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
-                            {
-                                Quest const* pQuest = sObjectMgr.GetQuestTemplate(itr->second);
-                                if (target->CanRewardQuest(pQuest, false))
-                                {
-                                    appendValue &= ~UNIT_NPC_FLAG_FLIGHTMASTER;
-                                    break;
-                                }
-                            }
-                        }
-                    }
+bool Object::IsFogOfWarStatField(uint16 index)
+{
+    return index == UNIT_FIELD_RANGEDATTACKTIME ||
+           index == UNIT_FIELD_MINDAMAGE || index == UNIT_FIELD_MAXDAMAGE ||
+           index == UNIT_FIELD_MINOFFHANDDAMAGE || index == UNIT_FIELD_MAXOFFHANDDAMAGE ||
+           (index >= UNIT_FIELD_STAT0 && index < UNIT_FIELD_BASE_MANA) ||
+           index == UNIT_FIELD_BASE_HEALTH || index == UNIT_FIELD_ATTACK_POWER ||
+           index == UNIT_FIELD_ATTACK_POWER_MODS || index == UNIT_FIELD_ATTACK_POWER_MULTIPLIER ||
+           index == UNIT_FIELD_RANGED_ATTACK_POWER || index == UNIT_FIELD_RANGED_ATTACK_POWER_MODS ||
+           index == UNIT_FIELD_RANGED_ATTACK_POWER_MULTIPLIER || index == UNIT_FIELD_MINRANGEDDAMAGE ||
+           index == UNIT_FIELD_MAXRANGEDDAMAGE || (index >= UNIT_FIELD_POWER_COST_MODIFIER && index <= UNIT_FIELD_POWER_COST_MULTIPLIER_06);
+}
 
-                    *data << uint32(appendValue);
-                }
-                // FIXME: Some values at server stored in float format but must be sent to client in uint32 format
-                else if (index >= UNIT_FIELD_BASEATTACKTIME && index <= UNIT_FIELD_RANGEDATTACKTIME)
-                {
-                    // convert from float to uint32 and send
-                    *data << uint32(m_floatValues[index] < 0 ? 0 : m_floatValues[index]);
-                }
+bool Object::IsViewerDependentUpdateField(uint16 index) const
+{
+    if (isType(TYPEMASK_UNIT))
+    {
+        switch (index)
+        {
+            case UNIT_NPC_FLAGS:
+            case UNIT_FIELD_HEALTH:
+            case UNIT_FIELD_MAXHEALTH:
+            case UNIT_FIELD_FLAGS:
+            case UNIT_DYNAMIC_FLAGS:
+            case UNIT_FIELD_FACTIONTEMPLATE:
+                return true;
+            default:
+                return IsFogOfWarStatField(index);
+        }
+    }
 
-                // there are some float values which may be negative or can't get negative due to other checks
-                else if ((index >= PLAYER_FIELD_NEGSTAT0    && index <= PLAYER_FIELD_NEGSTAT4) ||
-                         (index >= PLAYER_FIELD_RESISTANCEBUFFMODSPOSITIVE  && index <= (PLAYER_FIELD_RESISTANCEBUFFMODSPOSITIVE + 6)) ||
-                         (index >= PLAYER_FIELD_RESISTANCEBUFFMODSNEGATIVE  && index <= (PLAYER_FIELD_RESISTANCEBUFFMODSNEGATIVE + 6)) ||
-                         (index >= PLAYER_FIELD_POSSTAT0    && index <= PLAYER_FIELD_POSSTAT4))
-                {
-                    *data << uint32(m_floatValues[index]);
-                }
-                else if (index == UNIT_FIELD_HEALTH || index == UNIT_FIELD_MAXHEALTH)
-                {
-                    uint32 value = m_uint32Values[index];
+    if (isType(TYPEMASK_GAMEOBJECT))
+        return index == GAMEOBJECT_DYN_FLAGS;
 
-                    // Fog of War: replace absolute health values with percentages for non-allied units according to settings
-                    if (!static_cast<const Unit*>(this)->IsFogOfWarVisibleHealth(target))
-                    {
-                        switch (index)
-                        {
-                            case UNIT_FIELD_HEALTH:     value = uint32(ceil((100.0 * value) / m_uint32Values[UNIT_FIELD_MAXHEALTH]));   break;
-                            case UNIT_FIELD_MAXHEALTH:  value = 100;                                                                    break;
-                        }
-                    }
+    return false;
+}
 
-                    *data << value;
-                }
-                // Fog of War: hide stat values for non-allied units according to settings
-                else if ((index == UNIT_FIELD_RANGEDATTACKTIME ||
-                          index == UNIT_FIELD_MINDAMAGE || index == UNIT_FIELD_MAXDAMAGE ||
-                          index == UNIT_FIELD_MINOFFHANDDAMAGE || index == UNIT_FIELD_MAXOFFHANDDAMAGE ||
-                          (index >= UNIT_FIELD_STAT0 && index < UNIT_FIELD_BASE_MANA) ||
-                          index == UNIT_FIELD_BASE_HEALTH || index == UNIT_FIELD_ATTACK_POWER ||
-                          index == UNIT_FIELD_ATTACK_POWER_MODS || index == UNIT_FIELD_ATTACK_POWER_MULTIPLIER ||
-                          index == UNIT_FIELD_RANGED_ATTACK_POWER || index == UNIT_FIELD_RANGED_ATTACK_POWER_MODS ||
-                          index == UNIT_FIELD_RANGED_ATTACK_POWER_MULTIPLIER || index == UNIT_FIELD_MINRANGEDDAMAGE ||
-                          index == UNIT_FIELD_MAXRANGEDDAMAGE || (index >= UNIT_FIELD_POWER_COST_MODIFIER && index <= UNIT_FIELD_POWER_COST_MULTIPLIER_06)) &&
-                          !static_cast<const Unit*>(this)->IsFogOfWarVisibleStats(target))
-                {
-                    *data << uint32(0);
-                }
+uint32 Object::GetUnitUpdateFieldValue(uint16 index, Player* target) const
+{
+    if (index == UNIT_NPC_FLAGS)
+    {
+        uint32 appendValue = m_uint32Values[index];
 
-                // Gamemasters should be always able to select units - remove not selectable flag
-                else if (index == UNIT_FIELD_FLAGS && target->isGameMaster())
-                {
-                    *data << (m_uint32Values[index] & ~UNIT_FLAG_NOT_SELECTABLE);
-                }
-                // Hide lootable animation for unallowed players
-                // Handle tapped flag
-                else if (index == UNIT_DYNAMIC_FLAGS && GetTypeId() == TYPEID_UNIT)
-                {
-                    Creature* creature = (Creature*)this;
-                    uint32 dynflagsValue = m_uint32Values[index];
-                    bool setTapFlags = false;
+        if (GetTypeId() == TYPEID_UNIT)
+        {
+            if (appendValue & UNIT_NPC_FLAG_TRAINER)
+            {
+                if (!((Creature*)this)->IsTrainerOf(target, false))
+                    appendValue &= ~UNIT_NPC_FLAG_TRAINER;
+            }
 
-                    if (creature->isAlive())
-                    {
-                        // creature is alive so, not lootable
-                        dynflagsValue = dynflagsValue & ~UNIT_DYNFLAG_LOOTABLE;
-
-                        if (creature->isInCombat())
-                        {
-                            // as creature is in combat we have to manage tap flags
-                            setTapFlags = true;
-                        }
-                        else
-                        {
-                            // creature is not in combat so its not tapped
-                            dynflagsValue = dynflagsValue & ~UNIT_DYNFLAG_TAPPED;
-                            //sLog.outString(">> %s is not in combat so not tapped by %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
-                        }
-                    }
-                    else
-                    {
-                        // check loot flag
-                        if (creature->loot && creature->loot->CanLoot(target))
-                        {
-                            // creature is dead and this player can loot it
-                            dynflagsValue = dynflagsValue | UNIT_DYNFLAG_LOOTABLE;
-                            //sLog.outString(">> %s is lootable for %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
-                        }
-                        else
-                        {
-                            // creature is dead but this player cannot loot it
-                            dynflagsValue = dynflagsValue & ~UNIT_DYNFLAG_LOOTABLE;
-                            //sLog.outString(">> %s is not lootable for %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
-                        }
-
-                        // as creature is died we have to manage tap flags
-                        setTapFlags = true;
-                    }
+            if (appendValue & UNIT_NPC_FLAG_STABLEMASTER)
+            {
+                if (target->getClass() != CLASS_HUNTER)
+                    appendValue &= ~UNIT_NPC_FLAG_STABLEMASTER;
+            }
 
-                    // check tap flags
-                    if (setTapFlags)
+            if (appendValue & UNIT_NPC_FLAG_FLIGHTMASTER)
+            {
+                QuestRelationsMapBounds bounds = sObjectMgr.GetCreatureQuestRelationsMapBounds(((Creature*)this)->GetEntry());
+                for (QuestRelationsMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
+                {
+                    Quest const* pQuest = sObjectMgr.GetQuestTemplate(itr->second);
+                    if (target->CanSeeStartQuest(pQuest))
                     {
-                        if (creature->IsTappedBy(target))
-                        {
-                            // creature is in combat or died and tapped by this player
-                            dynflagsValue = dynflagsValue & ~UNIT_DYNFLAG_TAPPED;
-                            //sLog.outString(">> %s is tapped by %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
-                        }
-                        else
-                        {
-                            // creature is in combat or died but not tapped by this player
-                            dynflagsValue = dynflagsValue | UNIT_DYNFLAG_TAPPED;
-                            //sLog.outString(">> %s is not tapped by %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
-                        }
+                        appendValue &= ~UNIT_NPC_FLAG_FLIGHTMASTER;
+                        break;
                     }
+                }
 
-                    if (GetTypeId() == TYPEID_UNIT || GetTypeId() == TYPEID_PLAYER)
+                bounds = sObjectMgr.GetCreatureQuestInvolvedRelationsMapBounds(((Creature*)this)->GetEntry());
+                for (QuestRelationsMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
+                {
+                    Quest const* pQuest = sObjectMgr.GetQuestTemplate(itr->second);
+                    if (target->CanRewardQuest(pQuest, false))
                     {
-                        Unit* unit = (Unit*)this; // hunters mark effects should only be visible to owners and not all players
-                        if (!unit->HasAuraTypeWithCaster(SPELL_AURA_MOD_STALKED, target->GetObjectGuid()))
-                            dynflagsValue &= ~UNIT_DYNFLAG_TRACK_UNIT;
+                        appendValue &= ~UNIT_NPC_FLAG_FLIGHTMASTER;
+                        break;
                     }
-
-                    *data << dynflagsValue;
                 }
-                else if (index == UNIT_FIELD_FACTIONTEMPLATE)
-                {
-                    uint32 value = m_uint32Values[index];
+            }
+        }
 
-                    // [XFACTION]: Alter faction if detected crossfaction group interaction when updating faction field:
-                    if (this != target && GetTypeId() == TYPEID_PLAYER && sWorld.getConfig(CONFIG_BOOL_ALLOW_TWO_SIDE_INTERACTION_GROUP))
-                    {
-                        Player const* thisPlayer = static_cast<Player const*>(this);
-                        const uint32 targetTeam = target->GetTeam();
-
-                        if (thisPlayer->GetTeam() != targetTeam && !thisPlayer->HasCharmer() && target->IsInGroup(thisPlayer))
-                        {
-                            switch (targetTeam)
-                            {
-                                case ALLIANCE:  value = 1054;   break;  // "Alliance Generic"
-                                case HORDE:     value = 1495;   break;  // "Horde Generic"
-                            }
-                        }
-                    }
+        return uint32(appendValue);
+    }
+    // FIXME: Some values at server stored in float format but must be sent to client in uint32 format
+    else if (index >= UNIT_FIELD_BASEATTACKTIME && index <= UNIT_FIELD_RANGEDATTACKTIME)
+    {
+        // convert from float to uint32 and send
+        return uint32(m_floatValues[index] < 0 ? 0 : m_floatValues[index]);
+    }
 
-                    *data << value;
-                }
-                else                                        // Unhandled index, just send
-                {
-                    // send in current format (float as float, uint32 as uint32)
-                    *data << m_uint32Values[index];
-                }
+    // there are some float values which may be negative or can't get negative due to other checks
+    else if ((index >= PLAYER_FIELD_NEGSTAT0    && index <= PLAYER_FIELD_NEGSTAT4) ||
+             (index >= PLAYER_FIELD_RESISTANCEBUFFMODSPOSITIVE  && index <= (PLAYER_FIELD_RESISTANCEBUFFMODSPOSITIVE + 6)) ||
+             (index >= PLAYER_FIELD_RESISTANCEBUFFMODSNEGATIVE  && index <= (PLAYER_FIELD_RESISTANCEBUFFMODSNEGATIVE + 6)) ||
+             (index >= PLAYER_FIELD_POSSTAT0    && index <= PLAYER_FIELD_POSSTAT4))
+    {
+        return uint32(m_floatValues[index]);
+    }
+    else if (index == UNIT_FIELD_HEALTH || index == UNIT_FIELD_MAXHEALTH)
+    {
+        uint32 value = m_uint32Values[index];
+
+        // Fog of War: replace absolute health values with percentages for non-allied units according to settings
+        if (!static_cast<const Unit*>(this)->IsFogOfWarVisibleHealth(target))
+        {
+            switch (index)
+            {
+                case UNIT_FIELD_HEALTH:     value = uint32(ceil((100.0 * value) / m_uint32Values[UNIT_FIELD_MAXHEALTH]));   break;
+                case UNIT_FIELD_MAXHEALTH:  value = 100;                                                                    break;
             }
         }
+
+        return value;
     }
-    else if (isType(TYPEMASK_GAMEOBJECT))                   // gameobject case
+    // Fog of War: hide stat values for non-allied units according to settings
+    else if (IsFogOfWarStatField(index) && !static_cast<const Unit*>(this)->IsFogOfWarVisibleStats(target))
     {
-        for (uint16 index = 0; index < m_valuesCount; ++index)
+        return uint32(0);
+    }
+
+    // Gamemasters should be always able to select units - remove not selectable flag
+    else if (index == UNIT_FIELD_FLAGS && target->isGameMaster())
+    {
+        return (m_uint32Values[index] & ~UNIT_FLAG_NOT_SELECTABLE);
+    }
+    // Hide lootable animation for unallowed players
+    // Handle tapped flag
+    else if (index == UNIT_DYNAMIC_FLAGS && GetTypeId() == TYPEID_UNIT)
+    {
+        Creature* creature = (Creature*)this;
+        uint32 dynflagsValue = m_uint32Values[index];
+        bool setTapFlags = false;
+
+        if (creature->isAlive())
         {
-            if (updateMask->GetBit(index))
+            // creature is alive so, not lootable
+            dynflagsValue = dynflagsValue & ~UNIT_DYNFLAG_LOOTABLE;
+
+            if (creature->isInCombat())
             {
-                // send in current format (float as float, uint32 as uint32)
-                if (index == GAMEOBJECT_DYN_FLAGS)
-                {
-                    if (IsActivateToQuest)
-                    {
-                        GameObject const* gameObject = static_cast<GameObject const*>(this);
-                        switch (((GameObject*)this)->GetGoType())
-                        {
-                            case GAMEOBJECT_TYPE_QUESTGIVER:
-                            case GAMEOBJECT_TYPE_CHEST:
-                                if (gameObject->GetLootState() == GO_READY || gameObject->GetLootState() == GO_ACTIVATED)
-                                    *data << uint16(GO_DYNFLAG_LO_ACTIVATE | GO_DYNFLAG_LO_SPARKLE);
-                                else
-                                    *data << uint16(0);
-                                *data << uint16(0);
-                                break;
-                            case GAMEOBJECT_TYPE_GENERIC:
-                            case GAMEOBJECT_TYPE_SPELL_FOCUS:
-                            case GAMEOBJECT_TYPE_GOOBER:
-                                *data << uint16(GO_DYNFLAG_LO_ACTIVATE);
-                                *data << uint16(0);
-                                break;
-                            default:
-                                *data << uint32(0);         // unknown, not happen.
-                                break;
-                        }
-                    }
-                    else
-                        *data << uint32(0);                 // disable quest object
-                }
-                else
-                    *data << m_uint32Values[index];         // other cases
+                // as creature is in combat we have to manage tap flags
+                setTapFlags = true;
+            }
+            else
+            {
+                // creature is not in combat so its not tapped
+                dynflagsValue = dynflagsValue & ~UNIT_DYNFLAG_TAPPED;
+                //sLog.outString(">> %s is not in combat so not tapped by %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
+            }
+        }
+        else
+        {
+            // check loot flag
+            if (creature->loot && creature->loot->CanLoot(target))
+            {
+                // creature is dead and this player can loot it
+                dynflagsValue = dynflagsValue | UNIT_DYNFLAG_LOOTABLE;
+                //sLog.outString(">> %s is lootable for %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
+            }
+            else
+            {
+                // creature is dead but this player cannot loot it
+                dynflagsValue = dynflagsValue & ~UNIT_DYNFLAG_LOOTABLE;
+                //sLog.outString(">> %s is not lootable for %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
             }
+
+            // as creature is died we have to manage tap flags
+            setTapFlags = true;
         }
+
+        // check tap flags
+        if (setTapFlags)
+        {
+            if (creature->IsTappedBy(target))
+            {
+                // creature is in combat or died and tapped by this player
+                dynflagsValue = dynflagsValue & ~UNIT_DYNFLAG_TAPPED;
+                //sLog.outString(">> %s is tapped by %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
+            }
+            else
+            {
+                // creature is in combat or died but not tapped by this player
+                dynflagsValue = dynflagsValue | UNIT_DYNFLAG_TAPPED;
+                //sLog.outString(">> %s is not tapped by %s", this->GetGuidStr().c_str(), target->GetGuidStr().c_str());
+            }
+        }
+
+        if (GetTypeId() == TYPEID_UNIT || GetTypeId() == TYPEID_PLAYER)
+        {
+            Unit* unit = (Unit*)this; // hunters mark effects should only be visible to owners and not all players
+            if (!unit->HasAuraTypeWithCaster(SPELL_AURA_MOD_STALKED, target->GetObjectGuid()))
+                dynflagsValue &= ~UNIT_DYNFLAG_TRACK_UNIT;
+        }
+
+        return dynflagsValue;
     }
-    else                                                    // other objects case (no special index checks)
+    else if (index == UNIT_FIELD_FACTIONTEMPLATE)
     {
-        for (uint16 index = 0; index < m_valuesCount; ++index)
+        uint32 value = m_uint32Values[index];
+
+        // [XFACTION]: Alter faction if detected crossfaction group interaction when updating faction field:
+        if (this != target && GetTypeId() == TYPEID_PLAYER && sWorld.getConfig(CONFIG_BOOL_ALLOW_TWO_SIDE_INTERACTION_GROUP))
         {
-            if (updateMask->GetBit(index))
+            Player const* thisPlayer = static_cast<Player const*>(this);
+            const uint32 targetTeam = target->GetTeam();
+
+            if (thisPlayer->GetTeam() != targetTeam && !thisPlayer->HasCharmer() && target->IsInGroup(thisPlayer))
             {
-                // send in current format (float as float, uint32 as uint32)
-                *data << m_uint32Values[index];
+                switch (targetTeam)
+                {
+                    case ALLIANCE:  value = 1054;   break;  // "Alliance Generic"
+                    case HORDE:     value = 1495;   break;  // "Horde Generic"
+                }
             }
         }
+
+        return value;
+    }
+    else                                        // Unhandled index, just send
+    {
+        // send in current format (float as float, uint32 as uint32)
+        return m_uint32Values[index];
+    }
+}
+
+uint32 Object::GetGameObjectDynFlagsValue(bool activateToQuest) const
+{
+    if (!activateToQuest)
+        return 0;                                           // disable quest object
+
+    GameObject const* gameObject = static_cast<GameObject const*>(this);
+    switch (gameObject->GetGoType())
+    {
+        case GAMEOBJECT_TYPE_QUESTGIVER:
+        case GAMEOBJECT_TYPE_CHEST:
+            if (gameObject->GetLootState() == GO_READY || gameObject->GetLootState() == GO_ACTIVATED)
+                return GO_DYNFLAG_LO_ACTIVATE | GO_DYNFLAG_LO_SPARKLE;
+            return 0;
+        case GAMEOBJECT_TYPE_GENERIC:
+        case GAMEOBJECT_TYPE_SPELL_FOCUS:
+        case GAMEOBJECT_TYPE_GOOBER:
+            return GO_DYNFLAG_LO_ACTIVATE;
+        default:
+            return 0;                                       // unknown, not happen.
+    }
+}
+
+void Object::BuildValuesUpdateSnapshot(UpdateValuesSnapshot& snapshot) const
+{
+    ByteBuffer& buf = snapshot.block;
+
+    buf << uint8(UPDATETYPE_VALUES);
+    buf << GetPackGUID();
+
+    // the object itself never uses a shared snapshot, so the mask is the one of any other viewer
+    UpdateMask updateMask;
+    updateMask.SetCount(m_valuesCount);
+    _SetUpdateBits(&updateMask, nullptr);
+
+    if (isType(TYPEMASK_GAMEOBJECT) && !((GameObject*)this)->IsTransport())
+    {
+        updateMask.SetBit(GAMEOBJECT_DYN_FLAGS);
+        updateMask.SetBit(GAMEOBJECT_ANIMPROGRESS);
+    }
+
+    buf << (uint8)updateMask.GetBlockCount();
+    buf.append(updateMask.GetMask(), updateMask.GetLength());
+
+    bool isUnit = isType(TYPEMASK_UNIT);
+    for (uint16 index = 0; index < m_valuesCount; ++index)
+    {
+        if (!updateMask.GetBit(index))
+            continue;
+
+        if (IsViewerDependentUpdateField(index))
+        {
+            snapshot.patches.push_back(std::make_pair(uint32(buf.wpos()), index));
+            buf << uint32(0);                               // placeholder, patched for each viewer
+        }
+        else if (isUnit)
+            buf << GetUnitUpdateFieldValue(index, nullptr);
+        else
+            buf << m_uint32Values[index];
+    }
+
+    snapshot.built = true;
+}
+
+void Object::BuildValuesUpdateBlockForPlayer(UpdateData* data, Player* target, UpdateValuesSnapshot& snapshot) const
+{
+    if (!snapshot.built)
+        BuildValuesUpdateSnapshot(snapshot);
+
+    size_t pos = data->AddUpdateBlock(snapshot.block);
+
+    for (auto const& patch : snapshot.patches)
+    {
+        uint32 value;
+        if (isType(TYPEMASK_UNIT))
+            value = GetUnitUpdateFieldValue(patch.second, target);
+        else
+        {
+            GameObject const* gameObject = static_cast<GameObject const*>(this);
+            value = GetGameObjectDynFlagsValue(!gameObject->IsTransport() && (gameObject->ActivateToQuest(target) || target->isGameMaster()));
+        }
+
+        data->PatchUpdateBlock(pos + patch.first, value);
     }
 }
 
@@ -897,7 +986,7 @@ bool Object::PrintEntryError(char const* descr) const
 }
 
 
-void Object::BuildUpdateDataForPlayer(Player* pl, UpdateDataMapType& update_players) const
+void Object::BuildUpdateDataForPlayer(Player* pl, UpdateDataMapType& update_players, UpdateValuesSnapshot* snapshot) const
 {
     UpdateDataMapType::iterator iter = update_players.find(pl);
 
@@ -908,7 +997,10 @@ void Object::BuildUpdateDataForPlayer(Player* pl, UpdateDataMapType& update_play
         iter = p.first;
     }
 
-    BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
+    if (snapshot)
+        BuildValuesUpdateBlockForPlayer(&iter->second, iter->first, *snapshot);
+    else
+        BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
 }
 
 void Object::AddToClientUpdateList()
@@ -954,10 +1046,16 @@ void Object::ForceValuesUpdateAtIndex(uint16 index)
 WorldObject::WorldObject() :
     m_isOnEventNotified(false),
     m_currMap(nullptr), m_mapId(0),
-    m_InstanceId(0), m_isActiveObject(false)
+    m_InstanceId(0), m_gridPackedSlot(nullptr), m_isActiveObject(false)
 {
 }
 
+void WorldObject::SetGridPackedSlot(GridPackedSlot* slot)
+{
+    m_gridPackedSlot = slot;
+    m_gridPackedSlot->SetPackedOwnerCoords(&m_position.x);
+}
+
 void WorldObject::CleanupsBeforeDelete()
 {
     RemoveFromWorld();
@@ -975,6 +1073,9 @@ void WorldObject::Relocate(float x, float y, float z, float orientation)
     m_position.z = z;
     m_position.o = orientation;
 
+    if (m_gridPackedSlot)
+        m_gridPackedSlot->UpdatePackedPosition(x, y, z);
+
     if (isType(TYPEMASK_UNIT))
         ((Unit*)this)->m_movementInfo.ChangePosition(x, y, z, orientation);
 }
@@ -985,6 +1086,9 @@ void WorldObject::Relocate(float x, float y, float z)
     m_position.y = y;
     m_position.z = z;
 
+    if (m_gridPackedSlot)
+        m_gridPackedSlot->UpdatePackedPosition(x, y, z);
+
     if (isType(TYPEMASK_UNIT))
         ((Unit*)this)->m_movementInfo.ChangePosition(x, y, z, GetOrientation());
 }
@@ -2035,6 +2139,7 @@ struct WorldObjectChangeAccumulator
 {
     UpdateDataMapType& i_updateDatas;
     WorldObject& i_object;
+    UpdateValuesSnapshot i_snapshot;                        // changed values serialized once for all other viewers
     WorldObjectChangeAccumulator(WorldObject& obj, UpdateDataMapType& d) : i_updateDatas(d), i_object(obj)
     {
         // send self fields changes in another way, otherwise
@@ -2049,7 +2154,7 @@ struct WorldObjectChangeAccumulator
         {
             Player* owner = iter.getSource()->GetOwner();
             if (owner != &i_object && owner->HaveAtClient(&i_object))
-                i_object.BuildUpdateDataForPlayer(owner, i_updateDatas);
+                i_object.BuildUpdateDataForPlayer(owner, i_updateDatas, &i_snapshot);
         }
     }
 
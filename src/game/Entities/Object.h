@@ -385,6 +385,7 @@ class Object
         void SendForcedObjectUpdate();
 
         void BuildValuesUpdateBlockForPlayer(UpdateData* data, Player* target) const;
+        void BuildValuesUpdateBlockForPlayer(UpdateData* data, Player* target, UpdateValuesSnapshot& snapshot) const;
         void BuildForcedValuesUpdateBlockForPlayer(UpdateData* data, Player* target) const;
         void BuildOutOfRangeUpdateBlock(UpdateData* data) const;
         void BuildMovementUpdateBlock(UpdateData* data, uint8 flags = 0) const;
@@ -595,7 +596,14 @@ class Object
 
         void BuildMovementUpdate(ByteBuffer* data, uint8 updateFlags) const;
         void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, UpdateMask* updateMask, Player* target) const;
-        void BuildUpdateDataForPlayer(Player* pl, UpdateDataMapType& update_players) const;
+        void BuildValuesUpdateSnapshot(UpdateValuesSnapshot& snapshot) const;
+        void BuildUpdateDataForPlayer(Player* pl, UpdateDataMapType& update_players, UpdateValuesSnapshot* snapshot = nullptr) const;
+
+        // value of an update field as sent to target, special cases are handled only for indexes returned by IsViewerDependentUpdateField
+        uint32 GetUnitUpdateFieldValue(uint16 index, Player* target) const;
+        uint32 GetGameObjectDynFlagsValue(bool activateToQuest) const;
+        bool IsViewerDependentUpdateField(uint16 index) const;
+        static bool IsFogOfWarStatField(uint16 index);
 
         uint16 m_objectType;
 
@@ -867,6 +875,9 @@ class WorldObject : public Object
     protected:
         explicit WorldObject();
 
+        // grid reference of the derived type, its packed cell position follows Relocate
+        void SetGridPackedSlot(GridPackedSlot* slot);
+
         // these functions are used mostly for Relocate() and Corpse/Player specific stuff...
         // use them ONLY in LoadFromDB()/Create() funcs and nowhere else!
         // mapId/instanceId should be set in SetMap() function!
@@ -892,6 +903,7 @@ class WorldObject : public Object
         uint32 m_InstanceId;                                // in map copy with instance id
 
         Position m_position;
+        GridPackedSlot* m_gridPackedSlot;
         ViewPoint m_viewPoint;
         bool m_isActiveObject;
 };
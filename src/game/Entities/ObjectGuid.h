@@ -22,6 +22,8 @@
 #include "Common.h"
 #include "ByteBuffer.h"
 
+#include <atomic>
+
 enum TypeID
 {
     TYPEID_OBJECT        = 0,
@@ -231,7 +233,7 @@ class ObjectGuidGenerator
         uint32 GetNextAfterMaxUsed() const { return m_nextGuid; }
 
     private:                                                // fields
-        uint32 m_nextGuid;
+        std::atomic<uint32> m_nextGuid;                     // maps generate guids concurrently
 };
 
 ByteBuffer& operator<< (ByteBuffer& buf, ObjectGuid const& guid);
@@ -151,6 +151,10 @@ void WorldSession::HandlePetitionBuyOpcode(WorldPacket& recv_data)
 
     DEBUG_LOG("Invalid petition GUIDs: %s", ssInvalidPetitionGUIDs.str().c_str());
     CharacterDatabase.escape_string(name);
+
+    // petition rows are written on the connection of the owner, in order with the saves of the charter item
+    SqlAsyncRoute dbRoute(CharacterDatabase, _player->GetGUIDLow());
+
     CharacterDatabase.BeginTransaction();
     CharacterDatabase.PExecute("DELETE FROM petition WHERE petitionguid IN ( %s )",  ssInvalidPetitionGUIDs.str().c_str());
     CharacterDatabase.PExecute("DELETE FROM petition_sign WHERE petitionguid IN ( %s )", ssInvalidPetitionGUIDs.str().c_str());
@@ -293,6 +297,7 @@ void WorldSession::HandlePetitionRenameOpcode(WorldPacket& recv_data)
 
     std::string db_newname = newname;
     CharacterDatabase.escape_string(db_newname);
+    SqlAsyncRoute dbRoute(CharacterDatabase, _player->GetGUIDLow());
     CharacterDatabase.PExecute("UPDATE petition SET name = '%s' WHERE petitionguid = '%u'",
                                db_newname.c_str(), petitionGuid.GetCounter());
 
@@ -380,6 +385,8 @@ void WorldSession::HandlePetitionSignOpcode(WorldPacket& recv_data)
         return;
     }
 
+    // joined with the signer, whose signs are deleted on its own connection when joining a guild or being deleted
+    SqlAsyncRoute dbRoute(CharacterDatabase, ownerLowGuid, _player->GetGUIDLow());
     CharacterDatabase.PExecute("INSERT INTO petition_sign (ownerguid,petitionguid, playerguid, player_account) VALUES ('%u', '%u', '%u','%u')",
                                ownerLowGuid, petitionLowGuid, _player->GetGUIDLow(), GetAccountId());
 
@@ -611,6 +618,7 @@ void WorldSession::HandleTurnInPetitionOpcode(WorldPacket& recv_data)
 
     delete result;
 
+    SqlAsyncRoute dbRoute(CharacterDatabase, _player->GetGUIDLow());
     CharacterDatabase.BeginTransaction();
     CharacterDatabase.PExecute("DELETE FROM petition WHERE petitionguid = '%u'", petitionGuid.GetCounter());
     CharacterDatabase.PExecute("DELETE FROM petition_sign WHERE petitionguid = '%u'", petitionGuid.GetCounter());
@@ -489,6 +489,8 @@ Player::Player(WorldSession* session): Unit(), m_taxiTracker(*this), m_mover(thi
 {
     m_transport = nullptr;
 
+    SetGridPackedSlot(&m_gridRef);
+
 #ifdef BUILD_PLAYERBOT
     m_playerbotAI = 0;
     m_playerbotMgr = 0;
@@ -536,6 +538,14 @@ Player::Player(WorldSession* session): Unit(), m_taxiTracker(*this), m_mover(thi
     // this must help in case next save after mass player load after server startup
     m_nextSave = urand(m_nextSave / 2, m_nextSave * 3 / 2);
 
+    m_savedToDB = false;
+    m_saveFailed = std::make_shared<std::atomic<bool>>(false);
+    m_lastSaveStatementCount = 0;
+    m_savedParagonLevel = 0;
+    m_savedParagonXP = 0;
+    m_savedAccountMoney = 0;
+    m_enteredInstancesChanged = true;
+
     clearResurrectRequestData();
 
     m_SpellModRemoveCount = 0;
@@ -3652,13 +3662,12 @@ void Player::_LoadSpellCooldowns(QueryResult* result)
 
 void Player::_SaveSpellCooldowns()
 {
+    static SqlStatementID deleteSpellCooldowns;
     static SqlStatementID deleteSpellCooldown;
-
-    // delete all old cooldown
-    SqlStatement stmt = CharacterDatabase.CreateStatement(deleteSpellCooldown, "DELETE FROM character_spell_cooldown WHERE guid = ?");
-    stmt.PExecute(GetGUIDLow());
-
     static SqlStatementID insertSpellCooldown;
+    static SqlStatementID updateSpellCooldown;
+
+    SavedCooldownMap cooldowns;
     TimePoint currTime = GetMap()->GetCurrentClockTime();
 
     for (auto& cdItr : m_cooldownMap)
@@ -3670,19 +3679,65 @@ void Player::_SaveSpellCooldowns()
             TimePoint cTime = currTime;
             cdData->GetSpellCDExpireTime(sTime);
             cdData->GetCatCDExpireTime(cTime);
-            uint64 spellExpireTime = uint64(Clock::to_time_t(sTime));
-            uint64 catExpireTime = uint64(Clock::to_time_t(cTime));
 
-            stmt = CharacterDatabase.CreateStatement(insertSpellCooldown, "INSERT INTO character_spell_cooldown (guid, SpellId, SpellExpireTime, Category, CategoryExpireTime, ItemId) VALUES( ?, ?, ?, ?, ?, ?)");
+            SavedCooldownData data;
+            data.spellExpireTime = uint64(Clock::to_time_t(sTime));
+            data.category = cdData->GetCategory();
+            data.catExpireTime = uint64(Clock::to_time_t(cTime));
+            data.itemId = cdData->GetItemId();
+            cooldowns.emplace(cdData->GetSpellId(), data);
+        }
+    }
+
+    // until the first save we do not know what is stored, rewrite everything
+    if (!m_savedToDB)
+    {
+        SqlStatement stmt = CharacterDatabase.CreateStatement(deleteSpellCooldowns, "DELETE FROM character_spell_cooldown WHERE guid = ?");
+        stmt.PExecute(GetGUIDLow());
+        m_savedCooldowns.clear();
+    }
+    else
+    {
+        for (const auto& saved : m_savedCooldowns)
+        {
+            if (cooldowns.find(saved.first) != cooldowns.end())
+                continue;
+
+            SqlStatement stmt = CharacterDatabase.CreateStatement(deleteSpellCooldown, "DELETE FROM character_spell_cooldown WHERE guid = ? AND SpellId = ?");
+            stmt.PExecute(GetGUIDLow(), saved.first);
+        }
+    }
+
+    for (const auto& cooldown : cooldowns)
+    {
+        SavedCooldownData const& data = cooldown.second;
+        SavedCooldownMap::const_iterator saved = m_savedCooldowns.find(cooldown.first);
+
+        if (saved == m_savedCooldowns.end())
+        {
+            SqlStatement stmt = CharacterDatabase.CreateStatement(insertSpellCooldown, "INSERT INTO character_spell_cooldown (guid, SpellId, SpellExpireTime, Category, CategoryExpireTime, ItemId) VALUES( ?, ?, ?, ?, ?, ?)");
+            stmt.addUInt32(GetGUIDLow());
+            stmt.addUInt32(cooldown.first);
+            stmt.addUInt64(data.spellExpireTime);
+            stmt.addUInt32(data.category);
+            stmt.addUInt64(data.catExpireTime);
+            stmt.addUInt32(data.itemId);
+            stmt.Execute();
+        }
+        else if (saved->second != data)
+        {
+            SqlStatement stmt = CharacterDatabase.CreateStatement(updateSpellCooldown, "UPDATE character_spell_cooldown SET SpellExpireTime = ?, Category = ?, CategoryExpireTime = ?, ItemId = ? WHERE guid = ? AND SpellId = ?");
+            stmt.addUInt64(data.spellExpireTime);
+            stmt.addUInt32(data.category);
+            stmt.addUInt64(data.catExpireTime);
+            stmt.addUInt32(data.itemId);
             stmt.addUInt32(GetGUIDLow());
-            stmt.addUInt32(cdData->GetSpellId());
-            stmt.addUInt64(spellExpireTime);
-            stmt.addUInt32(cdData->GetCategory());
-            stmt.addUInt64(catExpireTime);
-            stmt.addUInt32(cdData->GetItemId());
+            stmt.addUInt32(cooldown.first);
             stmt.Execute();
         }
     }
+
+    m_savedCooldowns.swap(cooldowns);
 }
 
 
@@ -4072,6 +4127,9 @@ void Player::DeleteFromDB(ObjectGuid playerguid, uint32 accountId, bool updateRe
 
     uint32 lowguid = playerguid.GetCounter();
 
+    // must not overtake a pending save of the character
+    SqlAsyncRoute dbRoute(CharacterDatabase, lowguid);
+
     // convert corpse to bones if exist (to prevent exiting Corpse in World without DB entry)
     // bones will be deleted by corpse/bones deleting thread shortly
     sObjectAccessor.ConvertCorpseForPlayer(playerguid);
@@ -15462,129 +15520,203 @@ void Player::SaveToDB()
     DEBUG_FILTER_LOG(LOG_FILTER_PLAYER_STATS, "The value of player %s at save: ", m_name.c_str());
     outDebugStatsValues();
 
+    // saves of different characters may commit in parallel (CharacterDatabaseAsyncConnections)
+    SqlAsyncRoute dbRoute(CharacterDatabase, GetGUIDLow());
+
+    // a rolled back save left the stored rows behind the saved state the diffs are made against
+    if (m_saveFailed->exchange(false))
+    {
+        sLog.outError("Player::SaveToDB: previous save of %s was rolled back, saving all data", GetGuidStr().c_str());
+        m_savedToDB = false;
+    }
+
     CharacterDatabase.BeginTransaction();
 
     UpdateHonor();
 
     static SqlStatementID delChar ;
     static SqlStatementID insChar ;
+    static SqlStatementID updChar ;
+
+    // the row is only recreated until the first save went through, later saves update it in place
+    if (m_savedToDB)
+    {
+        SqlStatement stmt = CharacterDatabase.CreateStatement(updChar, "UPDATE characters SET account = ?, name = ?, race = ?, class = ?, gender = ?, level = ?, xp = ?, money = ?, "
+                            "playerBytes = ?, playerBytes2 = ?, playerFlags = ?, "
+                            "map = ?, position_x = ?, position_y = ?, position_z = ?, orientation = ?, "
+                            "taximask = ?, online = ?, cinematic = ?, "
+                            "totaltime = ?, leveltime = ?, rest_bonus = ?, logout_time = ?, is_logout_resting = ?, resettalents_cost = ?, resettalents_time = ?, "
+                            "trans_x = ?, trans_y = ?, trans_z = ?, trans_o = ?, transguid = ?, extra_flags = ?, stable_slots = ?, at_login = ?, zone = ?, "
+                            "death_expire_time = ?, taxi_path = ?, "
+                            "honor_highest_rank = ?, honor_standing = ?, stored_honor_rating = ?, stored_dishonorable_kills = ?, stored_honorable_kills = ?, "
+                            "watchedFaction = ?, drunk = ?, health = ?, power1 = ?, power2 = ?, power3 = ?, "
+                            "power4 = ?, power5 = ?, exploredZones = ?, equipmentCache = ?, ammoId = ?, actionBars = ? "
+                            "WHERE guid = ?");
+        _AddCharacterSaveFields(stmt);
+        stmt.addUInt32(GetGUIDLow());
+        stmt.Execute();
+    }
+    else
+    {
+        SqlStatement stmt = CharacterDatabase.CreateStatement(delChar, "DELETE FROM characters WHERE guid = ?");
+        stmt.PExecute(GetGUIDLow());
+
+        SqlStatement uberInsert = CharacterDatabase.CreateStatement(insChar, "INSERT INTO characters (guid,account,name,race,class,gender,level,xp,money,playerBytes,playerBytes2,playerFlags,"
+                                  "map, position_x, position_y, position_z, orientation, "
+                                  "taximask, online, cinematic, "
+                                  "totaltime, leveltime, rest_bonus, logout_time, is_logout_resting, resettalents_cost, resettalents_time, "
+                                  "trans_x, trans_y, trans_z, trans_o, transguid, extra_flags, stable_slots, at_login, zone, "
+                                  "death_expire_time, taxi_path, "
+                                  "honor_highest_rank, honor_standing, stored_honor_rating , stored_dishonorable_kills, stored_honorable_kills, "
+                                  "watchedFaction, drunk, health, power1, power2, power3, "
+                                  "power4, power5, exploredZones, equipmentCache, ammoId, actionBars) "
+                                  "VALUES ( ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?,"
+                                  "?, ?, ?, ?, ?, "
+                                  "?, ?, ?, "
+                                  "?, ?, ?, ?, ?, ?, ?, "
+                                  "?, ?, ?, ?, ?, ?, ?, ?, ?, "
+                                  "?, ?, "
+                                  "?, ?, ?, ?, ?, "
+                                  "?, ?, ?, ?, ?, ?, "
+                                  "?, ?, ?, ?, ?, ?) ");
+
+        uberInsert.addUInt32(GetGUIDLow());
+        _AddCharacterSaveFields(uberInsert);
+        uberInsert.Execute();
+    }
 
-    SqlStatement stmt = CharacterDatabase.CreateStatement(delChar, "DELETE FROM characters WHERE guid = ?");
-    stmt.PExecute(GetGUIDLow());
+    if (m_mailsUpdated)                                     // save mails only when needed
+        _SaveMail();
+
+    _SaveBGData();
+    _SaveInventory();
+    _SaveQuestStatus();
+    _SaveSpells();
+    _SaveSpellCooldowns();
+    _SaveActions();
+    _SaveAuras();
+    _SaveSkills();
+	_SaveParagonInformation();
+	_SaveAccountMoney();
+
+    _SaveNewInstanceIdTimer();
+    m_reputationMgr.SaveToDB();
+    _SaveHonorCP();
+    GetSession()->SaveTutorialsData();                      // changed only while character in game
 
-    SqlStatement uberInsert = CharacterDatabase.CreateStatement(insChar, "INSERT INTO characters (guid,account,name,race,class,gender,level,xp,money,playerBytes,playerBytes2,playerFlags,"
-                              "map, position_x, position_y, position_z, orientation, "
-                              "taximask, online, cinematic, "
-                              "totaltime, leveltime, rest_bonus, logout_time, is_logout_resting, resettalents_cost, resettalents_time, "
-                              "trans_x, trans_y, trans_z, trans_o, transguid, extra_flags, stable_slots, at_login, zone, "
-                              "death_expire_time, taxi_path, "
-                              "honor_highest_rank, honor_standing, stored_honor_rating , stored_dishonorable_kills, stored_honorable_kills, "
-                              "watchedFaction, drunk, health, power1, power2, power3, "
-                              "power4, power5, exploredZones, equipmentCache, ammoId, actionBars) "
-                              "VALUES ( ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?,"
-                              "?, ?, ?, ?, ?, "
-                              "?, ?, ?, "
-                              "?, ?, ?, ?, ?, ?, ?, "
-                              "?, ?, ?, ?, ?, ?, ?, ?, ?, "
-                              "?, ?, "
-                              "?, ?, ?, ?, ?, "
-                              "?, ?, ?, ?, ?, ?, "
-                              "?, ?, ?, ?, ?, ?) ");
-
-    uberInsert.addUInt32(GetGUIDLow());
-    uberInsert.addUInt32(GetSession()->GetAccountId());
-    uberInsert.addString(m_name);
-    uberInsert.addUInt8(getRace());
-    uberInsert.addUInt8(getClass());
-    uberInsert.addUInt8(getGender());
-    uberInsert.addUInt32(getLevel());
-    uberInsert.addUInt32(GetUInt32Value(PLAYER_XP));
-    uberInsert.addUInt32(GetMoney());
-    uberInsert.addUInt32(GetUInt32Value(PLAYER_BYTES));
-    uberInsert.addUInt32(GetUInt32Value(PLAYER_BYTES_2));
-    uberInsert.addUInt32(GetUInt32Value(PLAYER_FLAGS));
+    m_lastSaveStatementCount = CharacterDatabase.GetTransactionSize();
+    DEBUG_FILTER_LOG(LOG_FILTER_PLAYER_STATS, "Player %s saved with %u statements", m_name.c_str(), m_lastSaveStatementCount);
+
+    // only queued here, a rollback sets m_saveFailed and the next save writes everything again
+    CharacterDatabase.CommitTransaction(m_saveFailed);
+    m_savedToDB = true;
+
+    // check if stats should only be saved on logout
+    // save stats can be out of transaction
+    if (m_session->isLogingOut() || !sWorld.getConfig(CONFIG_BOOL_STATS_SAVE_ONLY_ON_LOGOUT))
+        _SaveStats();
+
+    // save pet (hunter pet level and experience and all type pets health/mana).
+    if (Pet* pet = GetPet())
+        pet->SavePetToDB(PET_SAVE_AS_CURRENT, this);
+}
+
+// column values shared by the characters INSERT and UPDATE, in their column order after guid
+void Player::_AddCharacterSaveFields(SqlStatement& stmt)
+{
+    stmt.addUInt32(GetSession()->GetAccountId());
+    stmt.addString(m_name);
+    stmt.addUInt8(getRace());
+    stmt.addUInt8(getClass());
+    stmt.addUInt8(getGender());
+    stmt.addUInt32(getLevel());
+    stmt.addUInt32(GetUInt32Value(PLAYER_XP));
+    stmt.addUInt32(GetMoney());
+    stmt.addUInt32(GetUInt32Value(PLAYER_BYTES));
+    stmt.addUInt32(GetUInt32Value(PLAYER_BYTES_2));
+    stmt.addUInt32(GetUInt32Value(PLAYER_FLAGS));
 
     if (!IsBeingTeleported())
     {
-        uberInsert.addUInt32(GetMapId());
-        uberInsert.addFloat(finiteAlways(GetPositionX()));
-        uberInsert.addFloat(finiteAlways(GetPositionY()));
-        uberInsert.addFloat(finiteAlways(GetPositionZ()));
-        uberInsert.addFloat(finiteAlways(GetOrientation()));
+        stmt.addUInt32(GetMapId());
+        stmt.addFloat(finiteAlways(GetPositionX()));
+        stmt.addFloat(finiteAlways(GetPositionY()));
+        stmt.addFloat(finiteAlways(GetPositionZ()));
+        stmt.addFloat(finiteAlways(GetOrientation()));
     }
     else
     {
-        uberInsert.addUInt32(GetTeleportDest().mapid);
-        uberInsert.addFloat(finiteAlways(GetTeleportDest().coord_x));
-        uberInsert.addFloat(finiteAlways(GetTeleportDest().coord_y));
-        uberInsert.addFloat(finiteAlways(GetTeleportDest().coord_z));
-        uberInsert.addFloat(finiteAlways(GetTeleportDest().orientation));
+        stmt.addUInt32(GetTeleportDest().mapid);
+        stmt.addFloat(finiteAlways(GetTeleportDest().coord_x));
+        stmt.addFloat(finiteAlways(GetTeleportDest().coord_y));
+        stmt.addFloat(finiteAlways(GetTeleportDest().coord_z));
+        stmt.addFloat(finiteAlways(GetTeleportDest().orientation));
     }
 
     std::ostringstream ss;
     ss << m_taxi;                                   // string with TaxiMaskSize numbers
-    uberInsert.addString(ss);
+    stmt.addString(ss);
 
-    uberInsert.addUInt32(IsInWorld() ? 1 : 0);
+    stmt.addUInt32(IsInWorld() ? 1 : 0);
 
-    uberInsert.addUInt32(m_cinematic);
+    stmt.addUInt32(m_cinematic);
 
-    uberInsert.addUInt32(m_Played_time[PLAYED_TIME_TOTAL]);
-    uberInsert.addUInt32(m_Played_time[PLAYED_TIME_LEVEL]);
+    stmt.addUInt32(m_Played_time[PLAYED_TIME_TOTAL]);
+    stmt.addUInt32(m_Played_time[PLAYED_TIME_LEVEL]);
 
-    uberInsert.addFloat(finiteAlways(m_rest_bonus));
-    uberInsert.addUInt64(uint64(time(nullptr)));
-    uberInsert.addUInt32(HasFlag(PLAYER_FLAGS, PLAYER_FLAGS_RESTING) ? 1 : 0);
+    stmt.addFloat(finiteAlways(m_rest_bonus));
+    stmt.addUInt64(uint64(time(nullptr)));
+    stmt.addUInt32(HasFlag(PLAYER_FLAGS, PLAYER_FLAGS_RESTING) ? 1 : 0);
     // save, far from tavern/city
     // save, but in tavern/city
-    uberInsert.addUInt32(m_resetTalentsCost);
-    uberInsert.addUInt64(uint64(m_resetTalentsTime));
+    stmt.addUInt32(m_resetTalentsCost);
+    stmt.addUInt64(uint64(m_resetTalentsTime));
 
     Position const* transportPosition = m_movementInfo.GetTransportPos();
-    uberInsert.addFloat(finiteAlways(transportPosition->x));
-    uberInsert.addFloat(finiteAlways(transportPosition->y));
-    uberInsert.addFloat(finiteAlways(transportPosition->z));
-    uberInsert.addFloat(finiteAlways(transportPosition->o));
+    stmt.addFloat(finiteAlways(transportPosition->x));
+    stmt.addFloat(finiteAlways(transportPosition->y));
+    stmt.addFloat(finiteAlways(transportPosition->z));
+    stmt.addFloat(finiteAlways(transportPosition->o));
 
     if (m_transport)
-        uberInsert.addUInt32(m_transport->GetGUIDLow());
+        stmt.addUInt32(m_transport->GetGUIDLow());
     else
-        uberInsert.addUInt32(0);
+        stmt.addUInt32(0);
 
-    uberInsert.addUInt32(m_ExtraFlags);
+    stmt.addUInt32(m_ExtraFlags);
 
-    uberInsert.addUInt32(uint32(m_stableSlots));            // to prevent save uint8 as char
+    stmt.addUInt32(uint32(m_stableSlots));            // to prevent save uint8 as char
 
-    uberInsert.addUInt32(uint32(m_atLoginFlags));
+    stmt.addUInt32(uint32(m_atLoginFlags));
 
-    uberInsert.addUInt32(IsInWorld() ? GetZoneId() : GetCachedZoneId());
+    stmt.addUInt32(IsInWorld() ? GetZoneId() : GetCachedZoneId());
 
-    uberInsert.addUInt64(uint64(m_deathExpireTime));
+    stmt.addUInt64(uint64(m_deathExpireTime));
 
     ss << m_taxiTracker.Save();
-    uberInsert.addString(ss);
+    stmt.addString(ss);
 
-    uberInsert.addUInt32(uint32(m_highest_rank.rank));
-    uberInsert.addInt32(m_standing_pos);
-    uberInsert.addFloat(finiteAlways(m_stored_honor));
-    uberInsert.addUInt32(m_stored_dishonorableKills);
-    uberInsert.addUInt32(m_stored_honorableKills);
+    stmt.addUInt32(uint32(m_highest_rank.rank));
+    stmt.addInt32(m_standing_pos);
+    stmt.addFloat(finiteAlways(m_stored_honor));
+    stmt.addUInt32(m_stored_dishonorableKills);
+    stmt.addUInt32(m_stored_honorableKills);
 
     // FIXME: at this moment send to DB as unsigned, including unit32(-1)
-    uberInsert.addUInt32(GetUInt32Value(PLAYER_FIELD_WATCHED_FACTION_INDEX));
+    stmt.addUInt32(GetUInt32Value(PLAYER_FIELD_WATCHED_FACTION_INDEX));
 
-    uberInsert.addUInt16(uint16(GetUInt32Value(PLAYER_BYTES_3) & 0xFFFE));
+    stmt.addUInt16(uint16(GetUInt32Value(PLAYER_BYTES_3) & 0xFFFE));
 
-    uberInsert.addUInt32(GetHealth());
+    stmt.addUInt32(GetHealth());
 
     for (uint32 i = 0; i < MAX_POWERS; ++i)
-        uberInsert.addUInt32(GetPower(Powers(i)));
+        stmt.addUInt32(GetPower(Powers(i)));
 
     for (uint32 i = 0; i < PLAYER_EXPLORED_ZONES_SIZE; ++i) // string
     {
         ss << GetUInt32Value(PLAYER_EXPLORED_ZONES_1 + i) << " ";
     }
-    uberInsert.addString(ss);
+    stmt.addString(ss);
 
     for (uint32 i = 0; i < EQUIPMENT_SLOT_END; ++i)         // string: item id, ench (perm/temp)
     {
@@ -15594,43 +15726,11 @@ void Player::SaveToDB()
         uint32 ench2 = GetUInt32Value(PLAYER_VISIBLE_ITEM_1_0 + i * MAX_VISIBLE_ITEM_OFFSET + 1 + TEMP_ENCHANTMENT_SLOT);
         ss << uint32(MAKE_PAIR32(ench1, ench2)) << " ";
     }
-    uberInsert.addString(ss);
+    stmt.addString(ss);
 
-    uberInsert.addUInt32(GetUInt32Value(PLAYER_AMMO_ID));
-
-    uberInsert.addUInt32(uint32(GetByteValue(PLAYER_FIELD_BYTES, 2)));
-	
-    uberInsert.Execute();
+    stmt.addUInt32(GetUInt32Value(PLAYER_AMMO_ID));
 
-    if (m_mailsUpdated)                                     // save mails only when needed
-        _SaveMail();
-
-    _SaveBGData();
-    _SaveInventory();
-    _SaveQuestStatus();
-    _SaveSpells();
-    _SaveSpellCooldowns();
-    _SaveActions();
-    _SaveAuras();
-    _SaveSkills();
-	_SaveParagonInformation();
-	_SaveAccountMoney();
-
-    _SaveNewInstanceIdTimer();
-    m_reputationMgr.SaveToDB();
-    _SaveHonorCP();
-    GetSession()->SaveTutorialsData();                      // changed only while character in game
-
-    CharacterDatabase.CommitTransaction();
-
-    // check if stats should only be saved on logout
-    // save stats can be out of transaction
-    if (m_session->isLogingOut() || !sWorld.getConfig(CONFIG_BOOL_STATS_SAVE_ONLY_ON_LOGOUT))
-        _SaveStats();
-
-    // save pet (hunter pet level and experience and all type pets health/mana).
-    if (Pet* pet = GetPet())
-        pet->SavePetToDB(PET_SAVE_AS_CURRENT, this);
+    stmt.addUInt32(uint32(GetByteValue(PLAYER_FIELD_BYTES, 2)));
 }
 
 // fast save function for item/money cheating preventing - save only inventory and money state
@@ -15701,21 +15801,13 @@ void Player::_SaveActions()
 void Player::_SaveAuras()
 {
     static SqlStatementID deleteAuras ;
+    static SqlStatementID deleteAura ;
     static SqlStatementID insertAuras ;
+    static SqlStatementID updateAura ;
 
-    SqlStatement stmt = CharacterDatabase.CreateStatement(deleteAuras, "DELETE FROM character_aura WHERE guid = ?");
-    stmt.PExecute(GetGUIDLow());
-
-    SpellAuraHolderMap const& auraHolders = GetSpellAuraHolderMap();
-
-    if (auraHolders.empty())
-        return;
+    SavedAuraMap auras;
 
-    stmt = CharacterDatabase.CreateStatement(insertAuras, "INSERT INTO character_aura (guid, caster_guid, item_guid, spell, stackcount, remaincharges, "
-            "basepoints0, basepoints1, basepoints2, periodictime0, periodictime1, periodictime2, maxduration, remaintime, effIndexMask) "
-            "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
-
-    for (const auto& auraHolder : auraHolders)
+    for (const auto& auraHolder : GetSpellAuraHolderMap())
     {
         SpellAuraHolder* holder = auraHolder.second;
         // skip all holders from spells that are passive or channeled
@@ -15725,14 +15817,13 @@ void Player::_SaveAuras()
         if (!holder->IsPassive() && !IsChanneledSpell(holder->GetSpellProto()) &&
                 (trackedType == TRACK_AURA_TYPE_NOT_TRACKED || (trackedType == TRACK_AURA_TYPE_SINGLE_TARGET && selfCastHolder)))
         {
-            int32  damage[MAX_EFFECT_INDEX];
-            uint32 periodicTime[MAX_EFFECT_INDEX];
-            uint32 effIndexMask = 0;
+            SavedAuraData data;
+            data.effIndexMask = 0;
 
             for (uint32 i = 0; i < MAX_EFFECT_INDEX; ++i)
             {
-                damage[i] = 0;
-                periodicTime[i] = 0;
+                data.damage[i] = 0;
+                data.periodicTime[i] = 0;
 
                 if (Aura* aur = holder->GetAuraByEffectIndex(SpellEffectIndex(i)))
                 {
@@ -15740,34 +15831,100 @@ void Player::_SaveAuras()
                     if (aur->IsAreaAura() && holder->GetCasterGuid() != GetObjectGuid())
                         continue;
 
-                    damage[i] = aur->GetModifier()->m_amount;
-                    periodicTime[i] = aur->GetModifier()->periodictime;
-                    effIndexMask |= (1 << i);
+                    data.damage[i] = aur->GetModifier()->m_amount;
+                    data.periodicTime[i] = aur->GetModifier()->periodictime;
+                    data.effIndexMask |= (1 << i);
                 }
             }
 
-            if (!effIndexMask)
+            if (!data.effIndexMask)
                 continue;
 
+            data.stackCount = holder->GetStackAmount();
+            data.charges = holder->GetAuraCharges();
+            data.maxDuration = holder->GetAuraMaxDuration();
+            data.duration = holder->GetAuraDuration();
+
+            auras.emplace(SavedAuraKey(holder->GetCasterGuid().GetRawValue(), holder->GetCastItemGuid().GetCounter(), holder->GetId()), data);
+        }
+    }
+
+    // until the first save we do not know what is stored, rewrite everything
+    if (!m_savedToDB)
+    {
+        SqlStatement stmt = CharacterDatabase.CreateStatement(deleteAuras, "DELETE FROM character_aura WHERE guid = ?");
+        stmt.PExecute(GetGUIDLow());
+        m_savedAuras.clear();
+    }
+    else
+    {
+        for (const auto& saved : m_savedAuras)
+        {
+            if (auras.find(saved.first) != auras.end())
+                continue;
+
+            SqlStatement stmt = CharacterDatabase.CreateStatement(deleteAura, "DELETE FROM character_aura WHERE guid = ? AND caster_guid = ? AND item_guid = ? AND spell = ?");
+            stmt.PExecute(GetGUIDLow(), std::get<0>(saved.first), std::get<1>(saved.first), std::get<2>(saved.first));
+        }
+    }
+
+    for (const auto& aura : auras)
+    {
+        SavedAuraData const& data = aura.second;
+        SavedAuraMap::const_iterator saved = m_savedAuras.find(aura.first);
+
+        if (saved == m_savedAuras.end())
+        {
+            SqlStatement stmt = CharacterDatabase.CreateStatement(insertAuras, "INSERT INTO character_aura (guid, caster_guid, item_guid, spell, stackcount, remaincharges, "
+                                "basepoints0, basepoints1, basepoints2, periodictime0, periodictime1, periodictime2, maxduration, remaintime, effIndexMask) "
+                                "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
+
             stmt.addUInt32(GetGUIDLow());
-            stmt.addUInt64(holder->GetCasterGuid().GetRawValue());
-            stmt.addUInt32(holder->GetCastItemGuid().GetCounter());
-            stmt.addUInt32(holder->GetId());
-            stmt.addUInt32(holder->GetStackAmount());
-            stmt.addUInt8(holder->GetAuraCharges());
+            stmt.addUInt64(std::get<0>(aura.first));
+            stmt.addUInt32(std::get<1>(aura.first));
+            stmt.addUInt32(std::get<2>(aura.first));
+            stmt.addUInt32(data.stackCount);
+            stmt.addUInt8(uint8(data.charges));
 
-            for (int i : damage)
+            for (int32 i : data.damage)
                 stmt.addInt32(i);
 
-            for (unsigned int i : periodicTime)
+            for (uint32 i : data.periodicTime)
                 stmt.addUInt32(i);
 
-            stmt.addInt32(holder->GetAuraMaxDuration());
-            stmt.addInt32(holder->GetAuraDuration());
-            stmt.addUInt32(effIndexMask);
+            stmt.addInt32(data.maxDuration);
+            stmt.addInt32(data.duration);
+            stmt.addUInt32(data.effIndexMask);
+            stmt.Execute();
+        }
+        else if (saved->second != data)
+        {
+            SqlStatement stmt = CharacterDatabase.CreateStatement(updateAura, "UPDATE character_aura SET stackcount = ?, remaincharges = ?, "
+                                "basepoints0 = ?, basepoints1 = ?, basepoints2 = ?, periodictime0 = ?, periodictime1 = ?, periodictime2 = ?, "
+                                "maxduration = ?, remaintime = ?, effIndexMask = ? "
+                                "WHERE guid = ? AND caster_guid = ? AND item_guid = ? AND spell = ?");
+
+            stmt.addUInt32(data.stackCount);
+            stmt.addUInt8(uint8(data.charges));
+
+            for (int32 i : data.damage)
+                stmt.addInt32(i);
+
+            for (uint32 i : data.periodicTime)
+                stmt.addUInt32(i);
+
+            stmt.addInt32(data.maxDuration);
+            stmt.addInt32(data.duration);
+            stmt.addUInt32(data.effIndexMask);
+            stmt.addUInt32(GetGUIDLow());
+            stmt.addUInt64(std::get<0>(aura.first));
+            stmt.addUInt32(std::get<1>(aura.first));
+            stmt.addUInt32(std::get<2>(aura.first));
             stmt.Execute();
         }
     }
+
+    m_savedAuras.swap(auras);
 }
 
 void Player::_SaveInventory()
@@ -16098,6 +16255,9 @@ void Player::_SaveParagonInformation()
 	if (getLevel() < sWorld.getConfig(CONFIG_UINT32_PARAGON_LVL_REQUIREMENT))
 		return;
 
+	if (m_savedToDB && m_savedParagonLevel == GetParagonLevel() && m_savedParagonXP == GetParagonXP())
+		return;
+
 	static SqlStatementID delParagon;
 	static SqlStatementID insParagon;
 
@@ -16106,6 +16266,9 @@ void Player::_SaveParagonInformation()
 
 	stmtDel.PExecute(GetSession()->GetAccountId());
 	stmtIns.PExecute(GetSession()->GetAccountId(), GetParagonLevel(), GetParagonXP());
+
+	m_savedParagonLevel = GetParagonLevel();
+	m_savedParagonXP = GetParagonXP();
 }
 
 void Player::_SaveAccountMoney()
@@ -16113,6 +16276,9 @@ void Player::_SaveAccountMoney()
 	if (!sWorld.getConfig(CONFIG_BOOL_GOLD_ACCOUNT_WIDE))
 		return;
 
+	if (m_savedToDB && m_savedAccountMoney == GetMoney())
+		return;
+
 	static SqlStatementID delMoney;
 	static SqlStatementID insMoney;
 
@@ -16121,6 +16287,8 @@ void Player::_SaveAccountMoney()
 
 	stmtDel.PExecute(GetSession()->GetAccountId());
 	stmtIns.PExecute(GetSession()->GetAccountId(), GetMoney());
+
+	m_savedAccountMoney = GetMoney();
 }
 
 void Player::_SaveSpells()
@@ -16795,6 +16963,9 @@ void Player::RemovePetitionsAndSigns(ObjectGuid guid)
 {
     uint32 lowguid = guid.GetCounter();
 
+    // petitions are written on the connection of their owner, signs in order with the signer, see HandlePetitionSignOpcode
+    SqlAsyncRoute dbRoute(CharacterDatabase, lowguid);
+
     QueryResult* result = CharacterDatabase.PQuery("SELECT ownerguid,petitionguid FROM petition_sign WHERE playerguid = '%u'", lowguid);
     if (result)
     {
@@ -20096,7 +20267,10 @@ bool Player::CanEnterNewInstance(uint32 instanceId)
 void Player::AddNewInstanceId(uint32 instanceId)
 {
     if (m_enteredInstances.find(instanceId) == m_enteredInstances.end())
+    {
         m_enteredInstances.emplace(instanceId, std::chrono::time_point_cast<std::chrono::milliseconds>(Clock::now() + std::chrono::hours(1)));
+        m_enteredInstancesChanged = true;
+    }
 }
 
 void Player::_LoadParagonInformation()
@@ -20170,6 +20344,11 @@ void Player::_LoadCreatedInstanceTimers()
 
 void Player::_SaveNewInstanceIdTimer()
 {
+    if (m_savedToDB && !m_enteredInstancesChanged)
+        return;
+
+    m_enteredInstancesChanged = false;
+
     CharacterDatabase.PExecute("DELETE FROM account_instances_entered WHERE AccountId = '%u'", m_session->GetAccountId());
 
     if (m_enteredInstances.empty())
@@ -20194,7 +20373,10 @@ void Player::UpdateNewInstanceIdTimers(TimePoint const& now)
     for (auto iter = m_enteredInstances.begin(); iter != m_enteredInstances.end();)
     {
         if ((*iter).second < now)
+        {
             iter = m_enteredInstances.erase(iter);
+            m_enteredInstancesChanged = true;
+        }
         else
             ++iter;
     }
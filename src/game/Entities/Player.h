@@ -43,6 +43,7 @@
 #include "Cinematics/CinematicMgr.h"
 
 #include<vector>
+#include <tuple>
 
 struct Mail;
 class Channel;
@@ -1387,6 +1388,7 @@ class Player : public Unit
         void SaveToDB();
         void SaveInventoryAndGoldToDB();                    // fast save function for item/money cheating preventing
         void SaveGoldToDB() const;
+        uint32 GetLastSaveStatementCount() const { return m_lastSaveStatementCount; } // statements written by the last SaveToDB
         static void SetUInt32ValueInArray(Tokens& tokens, uint16 index, uint32 value);
         static void SavePositionInDB(ObjectGuid guid, uint32 mapid, float x, float y, float z, float o, uint32 zone);
 
@@ -2280,6 +2282,46 @@ class Player : public Unit
 		void _SaveParagonInformation();
 		void _SaveAccountMoney();
 
+        void _AddCharacterSaveFields(SqlStatement& stmt);
+
+        // last values written to character_aura, used to save only the rows that changed
+        struct SavedAuraData
+        {
+            uint32 stackCount;
+            uint32 charges;
+            int32  damage[MAX_EFFECT_INDEX];
+            uint32 periodicTime[MAX_EFFECT_INDEX];
+            int32  maxDuration;
+            int32  duration;
+            uint32 effIndexMask;
+
+            bool operator!=(SavedAuraData const& other) const
+            {
+                return stackCount != other.stackCount || charges != other.charges ||
+                       memcmp(damage, other.damage, sizeof(damage)) != 0 ||
+                       memcmp(periodicTime, other.periodicTime, sizeof(periodicTime)) != 0 ||
+                       maxDuration != other.maxDuration || duration != other.duration || effIndexMask != other.effIndexMask;
+            }
+        };
+        typedef std::tuple<uint64, uint32, uint32> SavedAuraKey;   // caster guid, item guid, spell
+        typedef std::map<SavedAuraKey, SavedAuraData> SavedAuraMap;
+
+        // last values written to character_spell_cooldown
+        struct SavedCooldownData
+        {
+            uint64 spellExpireTime;
+            uint32 category;
+            uint64 catExpireTime;
+            uint32 itemId;
+
+            bool operator!=(SavedCooldownData const& other) const
+            {
+                return spellExpireTime != other.spellExpireTime || category != other.category ||
+                       catExpireTime != other.catExpireTime || itemId != other.itemId;
+            }
+        };
+        typedef std::map<uint32, SavedCooldownData> SavedCooldownMap;
+
         void _SetCreateBits(UpdateMask* updateMask, Player* target) const override;
         void _SetUpdateBits(UpdateMask* updateMask, Player* target) const override;
 
@@ -2324,6 +2366,17 @@ class Player : public Unit
 
         Team m_team;
         uint32 m_nextSave;
+
+        // incremental save state, everything is rewritten until the first save went through
+        bool m_savedToDB;
+        std::shared_ptr<std::atomic<bool>> m_saveFailed;    // set by the database thread when a save is rolled back
+        uint32 m_lastSaveStatementCount;
+        SavedAuraMap m_savedAuras;
+        SavedCooldownMap m_savedCooldowns;
+        uint32 m_savedParagonLevel;
+        uint32 m_savedParagonXP;
+        uint32 m_savedAccountMoney;
+        bool m_enteredInstancesChanged;
         time_t m_speakTime;
         uint32 m_speakCount;
         uint32 m_atLoginFlags;
@@ -295,6 +295,8 @@ Unit::Unit() :
     m_combatData(new CombatData(this)),
     m_spellUpdateHappening(false),
     m_spellProcsHappening(false),
+    m_procHoldersFlags(0),
+    m_procHoldersGeneration(sSpellMgr.GetSpellProcEventGeneration()),
     m_auraUpdateMask(0)
 {
     m_objectType |= TYPEMASK_UNIT;
@@ -679,18 +681,18 @@ bool Unit::CanReachWithMeleeAttack(Unit const* pVictim, float flat_mod /*= 0.0f*
 
 void Unit::RemoveSpellsCausingAura(AuraType auraType)
 {
-    for (AuraList::const_iterator iter = m_modAuras[auraType].begin(); iter != m_modAuras[auraType].end();)
+    for (AuraList::const_iterator iter = GetAurasByType(auraType).begin(); iter != GetAurasByType(auraType).end();)
     {
         Aura* aura = (*iter);
         SpellAuraHolder* holder = aura->GetHolder();
         RemoveSpellAuraHolder(holder);
-        iter = m_modAuras[auraType].begin();
+        iter = GetAurasByType(auraType).begin();
     }
 }
 
 void Unit::RemoveSpellsCausingAura(AuraType auraType, SpellAuraHolder* except)
 {
-    for (AuraList::const_iterator iter = m_modAuras[auraType].begin(); iter != m_modAuras[auraType].end();)
+    for (AuraList::const_iterator iter = GetAurasByType(auraType).begin(); iter != GetAurasByType(auraType).end();)
     {
         // skip `except` aura
         if ((*iter)->GetHolder() == except)
@@ -700,13 +702,13 @@ void Unit::RemoveSpellsCausingAura(AuraType auraType, SpellAuraHolder* except)
         }
 
         RemoveAurasDueToSpell((*iter)->GetId(), except);
-        iter = m_modAuras[auraType].begin();
+        iter = GetAurasByType(auraType).begin();
     }
 }
 
 void Unit::RemoveSpellsCausingAura(AuraType auraType, SpellAuraHolder* except, bool onlyNegative)
 {
-    for (AuraList::const_iterator iter = m_modAuras[auraType].begin(); iter != m_modAuras[auraType].end();)
+    for (AuraList::const_iterator iter = GetAurasByType(auraType).begin(); iter != GetAurasByType(auraType).end();)
     {
         if ((*iter)->GetHolder() == except || (onlyNegative && (*iter)->GetHolder()->IsPositive()))
         {
@@ -715,18 +717,18 @@ void Unit::RemoveSpellsCausingAura(AuraType auraType, SpellAuraHolder* except, b
         }
 
         RemoveAurasDueToSpell((*iter)->GetId(), except);
-        iter = m_modAuras[auraType].begin();
+        iter = GetAurasByType(auraType).begin();
     }
 }
 
 void Unit::RemoveSpellsCausingAura(AuraType auraType, ObjectGuid casterGuid)
 {
-    for (AuraList::const_iterator iter = m_modAuras[auraType].begin(); iter != m_modAuras[auraType].end();)
+    for (AuraList::const_iterator iter = GetAurasByType(auraType).begin(); iter != GetAurasByType(auraType).end();)
     {
         if ((*iter)->GetCasterGuid() == casterGuid)
         {
             RemoveAuraHolderFromStack((*iter)->GetId(), 1, casterGuid);
-            iter = m_modAuras[auraType].begin();
+            iter = GetAurasByType(auraType).begin();
         }
         else
             ++iter;
@@ -2125,6 +2127,7 @@ void Unit::CalculateDamageAbsorbAndResist(Unit* pCaster, SpellSchoolMask schoolM
         mod->m_amount -= currentAbsorb;
         if ((*i)->GetHolder()->DropAuraCharge())
             mod->m_amount = 0;
+        m_modAuras.InvalidateTotals(mod->m_auraname);
         // Need remove it later
         if (mod->m_amount <= 0)
             existExpired = true;
@@ -2175,6 +2178,7 @@ void Unit::CalculateDamageAbsorbAndResist(Unit* pCaster, SpellSchoolMask schoolM
         }
 
         (*i)->GetModifier()->m_amount -= currentAbsorb;
+        m_modAuras.InvalidateTotals(SPELL_AURA_MANA_SHIELD);
         if ((*i)->GetModifier()->m_amount <= 0)
         {
             RemoveAurasDueToSpell((*i)->GetId());
@@ -2187,10 +2191,13 @@ void Unit::CalculateDamageAbsorbAndResist(Unit* pCaster, SpellSchoolMask schoolM
     // only split damage if not damaging yourself
     if (pCaster != this)
     {
+        // dealing the split damage can remove auras of the lists and shift the others, walk copies and skip removed auras
         AuraList const& vSplitDamageFlat = GetAurasByType(SPELL_AURA_SPLIT_DAMAGE_FLAT);
-        for (AuraList::const_iterator i = vSplitDamageFlat.begin(), next; i != vSplitDamageFlat.end() && RemainingDamage >= 0; i = next)
+        std::vector<Aura*> splitDamageFlat(vSplitDamageFlat.begin(), vSplitDamageFlat.end());
+        for (std::vector<Aura*>::const_iterator i = splitDamageFlat.begin(); i != splitDamageFlat.end() && RemainingDamage >= 0; ++i)
         {
-            next = i; ++next;
+            if (std::find(vSplitDamageFlat.begin(), vSplitDamageFlat.end(), *i) == vSplitDamageFlat.end())
+                continue;
 
             // check damage school mask
             if (((*i)->GetModifier()->m_miscvalue & schoolMask) == 0)
@@ -2226,9 +2233,11 @@ void Unit::CalculateDamageAbsorbAndResist(Unit* pCaster, SpellSchoolMask schoolM
         }
 
         AuraList const& vSplitDamagePct = GetAurasByType(SPELL_AURA_SPLIT_DAMAGE_PCT);
-        for (AuraList::const_iterator i = vSplitDamagePct.begin(), next; i != vSplitDamagePct.end() && RemainingDamage >= 0; i = next)
+        std::vector<Aura*> splitDamagePct(vSplitDamagePct.begin(), vSplitDamagePct.end());
+        for (std::vector<Aura*>::const_iterator i = splitDamagePct.begin(); i != splitDamagePct.end() && RemainingDamage >= 0; ++i)
         {
-            next = i; ++next;
+            if (std::find(vSplitDamagePct.begin(), vSplitDamagePct.end(), *i) == vSplitDamagePct.end())
+                continue;
 
             // check damage school mask
             if (((*i)->GetModifier()->m_miscvalue & schoolMask) == 0)
@@ -4036,50 +4045,52 @@ void Unit::DeMorph()
     SetDisplayId(GetNativeDisplayId());
 }
 
-int32 Unit::GetTotalAuraModifier(AuraType auratype) const
+Unit::AuraList::Totals const& Unit::GetAuraTotals(AuraType auratype) const
 {
-    int32 modifier = 0;
-
     AuraList const& mTotalAuraList = GetAurasByType(auratype);
+    if (mTotalAuraList.HasTotals())
+        return mTotalAuraList.GetTotals();
+
+    AuraList::Totals totals;
+    totals.total = 0;
+    totals.multiplier = 1.0f;
+    totals.maxPositive = 0;
+    totals.maxNegative = 0;
+
     for (auto i : mTotalAuraList)
-        modifier += i->GetModifier()->m_amount;
+    {
+        int32 amount = i->GetModifier()->m_amount;
 
-    return modifier;
+        totals.total += amount;
+        totals.multiplier *= (100.0f + amount) / 100.0f;
+        if (amount > totals.maxPositive)
+            totals.maxPositive = amount;
+        if (amount < totals.maxNegative)
+            totals.maxNegative = amount;
+    }
+
+    mTotalAuraList.SetTotals(totals);
+    return mTotalAuraList.GetTotals();
 }
 
-float Unit::GetTotalAuraMultiplier(AuraType auratype) const
+int32 Unit::GetTotalAuraModifier(AuraType auratype) const
 {
-    float multiplier = 1.0f;
-
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (auto i : mTotalAuraList)
-        multiplier *= (100.0f + i->GetModifier()->m_amount) / 100.0f;
+    return GetAuraTotals(auratype).total;
+}
 
-    return multiplier;
+float Unit::GetTotalAuraMultiplier(AuraType auratype) const
+{
+    return GetAuraTotals(auratype).multiplier;
 }
 
 int32 Unit::GetMaxPositiveAuraModifier(AuraType auratype) const
 {
-    int32 modifier = 0;
-
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (auto i : mTotalAuraList)
-        if (i->GetModifier()->m_amount > modifier)
-            modifier = i->GetModifier()->m_amount;
-
-    return modifier;
+    return GetAuraTotals(auratype).maxPositive;
 }
 
 int32 Unit::GetMaxNegativeAuraModifier(AuraType auratype) const
 {
-    int32 modifier = 0;
-
-    AuraList const& mTotalAuraList = GetAurasByType(auratype);
-    for (auto i : mTotalAuraList)
-        if (i->GetModifier()->m_amount < modifier)
-            modifier = i->GetModifier()->m_amount;
-
-    return modifier;
+    return GetAuraTotals(auratype).maxNegative;
 }
 
 int32 Unit::GetTotalAuraModifierByMiscMask(AuraType auratype, uint32 misc_mask) const
@@ -4347,6 +4358,7 @@ bool Unit::AddSpellAuraHolder(SpellAuraHolder* holder)
     if (m_spellUpdateHappening)
         holder->SetCreationDelayFlag();
     m_spellAuraHolders.insert(SpellAuraHolderMap::value_type(holder->GetId(), holder));
+    AddProcHolder(holder);
 
     for (int32 i = 0; i < MAX_EFFECT_INDEX; ++i)
         if (Aura* aur = holder->GetAuraByEffectIndex(SpellEffectIndex(i)))
@@ -4867,6 +4879,7 @@ void Unit::RemoveSpellAuraHolder(SpellAuraHolder* holder, AuraRemoveMode mode)
         if (itr->second == holder)
         {
             m_spellAuraHolders.erase(itr);
+            RemoveProcHolder(holder);
             break;
         }
     }
@@ -7734,10 +7747,11 @@ void Unit::UpdateVisibilityAndView()
     static const AuraType auratypes[] = {SPELL_AURA_BIND_SIGHT, SPELL_AURA_FAR_SIGHT, SPELL_AURA_NONE};
     for (AuraType const* type = &auratypes[0]; *type != SPELL_AURA_NONE; ++type)
     {
-        AuraList& alist = m_modAuras[*type];
-        if (alist.empty())
+        if (GetAurasByType(*type).empty())
             continue;
 
+        AuraList& alist = m_modAuras[*type];
+
         for (AuraList::iterator it = alist.begin(); it != alist.end();)
         {
             Aura* aura = (*it);
@@ -10249,7 +10263,7 @@ void Unit::CleanupDeletedAuras()
     m_deletedHolders.clear();
 
     // really delete auras "deleted" while processing its ApplyModify code
-    for (AuraList::const_iterator itr = m_deletedAuras.begin(); itr != m_deletedAuras.end(); ++itr)
+    for (std::vector<Aura*>::const_iterator itr = m_deletedAuras.begin(); itr != m_deletedAuras.end(); ++itr)
         delete *itr;
     m_deletedAuras.clear();
 }
@@ -11040,8 +11054,10 @@ void Unit::InterruptSpellsCastedOnMe(bool killDelayed)
         if (!killDelayed)
             continue;
         // 2/ Interrupt spells that are not referenced but that still have an event (like delayed spell)
-        for (auto i_events = target->m_events.GetEvents().begin(); i_events != target->m_events.GetEvents().end(); ++i_events)
-            if (SpellEvent* event = dynamic_cast<SpellEvent*>(i_events->second))
+        std::vector<BasicEvent*> events;
+        target->m_events.GetEvents(events);
+        for (BasicEvent* basicEvent : events)
+            if (SpellEvent* event = dynamic_cast<SpellEvent*>(basicEvent))
                 if (event && event->GetSpell()->m_targets.getUnitTargetGuid() == GetObjectGuid())
                     if (event->GetSpell()->getState() != SPELL_STATE_FINISHED)
                         event->GetSpell()->cancel();
@@ -31,6 +31,7 @@
 #include "Entities/Object.h"
 #include "Server/Opcodes.h"
 #include "Spells/SpellAuraDefines.h"
+#include "Spells/AuraIndex.h"
 #include "AI/BaseAI/CreatureAI.h"
 #include "Globals/SharedDefines.h"
 #include "Combat/ThreatManager.h"
@@ -1157,7 +1158,7 @@ class Unit : public WorldObject
         typedef std::pair<SpellAuraHolderMap::iterator, SpellAuraHolderMap::iterator> SpellAuraHolderBounds;
         typedef std::pair<SpellAuraHolderMap::const_iterator, SpellAuraHolderMap::const_iterator> SpellAuraHolderConstBounds;
         typedef std::list<SpellAuraHolder*> SpellAuraHolderList;
-        typedef std::list<Aura*> AuraList;
+        typedef ModAuraList AuraList;
         typedef std::list<DiminishingReturn> Diminishing;
         typedef std::set<uint32 /*playerGuidLow*/> ComboPointHolderSet;
         typedef std::map<SpellEntry const*, ObjectGuid /*targetGuid*/> TrackedAuraTargetMap;
@@ -2108,6 +2109,7 @@ class Unit : public WorldObject
         float GetTotalAuraMultiplier(AuraType auratype) const;
         int32 GetMaxPositiveAuraModifier(AuraType auratype) const;
         int32 GetMaxNegativeAuraModifier(AuraType auratype) const;
+        void InvalidateAuraTotals(AuraType auratype) { m_modAuras.InvalidateTotals(auratype); }
 
         int32 GetTotalAuraModifierByMiscMask(AuraType auratype, uint32 misc_mask) const;
         float GetTotalAuraMultiplierByMiscMask(AuraType auratype, uint32 misc_mask) const;
@@ -2397,7 +2399,7 @@ class Unit : public WorldObject
 
         SpellAuraHolderMap m_spellAuraHolders;
         SpellAuraHolderMap::iterator m_spellAuraHoldersUpdateIterator; // != end() in Unit::m_spellAuraHolders update and point to next element
-        AuraList m_deletedAuras;                            // auras removed while in ApplyModifier and waiting deleted
+        std::vector<Aura*> m_deletedAuras;                  // auras removed while in ApplyModifier and waiting deleted
         SpellAuraHolderList m_deletedHolders;
 
         // Store Auras for which the target must be tracked
@@ -2411,7 +2413,7 @@ class Unit : public WorldObject
         bool m_isSorted;
         uint32 m_transform;
 
-        AuraList m_modAuras[TOTAL_AURAS];
+        ModAuraIndex m_modAuras;
         float m_auraModifiersGroup[UNIT_MOD_END][MODIFIER_TYPE_END];
 
         WeaponDamageInfo m_weaponDamageInfo;
@@ -2483,6 +2485,10 @@ class Unit : public WorldObject
     private:
         void CleanupDeletedAuras();
         void UpdateSplineMovement(uint32 t_diff);
+        AuraList::Totals const& GetAuraTotals(AuraType auratype) const;
+        void AddProcHolder(SpellAuraHolder* holder);
+        void RemoveProcHolder(SpellAuraHolder* holder);
+        void RebuildProcHolders();
 
         Unit* _GetTotem(TotemSlot slot) const;              // for templated function without include need
         Pet* _GetPet(ObjectGuid guid) const;                // for templated function without include need
@@ -2525,6 +2531,16 @@ class Unit : public WorldObject
         bool m_spellProcsHappening;
         std::vector<SpellAuraHolder*> m_delayedSpellAuraHolders;
 
+        // holders of spells with proc flags, in m_spellAuraHolders order; flags are taken at holder add
+        struct ProcHolderEntry
+        {
+            SpellAuraHolder* holder;
+            uint32 procFlags;
+        };
+        std::vector<ProcHolderEntry> m_procHolders;
+        uint32 m_procHoldersFlags;                          // all flags in m_procHolders, events without any of them skip the list
+        uint32 m_procHoldersGeneration;                     // spell_proc_event generation the flags were taken from
+
         // guard to prevent chaining extra attacks
         bool m_extraAttacksExecuting;
 
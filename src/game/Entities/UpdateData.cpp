@@ -41,35 +41,90 @@ void UpdateData::AddOutOfRangeGUID(ObjectGuid const& guid)
     m_outOfRangeGUIDs.insert(guid);
 }
 
-void UpdateData::AddUpdateBlock(const ByteBuffer& block)
+size_t UpdateData::AddUpdateBlock(const ByteBuffer& block)
 {
+    size_t pos = m_data.wpos();
     m_data.append(block);
     ++m_blockCount;
+    return pos;
 }
 
-void UpdateData::Compress(void* dst, uint32* dst_size, void* src, int src_size)
+namespace
 {
-    z_stream c_stream;
-
-    c_stream.zalloc = (alloc_func)nullptr;
-    c_stream.zfree = (free_func)nullptr;
-    c_stream.opaque = (voidpf)nullptr;
+    // deflate state is allocated once per thread and only reset between packets
+    class ThreadDeflateStream
+    {
+        public:
+            ThreadDeflateStream() : m_initialized(false), m_level(0) {}
+            ~ThreadDeflateStream()
+            {
+                if (m_initialized)
+                    deflateEnd(&m_stream);
+            }
+
+            z_stream* Acquire(int level)
+            {
+                if (!m_initialized)
+                {
+                    m_stream.zalloc = (alloc_func)nullptr;
+                    m_stream.zfree = (free_func)nullptr;
+                    m_stream.opaque = (voidpf)nullptr;
+
+                    int z_res = deflateInit(&m_stream, level);
+                    if (z_res != Z_OK)
+                    {
+                        sLog.outError("Can't compress update packet (zlib: deflateInit) Error code: %i (%s)", z_res, zError(z_res));
+                        return nullptr;
+                    }
+
+                    m_initialized = true;
+                    m_level = level;
+                    return &m_stream;
+                }
+
+                int z_res = deflateReset(&m_stream);
+                if (z_res == Z_OK && level != m_level)
+                {
+                    z_res = deflateParams(&m_stream, level, Z_DEFAULT_STRATEGY);
+                    m_level = level;
+                }
+
+                if (z_res != Z_OK)
+                {
+                    sLog.outError("Can't compress update packet (zlib: deflateReset) Error code: %i (%s)", z_res, zError(z_res));
+                    deflateEnd(&m_stream);
+                    m_initialized = false;
+                    return nullptr;
+                }
+
+                return &m_stream;
+            }
+
+        private:
+            z_stream m_stream;
+            bool m_initialized;
+            int m_level;
+    };
+
+    thread_local ThreadDeflateStream t_deflateStream;
+}
 
+void UpdateData::Compress(void* dst, uint32* dst_size, void* src, int src_size)
+{
     // default Z_BEST_SPEED (1)
-    int z_res = deflateInit(&c_stream, sWorld.getConfig(CONFIG_UINT32_COMPRESSION));
-    if (z_res != Z_OK)
+    z_stream* c_stream = t_deflateStream.Acquire(sWorld.getConfig(CONFIG_UINT32_COMPRESSION));
+    if (!c_stream)
     {
-        sLog.outError("Can't compress update packet (zlib: deflateInit) Error code: %i (%s)", z_res, zError(z_res));
         *dst_size = 0;
         return;
     }
 
-    c_stream.next_out = (Bytef*)dst;
-    c_stream.avail_out = *dst_size;
-    c_stream.next_in = (Bytef*)src;
-    c_stream.avail_in = (uInt)src_size;
+    c_stream->next_out = (Bytef*)dst;
+    c_stream->avail_out = *dst_size;
+    c_stream->next_in = (Bytef*)src;
+    c_stream->avail_in = (uInt)src_size;
 
-    z_res = deflate(&c_stream, Z_NO_FLUSH);
+    int z_res = deflate(c_stream, Z_NO_FLUSH);
     if (z_res != Z_OK)
     {
         sLog.outError("Can't compress update packet (zlib: deflate) Error code: %i (%s)", z_res, zError(z_res));
@@ -77,14 +132,14 @@ void UpdateData::Compress(void* dst, uint32* dst_size, void* src, int src_size)
         return;
     }
 
-    if (c_stream.avail_in != 0)
+    if (c_stream->avail_in != 0)
     {
         sLog.outError("Can't compress update packet (zlib: deflate not greedy)");
         *dst_size = 0;
         return;
     }
 
-    z_res = deflate(&c_stream, Z_FINISH);
+    z_res = deflate(c_stream, Z_FINISH);
     if (z_res != Z_STREAM_END)
     {
         sLog.outError("Can't compress update packet (zlib: deflate should report Z_STREAM_END instead %i (%s)", z_res, zError(z_res));
@@ -92,15 +147,34 @@ void UpdateData::Compress(void* dst, uint32* dst_size, void* src, int src_size)
         return;
     }
 
-    z_res = deflateEnd(&c_stream);
-    if (z_res != Z_OK)
-    {
-        sLog.outError("Can't compress update packet (zlib: deflateEnd) Error code: %i (%s)", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
+    *dst_size = c_stream->total_out;
+}
+
+bool UpdateData::BuildCompressedPacket(WorldPacket& packet, uint8 const* data, size_t size)
+{
+    uint32 destsize = compressBound(size);
+    packet.resize(destsize + sizeof(uint32));
 
-    *dst_size = c_stream.total_out;
+    packet.put<uint32>(0, size);
+    Compress(const_cast<uint8*>(packet.contents()) + sizeof(uint32), &destsize, (void*)data, size);
+    if (destsize == 0)
+        return false;
+
+    packet.resize(destsize + sizeof(uint32));
+    packet.SetOpcode(SMSG_COMPRESSED_UPDATE_OBJECT);
+    return true;
+}
+
+bool UpdateData::IsCompressible(uint16 opcode, size_t size)
+{
+    return opcode == SMSG_UPDATE_OBJECT && size > 100;
+}
+
+bool UpdateData::CompressPacket(uint8 const* data, size_t size, WorldPacket& compressed)
+{
+    MANGOS_ASSERT(compressed.empty());
+
+    return BuildCompressedPacket(compressed, data, size);
 }
 
 bool UpdateData::BuildPacket(WorldPacket& packet, bool hasTransport)
@@ -125,24 +199,13 @@ bool UpdateData::BuildPacket(WorldPacket& packet, bool hasTransport)
 
     size_t pSize = buf.wpos();                              // use real used data size
 
-    if (pSize > 100)                                        // compress large packets
-    {
-        uint32 destsize = compressBound(pSize);
-        packet.resize(destsize + sizeof(uint32));
-
-        packet.put<uint32>(0, pSize);
-        Compress(const_cast<uint8*>(packet.contents()) + sizeof(uint32), &destsize, (void*)buf.contents(), pSize);
-        if (destsize == 0)
-            return false;
+    // compress large packets, unless it is left to the network threads
+    if (pSize > 100 && !sWorld.getConfig(CONFIG_BOOL_COMPRESSION_OFFLOAD))
+        return BuildCompressedPacket(packet, buf.contents(), pSize);
 
-        packet.resize(destsize + sizeof(uint32));
-        packet.SetOpcode(SMSG_COMPRESSED_UPDATE_OBJECT);
-    }
-    else                                                    // send small packets without compression
-    {
-        packet.append(buf);
-        packet.SetOpcode(SMSG_UPDATE_OBJECT);
-    }
+    // send small packets without compression
+    packet.append(buf);
+    packet.SetOpcode(SMSG_UPDATE_OBJECT);
 
     return true;
 }
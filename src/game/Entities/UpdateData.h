@@ -47,6 +47,17 @@ enum ObjectUpdateFlags
     UPDATEFLAG_HAS_POSITION = 0x0040
 };
 
+// Values update block of an object built once per tick and shared by all its viewers
+// fields depending on the viewer are written as placeholders and patched for each of them
+struct UpdateValuesSnapshot
+{
+    UpdateValuesSnapshot() : built(false) {}
+
+    bool built;
+    ByteBuffer block;
+    std::vector<std::pair<uint32, uint16> > patches;        // (offset in block, field index)
+};
+
 class UpdateData
 {
     public:
@@ -54,8 +65,12 @@ class UpdateData
 
         void AddOutOfRangeGUID(GuidSet& guids);
         void AddOutOfRangeGUID(ObjectGuid const& guid);
-        void AddUpdateBlock(const ByteBuffer& block);
+        size_t AddUpdateBlock(const ByteBuffer& block);     // returns position of the block, for PatchUpdateBlock
+        void PatchUpdateBlock(size_t pos, uint32 value) { m_data.put<uint32>(pos, value); }
         bool BuildPacket(WorldPacket& packet, bool hasTransport = false);
+        // compress a large SMSG_UPDATE_OBJECT left uncompressed by BuildPacket (Compression.Offload), used by network threads
+        static bool CompressPacket(uint8 const* data, size_t size, WorldPacket& compressed);
+        static bool IsCompressible(uint16 opcode, size_t size);
         bool HasData() const { return m_blockCount > 0 || !m_outOfRangeGUIDs.empty(); }
         void Clear();
 
@@ -66,6 +81,7 @@ class UpdateData
         GuidSet m_outOfRangeGUIDs;
         ByteBuffer m_data;
 
+        static bool BuildCompressedPacket(WorldPacket& packet, uint8 const* data, size_t size);
         static void Compress(void* dst, uint32* dst_size, void* src, int src_size);
 };
 #endif
@@ -63,7 +63,7 @@ typename HashMapHolder<T>::MapType& HashMapHolder<T>::GetContainer() { return m_
 template<class T>
 typename HashMapHolder<T>::LockType& HashMapHolder<T>::GetLock() { return i_lock; }
 
-ObjectAccessor::ObjectAccessor() {}
+ObjectAccessor::ObjectAccessor() : i_playerIndexes(new PlayerIndexes) {}
 ObjectAccessor::~ObjectAccessor()
 {
     for (Player2CorpsesMapType::const_iterator itr = i_player2corpse.begin(); itr != i_player2corpse.end(); ++itr)
@@ -113,15 +113,76 @@ Player* ObjectAccessor::FindPlayer(ObjectGuid guid, bool inWorld /*= true*/)
 
 Player* ObjectAccessor::FindPlayerByName(const char* name)
 {
-    HashMapHolder<Player>::ReadGuard g(HashMapHolder<Player>::GetLock());
-    HashMapHolder<Player>::MapType& m = sObjectAccessor.GetPlayers();
-    for (HashMapHolder<Player>::MapType::iterator iter = m.begin(); iter != m.end(); ++iter)
-        if (iter->second->IsInWorld() && (::strcmp(name, iter->second->GetName()) == 0))
-            return iter->second;
+    std::shared_ptr<PlayerIndexes const> indexes = sObjectAccessor.GetPlayerIndexes();
+
+    auto itr = indexes->byName.find(GetNameIndexKey(name));
+    if (itr == indexes->byName.end() || !itr->second->IsInWorld())
+        return nullptr;
+
+    return itr->second;
+}
+
+Player* ObjectAccessor::FindPlayerByAccount(uint32 accountId)
+{
+    std::shared_ptr<PlayerIndexes const> indexes = sObjectAccessor.GetPlayerIndexes();
+
+    auto bounds = indexes->byAccount.equal_range(accountId);
+    for (auto itr = bounds.first; itr != bounds.second; ++itr)
+        if (itr->second->IsInWorld())
+            return itr->second;
 
     return nullptr;
 }
 
+std::string ObjectAccessor::GetNameIndexKey(const char* name)
+{
+    std::string key = name;
+
+    std::wstring wname;
+    if (Utf8toWStr(key, wname))
+    {
+        wstrToLower(wname);
+        WStrToUtf8(wname, key);
+    }
+
+    return key;
+}
+
+void ObjectAccessor::AddObject(Player* object)
+{
+    HashMapHolder<Player>::Insert(object);
+
+    Guard guard(i_playerGuard);
+    std::shared_ptr<PlayerIndexes> indexes(new PlayerIndexes(*i_playerIndexes));
+    indexes->byName[GetNameIndexKey(object->GetName())] = object;
+    indexes->byAccount.insert(std::make_pair(object->GetSession()->GetAccountId(), object));
+    std::atomic_store(&i_playerIndexes, std::shared_ptr<PlayerIndexes const>(indexes));
+}
+
+void ObjectAccessor::RemoveObject(Player* object)
+{
+    HashMapHolder<Player>::Remove(object);
+
+    Guard guard(i_playerGuard);
+    std::shared_ptr<PlayerIndexes> indexes(new PlayerIndexes(*i_playerIndexes));
+
+    auto nameItr = indexes->byName.find(GetNameIndexKey(object->GetName()));
+    if (nameItr != indexes->byName.end() && nameItr->second == object)
+        indexes->byName.erase(nameItr);
+
+    auto bounds = indexes->byAccount.equal_range(object->GetSession()->GetAccountId());
+    for (auto itr = bounds.first; itr != bounds.second; ++itr)
+    {
+        if (itr->second == object)
+        {
+            indexes->byAccount.erase(itr);
+            break;
+        }
+    }
+
+    std::atomic_store(&i_playerIndexes, std::shared_ptr<PlayerIndexes const>(indexes));
+}
+
 void
 ObjectAccessor::SaveAllPlayers() const
 {
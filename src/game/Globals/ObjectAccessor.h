@@ -31,6 +31,7 @@
 #include "Entities/Player.h"
 #include "Entities/Corpse.h"
 
+#include <memory>
 #include <mutex>
 
 class Unit;
@@ -84,7 +85,8 @@ class ObjectAccessor : public MaNGOS::Singleton<ObjectAccessor, MaNGOS::ClassLev
 
         // Player access
         static Player* FindPlayer(ObjectGuid guid, bool inWorld = true);// if need player at specific map better use Map::GetPlayer
-        static Player* FindPlayerByName(const char* name);
+        static Player* FindPlayerByName(const char* name);  // name case is ignored
+        static Player* FindPlayerByAccount(uint32 accountId);
         static void KickPlayer(ObjectGuid guid);
 
         HashMapHolder<Player>::MapType& GetPlayers() const
@@ -105,13 +107,25 @@ class ObjectAccessor : public MaNGOS::Singleton<ObjectAccessor, MaNGOS::ClassLev
 
         // For call from Player/Corpse AddToWorld/RemoveFromWorld only
         void AddObject(Corpse* object) { HashMapHolder<Corpse>::Insert(object); }
-        void AddObject(Player* object) { HashMapHolder<Player>::Insert(object); }
+        void AddObject(Player* object);
         void RemoveObject(Corpse* object) { HashMapHolder<Corpse>::Remove(object); }
-        void RemoveObject(Player* object) { HashMapHolder<Player>::Remove(object); }
+        void RemoveObject(Player* object);
 
     private:
 
+        // Secondary player lookups. Readers take the current snapshot without locking, writers
+        // (player login and logout only) build a changed copy and publish it in place of the old one
+        struct PlayerIndexes
+        {
+            std::unordered_map<std::string, Player*> byName;        // lower case name
+            std::unordered_multimap<uint32, Player*> byAccount;     // several players per account with playerbots
+        };
+
+        static std::string GetNameIndexKey(const char* name);
+        std::shared_ptr<PlayerIndexes const> GetPlayerIndexes() const { return std::atomic_load(&i_playerIndexes); }
+
         Player2CorpsesMapType   i_player2corpse;
+        std::shared_ptr<PlayerIndexes const> i_playerIndexes;
 
         typedef std::mutex LockType;
         typedef MaNGOS::GeneralLock<LockType > Guard;
@@ -32,6 +32,7 @@
 #include "Maps/MapPersistentStateMgr.h"
 #include "Entities/ObjectGuid.h"
 
+#include <atomic>
 #include <map>
 
 class Group;
@@ -499,7 +500,7 @@ class IdGenerator
 
     private:                                                // fields
         char const* m_name;
-        T m_nextGuid;
+        std::atomic<T> m_nextGuid;                          // maps generate ids concurrently
 };
 
 class ObjectMgr
@@ -94,7 +94,7 @@ void MessageDeliverer::Visit(CameraMapType& m)
         if (i_toSelf || owner != &i_player)
         {
             if (WorldSession* session = owner->GetSession())
-                session->SendPacket(i_message);
+                session->SendPacket(i_message, i_contents);
         }
     }
 }
@@ -109,7 +109,7 @@ void MessageDelivererExcept::Visit(CameraMapType& m)
             continue;
 
         if (WorldSession* session = owner->GetSession())
-            session->SendPacket(i_message);
+            session->SendPacket(i_message, i_contents);
     }
 }
 
@@ -118,7 +118,7 @@ void ObjectMessageDeliverer::Visit(CameraMapType& m)
     for (auto& iter : m)
     {
         if (WorldSession* session = iter.getSource()->GetOwner()->GetSession())
-            session->SendPacket(i_message);
+            session->SendPacket(i_message, i_contents);
     }
 }
 
@@ -133,7 +133,7 @@ void MessageDistDeliverer::Visit(CameraMapType& m)
                 (!i_dist || iter.getSource()->GetBody()->IsWithinDist(&i_player, i_dist)))
         {
             if (WorldSession* session = owner->GetSession())
-                session->SendPacket(i_message);
+                session->SendPacket(i_message, i_contents);
         }
     }
 }
@@ -145,7 +145,7 @@ void ObjectMessageDistDeliverer::Visit(CameraMapType& m)
         if (!i_dist || iter.getSource()->GetBody()->IsWithinDist(&i_object, i_dist))
         {
             if (WorldSession* session = iter.getSource()->GetOwner()->GetSession())
-                session->SendPacket(i_message);
+                session->SendPacket(i_message, i_contents);
         }
     }
 }
@@ -58,6 +58,7 @@ namespace MaNGOS
     {
         Player const& i_player;
         WorldPacket const& i_message;
+        SharedPacketContents i_contents;                    // copied by the first socket, shared by the others
         bool i_toSelf;
         MessageDeliverer(Player const& pl, WorldPacket const& msg, bool to_self) : i_player(pl), i_message(msg), i_toSelf(to_self) {}
         void Visit(CameraMapType& m);
@@ -67,6 +68,7 @@ namespace MaNGOS
     struct MessageDelivererExcept
     {
         WorldPacket const&  i_message;
+        SharedPacketContents i_contents;
         Player const* i_skipped_receiver;
 
         MessageDelivererExcept(WorldPacket const& msg, Player const* skipped)
@@ -79,6 +81,7 @@ namespace MaNGOS
     struct ObjectMessageDeliverer
     {
         WorldPacket const& i_message;
+        SharedPacketContents i_contents;
         explicit ObjectMessageDeliverer(WorldPacket const& msg) : i_message(msg) {}
         void Visit(CameraMapType& m);
         template<class SKIP> void Visit(GridRefManager<SKIP>&) {}
@@ -88,6 +91,7 @@ namespace MaNGOS
     {
         Player const& i_player;
         WorldPacket const& i_message;
+        SharedPacketContents i_contents;
         bool i_toSelf;
         bool i_ownTeamOnly;
         float i_dist;
@@ -102,6 +106,7 @@ namespace MaNGOS
     {
         WorldObject const& i_object;
         WorldPacket const& i_message;
+        SharedPacketContents i_contents;
         float i_dist;
         ObjectMessageDistDeliverer(WorldObject const& obj, WorldPacket const& msg, float dist) : i_object(obj), i_message(msg), i_dist(dist) {}
         void Visit(CameraMapType& m);
@@ -1161,6 +1166,16 @@ namespace MaNGOS
             NearestCreatureEntryWithLiveStateInObjectRangeCheck(NearestCreatureEntryWithLiveStateInObjectRangeCheck const&);
     };
 
+    // Packed position filter of the creature searchers, checks without own version look at every creature of the cell
+    template<class Check>
+    inline bool IsPackedCandidate(Check const& /*check*/, CreatureMapType const& /*m*/, uint32 /*index*/) { return true; }
+
+    inline bool IsPackedCandidate(NearestCreatureEntryWithLiveStateInObjectRangeCheck const& check, CreatureMapType const& m, uint32 index)
+    {
+        WorldObject const& obj = check.GetFocusObject();
+        return m.IsPackedMaybeWithinDist3d(index, obj.GetPositionX(), obj.GetPositionY(), obj.GetPositionZ(), check.GetLastRange());
+    }
+
     // Success at unit in range, range update for next check (this can be used with CreatureListSearcher to find creatures with given entry)
     class AllCreatureEntriesWithLiveStateInObjectRangeCheck
     {
@@ -550,11 +550,11 @@ void MaNGOS::CreatureSearcher<Check>::Visit(CreatureMapType& m)
     if (i_object)
         return;
 
-    for (CreatureMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
+    for (uint32 i = 0; i < m.GetPackedCount(); ++i)
     {
-        if (i_check(itr->getSource()))
+        if (IsPackedCandidate(i_check, m, i) && i_check(m.GetPackedObject(i)))
         {
-            i_object = itr->getSource();
+            i_object = m.GetPackedObject(i);
             return;
         }
     }
@@ -563,19 +563,19 @@ void MaNGOS::CreatureSearcher<Check>::Visit(CreatureMapType& m)
 template<class Check>
 void MaNGOS::CreatureLastSearcher<Check>::Visit(CreatureMapType& m)
 {
-    for (CreatureMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
+    for (uint32 i = 0; i < m.GetPackedCount(); ++i)
     {
-        if (i_check(itr->getSource()))
-            i_object = itr->getSource();
+        if (IsPackedCandidate(i_check, m, i) && i_check(m.GetPackedObject(i)))
+            i_object = m.GetPackedObject(i);
     }
 }
 
 template<class Check>
 void MaNGOS::CreatureListSearcher<Check>::Visit(CreatureMapType& m)
 {
-    for (CreatureMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
-        if (i_check(itr->getSource()))
-            i_objects.push_back(itr->getSource());
+    for (uint32 i = 0; i < m.GetPackedCount(); ++i)
+        if (IsPackedCandidate(i_check, m, i) && i_check(m.GetPackedObject(i)))
+            i_objects.push_back(m.GetPackedObject(i));
 }
 
 template<class Check>
@@ -134,7 +134,11 @@ bool Group::Create(ObjectGuid guid, const char* name)
         return false;
 
     if (!isBattleGroup())
+    {
+        // the transaction holds the member row of the leader, see _addMember
+        SqlAsyncRoute dbRoute(CharacterDatabase, m_Id, guid.GetCounter());
         CharacterDatabase.CommitTransaction();
+    }
 
     _updateLeaderFlag();
 
@@ -207,7 +211,10 @@ void Group::ConvertToRaid()
     _initRaidSubGroupsCounter();
 
     if (!isBattleGroup())
+    {
+        SqlAsyncRoute dbRoute(CharacterDatabase, m_Id);
         CharacterDatabase.PExecute("UPDATE `groups` SET isRaid = 1 WHERE groupId='%u'", m_Id);
+    }
     SendUpdate();
 
     // update quest related GO states (quest activity dependent from raid membership)
@@ -389,6 +396,13 @@ void Group::Disband(bool hideDestroy)
 {
     for (member_citerator citr = m_memberSlots.begin(); citr != m_memberSlots.end(); ++citr)
     {
+        if (!isBattleGroup())
+        {
+            // member rows are deleted one by one, each in order with the rows of the member in other groups, see _removeMember
+            SqlAsyncRoute dbRoute(CharacterDatabase, m_Id, citr->guid.GetCounter());
+            CharacterDatabase.PExecute("DELETE FROM group_member WHERE memberGuid='%u'", citr->guid.GetCounter());
+        }
+
         Player* player = sObjectMgr.GetPlayer(citr->guid);
         if (!player)
             continue;
@@ -440,10 +454,10 @@ void Group::Disband(bool hideDestroy)
 
     if (!isBattleGroup())
     {
-        CharacterDatabase.BeginTransaction();
-        CharacterDatabase.PExecute("DELETE FROM `groups` WHERE groupId='%u'", m_Id);
-        CharacterDatabase.PExecute("DELETE FROM group_member WHERE groupId='%u'", m_Id);
-        CharacterDatabase.CommitTransaction();
+        {
+            SqlAsyncRoute dbRoute(CharacterDatabase, m_Id);
+            CharacterDatabase.PExecute("DELETE FROM `groups` WHERE groupId='%u'", m_Id);
+        }
         ResetInstances(INSTANCE_RESET_GROUP_DISBAND, nullptr);
     }
 
@@ -631,6 +645,7 @@ void Group::UpdateOfflineLeader(time_t time, uint32 delay)
 
 void Group::BroadcastPacket(WorldPacket& packet, bool ignorePlayersInBGRaid, int group, ObjectGuid ignore)
 {
+    SharedPacketContents contents;
     for (GroupReference* itr = GetFirstMember(); itr != nullptr; itr = itr->next())
     {
         Player* pl = itr->getSource();
@@ -638,7 +653,7 @@ void Group::BroadcastPacket(WorldPacket& packet, bool ignorePlayersInBGRaid, int
             continue;
 
         if (pl->GetSession() && (group == -1 || itr->getSubGroup() == group))
-            pl->GetSession()->SendPacket(packet);
+            pl->GetSession()->SendPacket(packet, contents);
     }
 }
 
@@ -758,6 +773,10 @@ bool Group::_addMember(ObjectGuid guid, const char* name, bool isAssistant, uint
 
     if (!isBattleGroup())
     {
+        // member rows are written on the connection of the group, joined with the member so the row of a group
+        // left before is deleted before the member is inserted here (memberGuid is the key of group_member)
+        SqlAsyncRoute dbRoute(CharacterDatabase, m_Id, member.guid.GetCounter());
+
         // insert into group table
         CharacterDatabase.PExecute("INSERT INTO group_member(groupId,memberGuid,assistant,subgroup) VALUES('%u','%u','%u','%u')",
                                    m_Id, member.guid.GetCounter(), ((member.assistant == 1) ? 1 : 0), member.group);
@@ -795,7 +814,10 @@ bool Group::_removeMember(ObjectGuid guid)
     }
 
     if (!isBattleGroup())
+    {
+        SqlAsyncRoute dbRoute(CharacterDatabase, m_Id, guid.GetCounter());
         CharacterDatabase.PExecute("DELETE FROM group_member WHERE memberGuid='%u'", guid.GetCounter());
+    }
 
     if (m_leaderGuid == guid)                               // leader was removed
     {
@@ -864,6 +886,10 @@ void Group::_setLeader(ObjectGuid guid)
 
         uint32 leader_lowguid = m_leaderGuid.GetCounter();
 
+        // the group row is written on the connection of the group, joined with the first one where the
+        // instance binds of players and groups are written
+        SqlAsyncRoute dbRoute(CharacterDatabase, m_Id, 0);
+
         // TODO: set a time limit to have this function run rarely cause it can be slow
         CharacterDatabase.BeginTransaction();
 
@@ -983,7 +1009,10 @@ bool Group::_setMembersGroup(ObjectGuid guid, uint8 group)
     SubGroupCounterIncrease(group);
 
     if (!isBattleGroup())
+    {
+        SqlAsyncRoute dbRoute(CharacterDatabase, m_Id);
         CharacterDatabase.PExecute("UPDATE group_member SET subgroup='%u' WHERE memberGuid='%u'", group, guid.GetCounter());
+    }
 
     return true;
 }
@@ -996,7 +1025,10 @@ bool Group::_setAssistantFlag(ObjectGuid guid, const bool& state)
 
     slot->assistant = state;
     if (!isBattleGroup())
+    {
+        SqlAsyncRoute dbRoute(CharacterDatabase, m_Id);
         CharacterDatabase.PExecute("UPDATE group_member SET assistant='%u' WHERE memberGuid='%u'", (state) ? 1 : 0, guid.GetCounter());
+    }
     return true;
 }
 
@@ -1018,7 +1050,10 @@ bool Group::_setMainTank(ObjectGuid guid)
     m_mainTankGuid = guid;
 
     if (!isBattleGroup())
+    {
+        SqlAsyncRoute dbRoute(CharacterDatabase, m_Id);
         CharacterDatabase.PExecute("UPDATE `groups` SET mainTank='%u' WHERE groupId='%u'", m_mainTankGuid.GetCounter(), m_Id);
+    }
 
     return true;
 }
@@ -1041,8 +1076,11 @@ bool Group::_setMainAssistant(ObjectGuid guid)
     m_mainAssistantGuid = guid;
 
     if (!isBattleGroup())
+    {
+        SqlAsyncRoute dbRoute(CharacterDatabase, m_Id);
         CharacterDatabase.PExecute("UPDATE `groups` SET mainAssistant='%u' WHERE groupId='%u'",
                                    m_mainAssistantGuid.GetCounter(), m_Id);
+    }
 
     return true;
 }
@@ -246,6 +246,7 @@ void MailDraft::SendReturnToSender(uint32 sender_acc, ObjectGuid sender_guid, Ob
         needItemDelay = sender_acc != rc_account;
 
         // set owner to new receiver (to prevent delete item with sender char deleting)
+        SqlAsyncRoute dbRoute(CharacterDatabase, receiver_guid.GetCounter(), SqlAsyncRoute::GetKey(CharacterDatabase));
         CharacterDatabase.BeginTransaction();
         for (auto& m_item : m_items)
         {
@@ -285,6 +286,9 @@ void MailDraft::SendMailTo(MailReceiver const& receiver, MailSender const& sende
         return;
     }
 
+    // ordered with the writes of the sender (current route) and the saves of the receiver
+    SqlAsyncRoute dbRoute(CharacterDatabase, receiver.GetPlayerGuid().GetCounter(), SqlAsyncRoute::GetKey(CharacterDatabase));
+
     bool has_items = !m_items.empty();
 
     // generate mail template items for online player, for offline player items will generated at open
@@ -382,6 +386,7 @@ void Mail::prepareTemplateItems(Player* receiver)
 
     has_items = true;
 
+    SqlAsyncRoute dbRoute(CharacterDatabase, receiver->GetGUIDLow());
     CharacterDatabase.BeginTransaction();
     CharacterDatabase.PExecute("UPDATE mail SET has_items = 1 WHERE id = %u", messageID);
 
@@ -211,6 +211,9 @@ void WorldSession::HandleSendMail(WorldPacket& recv_data)
 
     pl->ModifyMoney(-int32(reqmoney));
 
+    // the items move to the receiver, keep the writes ordered with the saves of both characters
+    SqlAsyncRoute dbRoute(CharacterDatabase, pl->GetGUIDLow(), rc.GetCounter());
+
     bool needItemDelay = false;
 
     MailDraft draft(subject, body);
@@ -362,6 +365,7 @@ void WorldSession::HandleMailReturnToSender(WorldPacket& recv_data)
 
     // we can return mail now
     // so firstly delete the old one
+    SqlAsyncRoute dbRoute(CharacterDatabase, pl->GetGUIDLow());
     CharacterDatabase.BeginTransaction();
     CharacterDatabase.PExecute("DELETE FROM mail WHERE id = '%u'", mailId);
     // needed?
@@ -434,6 +438,8 @@ void WorldSession::HandleMailTakeItem(WorldPacket& recv_data)
     InventoryResult msg = _player->CanStoreItem(NULL_BAG, NULL_SLOT, dest, it, false);
     if (msg == EQUIP_ERR_OK)
     {
+        SqlAsyncRoute dbRoute(CharacterDatabase, pl->GetGUIDLow());
+
         m->RemoveItem(itemGuid);
         m->removedItems.push_back(itemGuid);
 
@@ -524,6 +530,7 @@ void WorldSession::HandleMailTakeMoney(WorldPacket& recv_data)
     pl->m_mailsUpdated = true;
 
     // save money and mail to prevent cheating
+    SqlAsyncRoute dbRoute(CharacterDatabase, pl->GetGUIDLow());
     CharacterDatabase.BeginTransaction();
     pl->SaveGoldToDB();
     pl->_SaveMail();
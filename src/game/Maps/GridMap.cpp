@@ -30,6 +30,14 @@
 
 #include <mutex>
 
+#if PLATFORM == PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 char const* MAP_MAGIC         = "MAPS";
 char const* MAP_VERSION_MAGIC = "z1.4";
 char const* MAP_AREA_MAGIC    = "AREA";
@@ -66,6 +74,7 @@ GridMap::GridMap(): m_gridIntHeightMultiplier(0)
     m_liquidEntry = nullptr;
     m_liquid_map  = nullptr;
     m_fullyLoaded = false;
+    m_mappedData = false;
 }
 
 GridMap::~GridMap()
@@ -133,14 +142,76 @@ bool GridMap::loadData(char const* filename)
     return false;
 }
 
+// bytes of a tile section usable in place, 0 if it is outside of the tile or not aligned for its arrays
+static uint32 GetMappedSectionSize(uint32 offset, uint32 sectionSize, uint32 tileSize)
+{
+    if (offset % sizeof(float) || offset >= tileSize)
+        return 0;
+
+    return std::min(sectionSize, tileSize - offset);
+}
+
+bool GridMap::loadMappedData(char const* data, uint32 size, char const* name)
+{
+    // Unload old data if exist
+    unloadData();
+
+    m_mappedData = true;
+
+    GridMapFileHeader const& header = *reinterpret_cast<GridMapFileHeader const*>(data);
+    if (size < sizeof(header) || header.mapMagic != *((uint32 const*)(MAP_MAGIC)) ||
+            header.versionMagic != *((uint32 const*)(MAP_VERSION_MAGIC)))
+    {
+        sLog.outError("Map tile '%s' is non-compatible version (outdated?). Please, create new using ad.exe program.", name);
+        return false;
+    }
+
+    // loadup area data
+    if (header.areaMapOffset && !mapAreaData(data, header.areaMapOffset, GetMappedSectionSize(header.areaMapOffset, header.areaMapSize, size)))
+    {
+        sLog.outError("Error loading map area data of %s\n", name);
+        return false;
+    }
+
+    // loadup holes data
+    if (header.holesOffset)
+    {
+        if (header.holesOffset > size || size - header.holesOffset < sizeof(m_holes))
+        {
+            sLog.outError("Error loading map holes data of %s\n", name);
+            return false;
+        }
+        memcpy(m_holes, data + header.holesOffset, sizeof(m_holes));
+    }
+
+    // loadup height data
+    if (header.heightMapOffset && !mapHeightData(data, header.heightMapOffset, GetMappedSectionSize(header.heightMapOffset, header.heightMapSize, size)))
+    {
+        sLog.outError("Error loading map height data of %s\n", name);
+        return false;
+    }
+
+    // loadup liquid data
+    if (header.liquidMapOffset && !mapGridMapLiquidData(data, header.liquidMapOffset, GetMappedSectionSize(header.liquidMapOffset, header.liquidMapSize, size)))
+    {
+        sLog.outError("Error loading map liquids data of %s\n", name);
+        return false;
+    }
+
+    return true;
+}
+
 void GridMap::unloadData()
 {
-    delete[] m_area_map;
-    delete[] m_V9;
-    delete[] m_V8;
-    delete[] m_liquidEntry;
-    delete[] m_liquidFlags;
-    delete[] m_liquid_map;
+    if (!m_mappedData)
+    {
+        delete[] m_area_map;
+        delete[] m_V9;
+        delete[] m_V8;
+        delete[] m_liquidEntry;
+        delete[] m_liquidFlags;
+        delete[] m_liquid_map;
+    }
 
     m_area_map = nullptr;
     m_V9 = nullptr;
@@ -149,6 +220,7 @@ void GridMap::unloadData()
     m_liquidFlags = nullptr;
     m_liquid_map  = nullptr;
     m_gridGetHeight = &GridMap::getHeightFromFlat;
+    m_mappedData = false;
 }
 
 bool GridMap::loadAreaData(FILE* in, uint32 offset, uint32 /*size*/)
@@ -162,8 +234,9 @@ bool GridMap::loadAreaData(FILE* in, uint32 offset, uint32 /*size*/)
     m_gridArea = header.gridArea;
     if (!(header.flags & MAP_AREA_NO_AREA))
     {
-        m_area_map = new uint16 [16 * 16];
-        fread(m_area_map, sizeof(uint16), 16 * 16, in);
+        uint16* area_map = new uint16 [16 * 16];
+        fread(area_map, sizeof(uint16), 16 * 16, in);
+        m_area_map = area_map;
     }
 
     return true;
@@ -182,28 +255,34 @@ bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
     {
         if ((header.flags & MAP_HEIGHT_AS_INT16))
         {
-            m_uint16_V9 = new uint16 [129 * 129];
-            m_uint16_V8 = new uint16 [128 * 128];
-            fread(m_uint16_V9, sizeof(uint16), 129 * 129, in);
-            fread(m_uint16_V8, sizeof(uint16), 128 * 128, in);
+            uint16* V9 = new uint16 [129 * 129];
+            uint16* V8 = new uint16 [128 * 128];
+            fread(V9, sizeof(uint16), 129 * 129, in);
+            fread(V8, sizeof(uint16), 128 * 128, in);
+            m_uint16_V9 = V9;
+            m_uint16_V8 = V8;
             m_gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 65535;
             m_gridGetHeight = &GridMap::getHeightFromUint16;
         }
         else if ((header.flags & MAP_HEIGHT_AS_INT8))
         {
-            m_uint8_V9 = new uint8 [129 * 129];
-            m_uint8_V8 = new uint8 [128 * 128];
-            fread(m_uint8_V9, sizeof(uint8), 129 * 129, in);
-            fread(m_uint8_V8, sizeof(uint8), 128 * 128, in);
+            uint8* V9 = new uint8 [129 * 129];
+            uint8* V8 = new uint8 [128 * 128];
+            fread(V9, sizeof(uint8), 129 * 129, in);
+            fread(V8, sizeof(uint8), 128 * 128, in);
+            m_uint8_V9 = V9;
+            m_uint8_V8 = V8;
             m_gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 255;
             m_gridGetHeight = &GridMap::getHeightFromUint8;
         }
         else
         {
-            m_V9 = new float [129 * 129];
-            m_V8 = new float [128 * 128];
-            fread(m_V9, sizeof(float), 129 * 129, in);
-            fread(m_V8, sizeof(float), 128 * 128, in);
+            float* V9 = new float [129 * 129];
+            float* V8 = new float [128 * 128];
+            fread(V9, sizeof(float), 129 * 129, in);
+            fread(V8, sizeof(float), 128 * 128, in);
+            m_V9 = V9;
+            m_V8 = V8;
             m_gridGetHeight = &GridMap::getHeightFromFloat;
         }
     }
@@ -241,17 +320,126 @@ bool GridMap::loadGridMapLiquidData(FILE* in, uint32 offset, uint32 /*size*/)
 
     if (!(header.flags & MAP_LIQUID_NO_TYPE))
     {
-        m_liquidEntry = new uint16[16 * 16];
-        fread(m_liquidEntry, sizeof(uint16), 16 * 16, in);
+        uint16* liquidEntry = new uint16[16 * 16];
+        fread(liquidEntry, sizeof(uint16), 16 * 16, in);
+        m_liquidEntry = liquidEntry;
 
-        m_liquidFlags = new uint8[16 * 16];
-        fread(m_liquidFlags, sizeof(uint8), 16 * 16, in);
+        uint8* liquidFlags = new uint8[16 * 16];
+        fread(liquidFlags, sizeof(uint8), 16 * 16, in);
+        m_liquidFlags = liquidFlags;
     }
 
     if (!(header.flags & MAP_LIQUID_NO_HEIGHT))
     {
-        m_liquid_map = new float [m_liquid_width * m_liquid_height];
-        fread(m_liquid_map, sizeof(float), m_liquid_width * m_liquid_height, in);
+        float* liquid_map = new float [m_liquid_width * m_liquid_height];
+        fread(liquid_map, sizeof(float), m_liquid_width * m_liquid_height, in);
+        m_liquid_map = liquid_map;
+    }
+
+    return true;
+}
+
+// the mapped sections are only checked for fitting into the tile, their arrays are used in place
+
+bool GridMap::mapAreaData(char const* data, uint32 offset, uint32 size)
+{
+    GridMapAreaHeader const& header = *reinterpret_cast<GridMapAreaHeader const*>(data + offset);
+    if (size < sizeof(header) || header.fourcc != *((uint32 const*)(MAP_AREA_MAGIC)))
+        return false;
+
+    m_gridArea = header.gridArea;
+    if (!(header.flags & MAP_AREA_NO_AREA))
+    {
+        if (size < sizeof(header) + sizeof(uint16) * 16 * 16)
+            return false;
+
+        m_area_map = reinterpret_cast<uint16 const*>(data + offset + sizeof(header));
+    }
+
+    return true;
+}
+
+bool GridMap::mapHeightData(char const* data, uint32 offset, uint32 size)
+{
+    GridMapHeightHeader const& header = *reinterpret_cast<GridMapHeightHeader const*>(data + offset);
+    if (size < sizeof(header) || header.fourcc != *((uint32 const*)(MAP_HEIGHT_MAGIC)))
+        return false;
+
+    char const* heights = data + offset + sizeof(header);
+
+    m_gridHeight = header.gridHeight;
+    if (!(header.flags & MAP_HEIGHT_NO_HEIGHT))
+    {
+        if ((header.flags & MAP_HEIGHT_AS_INT16))
+        {
+            if (size < sizeof(header) + sizeof(uint16) * (129 * 129 + 128 * 128))
+                return false;
+
+            m_uint16_V9 = reinterpret_cast<uint16 const*>(heights);
+            m_uint16_V8 = m_uint16_V9 + 129 * 129;
+            m_gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 65535;
+            m_gridGetHeight = &GridMap::getHeightFromUint16;
+        }
+        else if ((header.flags & MAP_HEIGHT_AS_INT8))
+        {
+            if (size < sizeof(header) + sizeof(uint8) * (129 * 129 + 128 * 128))
+                return false;
+
+            m_uint8_V9 = reinterpret_cast<uint8 const*>(heights);
+            m_uint8_V8 = m_uint8_V9 + 129 * 129;
+            m_gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 255;
+            m_gridGetHeight = &GridMap::getHeightFromUint8;
+        }
+        else
+        {
+            if (size < sizeof(header) + sizeof(float) * (129 * 129 + 128 * 128))
+                return false;
+
+            m_V9 = reinterpret_cast<float const*>(heights);
+            m_V8 = m_V9 + 129 * 129;
+            m_gridGetHeight = &GridMap::getHeightFromFloat;
+        }
+    }
+    else
+        m_gridGetHeight = &GridMap::getHeightFromFlat;
+
+    return true;
+}
+
+bool GridMap::mapGridMapLiquidData(char const* data, uint32 offset, uint32 size)
+{
+    GridMapLiquidHeader const& header = *reinterpret_cast<GridMapLiquidHeader const*>(data + offset);
+    if (size < sizeof(header) || header.fourcc != *((uint32 const*)(MAP_LIQUID_MAGIC)))
+        return false;
+
+    m_liquidGlobalEntry = header.liquidType;
+    m_liquidGlobalFlags = header.liquidFlags;
+    m_liquid_offX   = header.offsetX;
+    m_liquid_offY   = header.offsetY;
+    m_liquid_width  = header.width;
+    m_liquid_height = header.height;
+    m_liquidLevel   = header.liquidLevel;
+
+    uint32 used = sizeof(header);
+
+    if (!(header.flags & MAP_LIQUID_NO_TYPE))
+    {
+        if (size < used + sizeof(uint16) * 16 * 16 + sizeof(uint8) * 16 * 16)
+            return false;
+
+        m_liquidEntry = reinterpret_cast<uint16 const*>(data + offset + used);
+        used += sizeof(uint16) * 16 * 16;
+
+        m_liquidFlags = reinterpret_cast<uint8 const*>(data + offset + used);
+        used += sizeof(uint8) * 16 * 16;
+    }
+
+    if (!(header.flags & MAP_LIQUID_NO_HEIGHT))
+    {
+        if (size < used + sizeof(float) * m_liquid_width * m_liquid_height)
+            return false;
+
+        m_liquid_map = reinterpret_cast<float const*>(data + offset + used);
     }
 
     return true;
@@ -387,7 +575,7 @@ float GridMap::getHeightFromUint8(float x, float y) const
     y_int &= (MAP_RESOLUTION - 1);
 
     int32 a, b, c;
-    uint8* V9_h1_ptr = &m_uint8_V9[x_int * 128 + x_int + y_int];
+    uint8 const* V9_h1_ptr = &m_uint8_V9[x_int * 128 + x_int + y_int];
     if (x + y < 1)
     {
         if (x > y)
@@ -455,7 +643,7 @@ float GridMap::getHeightFromUint16(float x, float y) const
     y_int &= (MAP_RESOLUTION - 1);
 
     int32 a, b, c;
-    uint16* V9_h1_ptr = &m_uint16_V9[x_int * 128 + x_int + y_int];
+    uint16 const* V9_h1_ptr = &m_uint16_V9[x_int * 128 + x_int + y_int];
     if (x + y < 1)
     {
         if (x > y)
@@ -639,6 +827,19 @@ GridMapLiquidStatus GridMap::getLiquidStatus(float x, float y, float z, uint8 Re
 
 bool GridMap::ExistMap(uint32 mapid, int gx, int gy)
 {
+    // tiles of a packed map file are used instead of the .map files
+    GridMapPackedHeader packedHeader;
+    char packedName[32];
+    snprintf(packedName, sizeof(packedName), "maps/%03u.pmap", mapid);
+    if (GridMapPackedFile::ReadHeader((sWorld.GetDataPath() + packedName).c_str(), packedHeader))
+    {
+        if (packedHeader.tiles[gx][gy].offset)
+            return true;
+
+        sLog.outError("Check existing of map file '%s': no tile %02u%02u in it!", (sWorld.GetDataPath() + packedName).c_str(), gx, gy);
+        return false;
+    }
+
     int len = sWorld.GetDataPath().length() + strlen("maps/%03u%02u%02u.map") + 1;
     char* tmp = new char[len];
     snprintf(tmp, len, (char*)(sWorld.GetDataPath() + "maps/%03u%02u%02u.map").c_str(), mapid, gx, gy);
@@ -688,6 +889,118 @@ bool GridMap::ExistVMap(uint32 mapid, int gx, int gy)
     return true;
 }
 
+//////////////////////////////////////////////////////////////////////////
+bool GridMapPackedFile::ReadHeader(char const* filename, GridMapPackedHeader& header)
+{
+    FILE* f = fopen(filename, "rb");
+    if (!f)
+        return false;
+
+    bool valid = fread(&header, sizeof(header), 1, f) == 1;
+    fseek(f, 0, SEEK_END);
+    long fileSize = ftell(f);
+    fclose(f);
+
+    if (!valid || header.magic != PACKED_MAP_MAGIC || header.version != PACKED_MAP_VERSION)
+        return false;
+
+    if (header.tileVersionMagic != *((uint32 const*)(MAP_VERSION_MAGIC)) || fileSize < 0 || header.fileSize != uint64(fileSize))
+    {
+        sLog.outError("Map file '%s' is non-compatible version (outdated?). Please, create new using ad.exe program.", filename);
+        return false;
+    }
+
+    for (uint32 x = 0; x < PACKED_MAP_GRIDS; ++x)
+    {
+        for (uint32 y = 0; y < PACKED_MAP_GRIDS; ++y)
+        {
+            GridMapPackedTile const& tile = header.tiles[x][y];
+            if (tile.offset && (tile.offset % PACKED_MAP_PAGE_SIZE || uint64(tile.offset) + tile.size > header.fileSize))
+            {
+                sLog.outError("Map file '%s' is damaged. Please, create new using ad.exe program.", filename);
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool GridMapPackedFile::Map(char const* filename)
+{
+    Unmap();
+
+    GridMapPackedHeader header;
+    if (!ReadHeader(filename, header))
+        return false;
+
+    size_t size = size_t(header.fileSize);
+
+#if PLATFORM == PLATFORM_WINDOWS
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping)
+        return false;
+
+    void* base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size);
+    CloseHandle(mapping);
+    if (!base)
+        return false;
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    // shared read only mapping: the pages are the file cache, used by all processes mapping the file
+    void* base = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+        return false;
+#endif
+
+    m_base = static_cast<char*>(base);
+    m_size = size;
+    return true;
+}
+
+void GridMapPackedFile::Unmap()
+{
+    if (!m_base)
+        return;
+
+#if PLATFORM == PLATFORM_WINDOWS
+    UnmapViewOfFile(m_base);
+#else
+    munmap(m_base, m_size);
+#endif
+
+    m_base = nullptr;
+    m_size = 0;
+}
+
+char const* GridMapPackedFile::GetTile(uint32 x, uint32 y, uint32& size) const
+{
+    GridMapPackedTile const& tile = GetHeader()->tiles[x][y];
+    if (!tile.offset)
+        return nullptr;
+
+    size = tile.size;
+    return m_base + tile.offset;
+}
+
+void GridMapPackedFile::Prefetch(uint32 x, uint32 y) const
+{
+#if PLATFORM != PLATFORM_WINDOWS
+    GridMapPackedTile const& tile = GetHeader()->tiles[x][y];
+    if (tile.offset)
+        posix_madvise(m_base + tile.offset, tile.size, POSIX_MADV_WILLNEED);
+#endif
+}
+
 //////////////////////////////////////////////////////////////////////////
 TerrainInfo::TerrainInfo(uint32 mapid) : m_mapId(mapid)
 {
@@ -697,6 +1010,7 @@ TerrainInfo::TerrainInfo(uint32 mapid) : m_mapId(mapid)
         {
             m_GridMaps[i][k] = nullptr;
             m_GridRef[i][k] = 0;
+            m_generations[i][k] = 0;
         }
     }
 
@@ -707,6 +1021,11 @@ TerrainInfo::TerrainInfo(uint32 mapid) : m_mapId(mapid)
 
     i_timer.SetInterval(iCleanUpInterval * 1000);
     i_timer.SetCurrent(iRandomStart * 1000);
+
+    char packedName[32];
+    snprintf(packedName, sizeof(packedName), "maps/%03u.pmap", m_mapId);
+    if (m_packedMap.Map((sWorld.GetDataPath() + packedName).c_str()))
+        DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Mapped packed map file %s", packedName);
 }
 
 TerrainInfo::~TerrainInfo()
@@ -778,6 +1097,8 @@ void TerrainInfo::CleanUpGrids(const uint32 diff)
 
                 // unload mmap...
                 MMAP::MMapFactory::createOrGetMMapManager()->unloadMap(m_mapId, x, y);
+
+                ++m_generations[x][y];
             }
         }
     }
@@ -1110,6 +1431,32 @@ float TerrainInfo::GetWaterOrGroundLevel(float x, float y, float z, float* pGrou
     return VMAP_INVALID_HEIGHT_VALUE;
 }
 
+// tile of a coordinate as in GetGrid, clamped as queries may be made for positions outside of the map
+static uint32 GetGenerationTile(float coord)
+{
+    int tile = (int)(32 - coord / SIZE_OF_GRIDS);
+    return uint32(std::min(std::max(tile, 0), MAX_NUMBER_OF_GRIDS - 1));
+}
+
+uint32 TerrainInfo::GetGeneration(float x, float y) const
+{
+    return m_generations[GetGenerationTile(x)][GetGenerationTile(y)];
+}
+
+uint32 TerrainInfo::GetGeneration(float x1, float y1, float x2, float y2) const
+{
+    // tile generations only grow, so the sum changes with any of them
+    uint32 minX = GetGenerationTile(std::max(x1, x2)), maxX = GetGenerationTile(std::min(x1, x2));
+    uint32 minY = GetGenerationTile(std::max(y1, y2)), maxY = GetGenerationTile(std::min(y1, y2));
+
+    uint32 generation = 0;
+    for (uint32 x = minX; x <= maxX; ++x)
+        for (uint32 y = minY; y <= maxY; ++y)
+            generation += m_generations[x][y];
+
+    return generation;
+}
+
 GridMap* TerrainInfo::GetGrid(const float x, const float y, bool loadOnlyMap /*= false*/)
 {
     // half opt method
@@ -1133,34 +1480,107 @@ GridMap* TerrainInfo::LoadMapAndVMap(const uint32 x, const uint32 y, bool mapOnl
         return m_GridMaps[x][y];
     }
 
-    {
-        LOCK_GUARD lock(m_mutex);
-        // double checked lock pattern
-        if (!m_GridMaps[x][y])
-        {
-            GridMap* map = new GridMap();
+    LoadGridMap(x, y);
+
+    // we'll load the rest later
+    if (mapOnly)
+        return m_GridMaps[x][y];
+
+    LoadVMap(x, y);
+
+    // load navmesh
+    LoadNavTile(x, y, nullptr);
+
+    if (m_GridMaps[x][y])
+        m_GridMaps[x][y]->SetFullyLoaded();
+
+    return  m_GridMaps[x][y];
+}
+
+void TerrainInfo::PreloadGrid(const uint32 x, const uint32 y, MMAP::MMapTileData& navTile)
+{
+    LoadGridMap(x, y);
+
+    // a mapped tile is only read at its first use, have it read on this thread
+    if (m_packedMap.IsMapped())
+        m_packedMap.Prefetch(x, y);
 
-            // map file name
-            int len = sWorld.GetDataPath().length() + strlen("maps/%03u%02u%02u.map") + 1;
-            char* tmp = new char[len];
-            snprintf(tmp, len, (char*)(sWorld.GetDataPath() + "maps/%03u%02u%02u.map").c_str(), m_mapId, x, y);
-            DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Loading map %s", tmp);
+    // vmap trees and navmeshes are queried by map threads without locking, only the tile file is read here
+    if (MMAP::MMapFactory::IsPathfindingEnabled(m_mapId, nullptr))
+        MMAP::MMapManager::readTile(m_mapId, x, y, navTile);
+}
+
+void TerrainInfo::FinishPreloadGrid(const uint32 x, const uint32 y, MMAP::MMapTileData& navTile)
+{
+    LoadVMap(x, y);
+    LoadNavTile(x, y, &navTile);
+
+    if (m_GridMaps[x][y])
+        m_GridMaps[x][y]->SetFullyLoaded();
+}
 
-            if (!map->loadData(tmp))
+void TerrainInfo::LoadGridMap(const uint32 x, const uint32 y)
+{
+    LOCK_GUARD lock(m_mutex);
+    // double checked lock pattern
+    if (!m_GridMaps[x][y])
+    {
+        GridMap* map = new GridMap();
+
+        if (m_packedMap.IsMapped())
+        {
+            // like missing .map files, missing tiles are valid unless there are no vmap files too
+            uint32 size;
+            if (char const* tile = m_packedMap.GetTile(x, y, size))
             {
-                sLog.outError("Error load map file: %s", tmp);
-                //assert(false);
+                char name[32];
+                snprintf(name, sizeof(name), "%03u%02u%02u", m_mapId, x, y);
+                DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Loading packed map tile %s", name);
+
+                if (!map->loadMappedData(tile, size, name))
+                    sLog.outError("Error load map tile: %s", name);
             }
 
-            delete[] tmp;
             m_GridMaps[x][y] = map;
+            ++m_generations[x][y];
+            return;
         }
+
+        // map file name
+        int len = sWorld.GetDataPath().length() + strlen("maps/%03u%02u%02u.map") + 1;
+        char* tmp = new char[len];
+        snprintf(tmp, len, (char*)(sWorld.GetDataPath() + "maps/%03u%02u%02u.map").c_str(), m_mapId, x, y);
+        DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Loading map %s", tmp);
+
+        if (!map->loadData(tmp))
+        {
+            sLog.outError("Error load map file: %s", tmp);
+            //assert(false);
+        }
+
+        delete[] tmp;
+        m_GridMaps[x][y] = map;
+        ++m_generations[x][y];
     }
+}
 
-    // we'll load the rest later
-    if (mapOnly)
-        return m_GridMaps[x][y];
+void TerrainInfo::LoadNavTile(const uint32 x, const uint32 y, MMAP::MMapTileData* navTile)
+{
+    MMAP::MMapManager* manager = MMAP::MMapFactory::createOrGetMMapManager();
+
+    // instances load the grid concurrently, check and load under lock so the tile is only referenced once per grid
+    LOCK_GUARD lock(m_mutex);
+    if (manager->IsMMapIsLoaded(m_mapId, x, y))
+        return;
 
+    if (!navTile)
+        manager->loadMap(m_mapId, x, y);
+    else if (navTile->data)
+        manager->addTile(m_mapId, x, y, *navTile);
+}
+
+void TerrainInfo::LoadVMap(const uint32 x, const uint32 y)
+{
     if (!VMAP::VMapFactory::createOrGetVMapManager()->IsTileLoaded(m_mapId, x, y))
     {
         // load VMAPs for current map/grid...
@@ -1172,6 +1592,7 @@ GridMap* TerrainInfo::LoadMapAndVMap(const uint32 x, const uint32 y, bool mapOnl
         {
             case VMAP::VMAP_LOAD_RESULT_OK:
                 DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "VMAP loaded name:%s, id:%d, x:%d, y:%d (vmap rep.: x:%d, y:%d)", mapName, m_mapId, x, y, x, y);
+                ++m_generations[x][y];
                 break;
             case VMAP::VMAP_LOAD_RESULT_ERROR:
                 DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Could not load VMAP name:%s, id:%d, x:%d, y:%d (vmap rep.: x:%d, y:%d)", mapName, m_mapId, x, y, x, y);
@@ -1181,17 +1602,6 @@ GridMap* TerrainInfo::LoadMapAndVMap(const uint32 x, const uint32 y, bool mapOnl
                 break;
         }
     }
-
-    if (!MMAP::MMapFactory::createOrGetMMapManager()->IsMMapIsLoaded(m_mapId, x, y))
-    {
-        // load navmesh
-        MMAP::MMapFactory::createOrGetMMapManager()->loadMap(m_mapId, x, y);
-    }
-
-    if (m_GridMaps[x][y])
-        m_GridMaps[x][y]->SetFullyLoaded();
-
-    return  m_GridMaps[x][y];
 }
 
 float TerrainInfo::GetWaterLevel(float x, float y, float z, float* pGround /*= nullptr*/) const
@@ -28,6 +28,11 @@
 #include <atomic>
 #include <mutex>
 
+namespace MMAP
+{
+    struct MMapTileData;
+}
+
 class Creature;
 class Unit;
 class WorldPacket;
@@ -45,22 +50,22 @@ class GridMap
 
         // Area data
         uint16 m_gridArea;
-        uint16* m_area_map;
+        uint16 const* m_area_map;
 
         // Height level data
         float m_gridHeight;
         float m_gridIntHeightMultiplier;
         union
         {
-            float* m_V9;
-            uint16* m_uint16_V9;
-            uint8* m_uint8_V9;
+            float const* m_V9;
+            uint16 const* m_uint16_V9;
+            uint8 const* m_uint8_V9;
         };
         union
         {
-            float* m_V8;
-            uint16* m_uint16_V8;
-            uint8* m_uint8_V8;
+            float const* m_V8;
+            uint16 const* m_uint16_V8;
+            uint8 const* m_uint8_V8;
         };
 
         // Liquid data
@@ -71,17 +76,23 @@ class GridMap
         uint8 m_liquid_width;
         uint8 m_liquid_height;
         float m_liquidLevel;
-        uint16* m_liquidEntry;
-        uint8* m_liquidFlags;
-        float* m_liquid_map;
+        uint16 const* m_liquidEntry;
+        uint8 const* m_liquidFlags;
+        float const* m_liquid_map;
 
         // For fast check
         bool m_fullyLoaded;
 
+        // arrays point into a packed map file instead of being owned
+        bool m_mappedData;
+
         bool loadAreaData(FILE* in, uint32 offset, uint32 size);
         bool loadHeightData(FILE* in, uint32 offset, uint32 size);
         bool loadGridMapLiquidData(FILE* in, uint32 offset, uint32 size);
         bool loadHolesData(FILE* in, uint32 offset, uint32 size);
+        bool mapAreaData(char const* data, uint32 offset, uint32 size);
+        bool mapHeightData(char const* data, uint32 offset, uint32 size);
+        bool mapGridMapLiquidData(char const* data, uint32 offset, uint32 size);
         bool isHole(int row, int col) const;
 
         // Get height functions and pointers
@@ -98,6 +109,8 @@ class GridMap
         ~GridMap();
 
         bool loadData(char const* filename);
+        // uses the tile of a packed map file in place, the file must stay mapped while the grid map is loaded
+        bool loadMappedData(char const* data, uint32 size, char const* name);
         void unloadData();
         bool IsFullyLoaded() const { return m_fullyLoaded; }
         void SetFullyLoaded() { m_fullyLoaded = true; }
@@ -113,6 +126,42 @@ class GridMap
         GridMapLiquidStatus getLiquidStatus(float x, float y, float z, uint8 ReqLiquidType, GridMapLiquidData* data = nullptr);
 };
 
+/**
+ * Packed map file (maps/<map id>.pmap) holding all .map tiles of a map, mapped read only.
+ *
+ * Tiles start at page boundaries and their sections are aligned, so grid maps use the height,
+ * area and liquid arrays in place. Loading a tile costs no reads or allocations, the pages
+ * are read by the system when first used, and processes using the same file share them.
+ */
+class GridMapPackedFile
+{
+    public:
+        GridMapPackedFile() : m_base(nullptr), m_size(0) {}
+        ~GridMapPackedFile() { Unmap(); }
+
+        bool Map(char const* filename);
+        void Unmap();
+        bool IsMapped() const { return m_base != nullptr; }
+
+        // nullptr if the map has no tile there
+        char const* GetTile(uint32 x, uint32 y, uint32& size) const;
+
+        // asks the system to read the pages of the tile ahead, for grids preloaded on other threads
+        void Prefetch(uint32 x, uint32 y) const;
+
+        // reads the header of a packed map file without mapping it, false if missing or not compatible
+        static bool ReadHeader(char const* filename, GridMapPackedHeader& header);
+
+    private:
+        GridMapPackedFile(GridMapPackedFile const&);
+        GridMapPackedFile& operator=(GridMapPackedFile const&);
+
+        GridMapPackedHeader const* GetHeader() const { return reinterpret_cast<GridMapPackedHeader const*>(m_base); }
+
+        char* m_base;
+        size_t m_size;
+};
+
 template<typename Countable>
 class Referencable
 {
@@ -167,6 +216,10 @@ class TerrainInfo : public Referencable<std::atomic_long>
         bool GetAreaInfo(float x, float y, float z, uint32& flags, int32& adtId, int32& rootId, int32& groupId) const;
         bool IsOutdoors(float x, float y, float z) const;
 
+        // changed whenever the terrain or vmap tile is loaded or unloaded, for results of queries kept by maps:
+        // generation of the tile of a point, and a combined one of all tiles of the rectangle spanned by two points
+        uint32 GetGeneration(float x, float y) const;
+        uint32 GetGeneration(float x1, float y1, float x2, float y2) const;
 
         // this method should be used only by TerrainManager
         // to cleanup unreferenced GridMap objects - they are too heavy
@@ -174,12 +227,17 @@ class TerrainInfo : public Referencable<std::atomic_long>
         // THIS METHOD IS NOT THREAD-SAFE!!!! AND IT SHOULDN'T BE THREAD-SAFE!!!!
         void CleanUpGrids(const uint32 diff);
 
+        // file reading part of loading a grid, run by grid preload threads on a grid referenced by the requesting map
+        void PreloadGrid(const uint32 x, const uint32 y, MMAP::MMapTileData& navTile);
+
     protected:
         friend class Map;
         friend class ObjectMgr;
         // load/unload terrain data
         GridMap* Load(const uint32 x, const uint32 y, bool mapOnly = false);
         void Unload(const uint32 x, const uint32 y);
+        // adds the vmap tile and the preloaded navmesh tile, in the map thread
+        void FinishPreloadGrid(const uint32 x, const uint32 y, MMAP::MMapTileData& navTile);
 
     private:
         TerrainInfo(const TerrainInfo&);
@@ -187,13 +245,20 @@ class TerrainInfo : public Referencable<std::atomic_long>
 
         GridMap* GetGrid(const float x, const float y, bool loadOnlyMap = false);
         GridMap* LoadMapAndVMap(const uint32 x, const uint32 y, bool mapOnly = false);
+        void LoadGridMap(const uint32 x, const uint32 y);
+        void LoadVMap(const uint32 x, const uint32 y);
+        void LoadNavTile(const uint32 x, const uint32 y, MMAP::MMapTileData* navTile);
 
         int RefGrid(const uint32& x, const uint32& y);
         int UnrefGrid(const uint32& x, const uint32& y);
 
         const uint32 m_mapId;
 
+        // tiles of the map when extracted into a packed map file, the .map files are read otherwise
+        GridMapPackedFile m_packedMap;
+
         GridMap* m_GridMaps[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
+        std::atomic<uint32> m_generations[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
         int16 m_GridRef[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
 
         // global garbage collection timer
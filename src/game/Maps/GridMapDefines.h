@@ -16,6 +16,29 @@ struct GridMapFileHeader
     uint32 holesSize;
 };
 
+// all tiles of a map in one file, made by the extractor from the .map files, mapped into memory by the server
+#define PACKED_MAP_MAGIC        0x50414D50                  // 'PMAP'
+#define PACKED_MAP_VERSION      1
+#define PACKED_MAP_GRIDS        64
+#define PACKED_MAP_PAGE_SIZE    4096                        // tiles start at a page, so each is paged in on its own
+#define PACKED_MAP_SECTION_ALIGN 16                         // sections in a tile start aligned, their arrays are used in place
+
+struct GridMapPackedTile
+{
+    uint32 offset;                                          // from the file start, 0 for no tile
+    uint32 size;
+};
+
+struct GridMapPackedHeader
+{
+    uint32 magic;
+    uint32 version;
+    uint32 tileVersionMagic;                                // versionMagic of the packed .map tiles
+    uint32 tileCount;
+    uint64 fileSize;
+    GridMapPackedTile tiles[PACKED_MAP_GRIDS][PACKED_MAP_GRIDS]; // by grid x, y as in the tile file names
+};
+
 #define MAP_AREA_NO_AREA      0x0001
 
 struct GridMapAreaHeader
@@ -33,11 +33,23 @@
 #include "Server/DBCEnums.h"
 #include "Maps/MapPersistentStateMgr.h"
 #include "VMapFactory.h"
+#include "vmap/GameObjectModel.h"
 #include "MotionGenerators/MoveMap.h"
+#include "MotionGenerators/PathRequestQueue.h"
+#include "Maps/TerrainQueryCache.h"
 #include "Chat/Chat.h"
 #include "Weather/Weather.h"
 #include "Grids/ObjectGridLoader.h"
 #include "AI/ScriptDevAI/ScriptDevAIMgr.h"
+#include "Maps/MapWorkers.h"
+#include "Movement/MoveSpline.h"
+
+// grids whose preloaded terrain is linked and objects are loaded at the start of one map update
+#define GRID_PRELOADS_PER_UPDATE  1
+// grids of one map being read or waiting to be linked at a time
+#define MAX_PENDING_GRID_PRELOADS 8
+
+thread_local MapUpdateRegion* Map::m_currentUpdateRegion = nullptr;
 
 Map::~Map()
 {
@@ -52,8 +64,19 @@ Map::~Map()
     delete i_data;
     i_data = nullptr;
 
-    // unload instance specific navigation data
-    MMAP::MMapFactory::createOrGetMMapManager()->unloadMapInstance(m_TerrainData->GetMapId(), GetInstanceId());
+    // preload threads may still be reading grids of this map
+    for (auto& request : m_gridPreloads)
+    {
+        request->read.wait();
+        m_TerrainData->UnrefGrid(request->terrainX, request->terrainY);
+    }
+    m_gridPreloads.clear();
+
+    uint64 hits, misses;
+    m_terrainQueries->GetStats(hits, misses);
+    if (hits + misses)
+        DETAIL_LOG("Map %u (instance %u): " UI64FMTD " line of sight and height queries answered from cache, " UI64FMTD " calculated",
+                   i_id, i_InstanceId, hits, misses);
 
     // release reference count
     if (m_TerrainData->Release())
@@ -97,6 +120,11 @@ Map::Map(uint32 id, time_t expiry, uint32 InstanceId)
 	  
 {
     m_weatherSystem = new WeatherSystem(this);
+
+    if (sWorld.getConfig(CONFIG_UINT32_NUM_PATHFINDING_THREADS))
+        m_pathRequests.reset(new PathRequestQueue);
+
+    m_terrainQueries.reset(new TerrainQueryCache(i_mapEntry && i_mapEntry->IsContinent() ? TERRAIN_QUERY_CACHE_SIZE_WORLD : TERRAIN_QUERY_CACHE_SIZE));
 }
 
 void Map::Initialize(bool loadInstanceData /*= true*/)
@@ -367,6 +395,20 @@ Map::Add(T* obj)
     obj->SetMap(this);
 
     Cell cell(p);
+
+    // a region worker only changes the cells of its own grid and never creates or loads grids, objects it
+    // spawns anywhere else enter at the merge point. Inside the grid they enter at once, so summoners can
+    // use them right away, only the map wide containers they are registered in wait for the merge point
+    if (m_currentUpdateRegion && m_currentUpdateRegion->map == this)
+    {
+        GridPair gridPair(cell.GridX(), cell.GridY());
+        if (gridPair != m_currentUpdateRegion->grid || !isGridObjectDataLoaded(gridPair.x_coord, gridPair.y_coord))
+        {
+            DeferToRegionMerge([obj](Map* map) { map->Add(obj); });
+            return;
+        }
+    }
+
     if (obj->isActiveObject())
         EnsureGridLoadedAtEnter(cell);
     else
@@ -547,7 +589,7 @@ bool Map::loaded(const GridPair& p) const
     return (getNGrid(p.x_coord, p.y_coord) && isGridObjectDataLoaded(p.x_coord, p.y_coord));
 }
 
-void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<MaNGOS::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<MaNGOS::ObjectUpdater, WorldTypeMapContainer> &worldVisitor)
+void Map::MarkNearbyCellsOf(WorldObject* obj, std::vector<Cell>& cells)
 {
     // lets update mobs/objects in ALL visible cells around player!
     CellArea area = Cell::CalculateCellArea(obj->GetPositionX(), obj->GetPositionY(), GetVisibilityDistance());
@@ -565,8 +607,7 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<MaNGOS::Obje
                 CellPair pair(x, y);
                 Cell cell(pair);
                 cell.SetNoCreate();
-                Visit(cell, gridVisitor);
-                Visit(cell, worldVisitor);
+                cells.push_back(cell);
             }
         }
     }
@@ -574,6 +615,8 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<MaNGOS::Obje
 
 void Map::Update(const uint32& t_diff)
 {
+    UpdateGridPreloads();
+
     m_dyn_tree.update(t_diff);
 
     /// update worldsessions for existing players
@@ -608,10 +651,7 @@ void Map::Update(const uint32& t_diff)
         m_messageVector.clear();
     }
 
-    WorldObjectUnSet objToUpdate;
-    MaNGOS::ObjectUpdater obj_updater(objToUpdate);
-    TypeContainerVisitor<MaNGOS::ObjectUpdater, GridTypeMapContainer  > grid_object_update(obj_updater);    // For creature
-    TypeContainerVisitor<MaNGOS::ObjectUpdater, WorldTypeMapContainer > world_object_update(obj_updater);   // For pets
+    std::vector<Cell> activeCells;
 
     // the player iterator is stored in the map object
     // to make sure calls to Map::Remove don't invalidate it
@@ -621,11 +661,11 @@ void Map::Update(const uint32& t_diff)
         if (!player->IsInWorld() || !player->IsPositionValid())
             continue;
 
-        VisitNearbyCellsOf(player, grid_object_update, world_object_update);
+        MarkNearbyCellsOf(player, activeCells);
 
         // If player is using far sight, visit that object too
         if (WorldObject* viewPoint = GetWorldObject(player->GetFarSightGuid()))
-            VisitNearbyCellsOf(viewPoint, grid_object_update, world_object_update);
+            MarkNearbyCellsOf(viewPoint, activeCells);
     }
 
     // non-player active objects
@@ -643,33 +683,33 @@ void Map::Update(const uint32& t_diff)
             if (!obj->IsInWorld() || !obj->IsPositionValid())
                 continue;
 
-            // lets update mobs/objects in ALL visible cells around player!
-            CellArea area = Cell::CalculateCellArea(obj->GetPositionX(), obj->GetPositionY(), GetVisibilityDistance());
+            MarkNearbyCellsOf(obj, activeCells);
+        }
+    }
 
-            for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
-            {
-                for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
-                {
-                    // marked cells are those that have been visited
-                    // don't visit the same cell twice
-                    uint32 cell_id = (y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x;
-                    if (!isCellMarked(cell_id))
-                    {
-                        markCell(cell_id);
-                        CellPair pair(x, y);
-                        Cell cell(pair);
-                        cell.SetNoCreate();
-                        Visit(cell, grid_object_update);
-                        Visit(cell, world_object_update);
-                    }
-                }
-            }
+    if (IsContinent() && sMapMgr.GetRegionUpdater().activated())
+        UpdateRegions(activeCells, t_diff);
+    else
+    {
+        WorldObjectUnSet objToUpdate;
+        MaNGOS::ObjectUpdater obj_updater(objToUpdate);
+        TypeContainerVisitor<MaNGOS::ObjectUpdater, GridTypeMapContainer  > grid_object_update(obj_updater);    // For creature
+        TypeContainerVisitor<MaNGOS::ObjectUpdater, WorldTypeMapContainer > world_object_update(obj_updater);   // For pets
+
+        for (Cell const& cell : activeCells)
+        {
+            Visit(cell, grid_object_update);
+            Visit(cell, world_object_update);
         }
+
+        // update all objects
+        for (auto wObj : objToUpdate)
+            wObj->Update(t_diff);
     }
 
-    // update all objects
-    for (auto wObj : objToUpdate)
-        wObj->Update(t_diff);
+    // paths requested by the objects are picked up at their next update
+    if (m_pathRequests)
+        m_pathRequests->Process();
 
     // Send world objects and item update field changes
     SendObjectUpdates();
@@ -698,6 +738,182 @@ void Map::Update(const uint32& t_diff)
     m_weatherSystem->UpdateWeathers(t_diff);
 }
 
+void Map::UpdateGridPreloads()
+{
+    MapUpdater& preloader = sMapMgr.GetGridPreloader();
+    if (!preloader.activated() || !IsContinent())
+        return;
+
+    // link grids read by the preloader, object loading is kept to a few grids per update
+    uint32 finished = 0;
+    for (auto itr = m_gridPreloads.begin(); itr != m_gridPreloads.end() && finished < GRID_PRELOADS_PER_UPDATE;)
+    {
+        if ((*itr)->read.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            ++itr;
+            continue;
+        }
+
+        FinishGridPreload(**itr);
+        itr = m_gridPreloads.erase(itr);
+        ++finished;
+    }
+
+    uint32 lookahead = sWorld.getConfig(CONFIG_UINT32_GRID_PRELOAD_LOOKAHEAD);
+    for (MapRefManager::iterator itr = m_mapRefManager.begin(); itr != m_mapRefManager.end(); ++itr)
+    {
+        Player* player = itr->getSource();
+        if (!player || !player->IsInWorld())
+            continue;
+
+        if (player->IsTaxiFlying())
+        {
+            // flight paths are known, request the grids of the nodes reached within the lookahead
+            Movement::MoveSpline const& movespline = *player->movespline;
+            if (!movespline.Initialized() || movespline.Finalized())
+                continue;
+
+            Movement::Spline<int32> const& path = movespline._Spline();
+            int32 current = movespline._currentSplineIdx();
+            for (int32 i = current + 1; i <= path.last() && path.length(current, i) <= int32(lookahead); ++i)
+                RequestGridPreload(MaNGOS::ComputeGridPair(path.getPoint(i).x, path.getPoint(i).y));
+        }
+        else if (player->m_movementInfo.HasMovementFlag(MovementFlags(MOVEFLAG_FORWARD | MOVEFLAG_BACKWARD)))
+        {
+            // straight ahead at the current run speed (mounted included), sampled twice per grid length
+            float distance = player->GetSpeed(MOVE_RUN) * lookahead / IN_MILLISECONDS;
+            float angle = player->GetOrientation();
+            if (player->m_movementInfo.HasMovementFlag(MOVEFLAG_BACKWARD))
+                angle += M_PI_F;
+
+            for (float dist = SIZE_OF_GRIDS / 2; dist < distance + SIZE_OF_GRIDS / 2; dist += SIZE_OF_GRIDS / 2)
+            {
+                float x = player->GetPositionX() + std::min(dist, distance) * cos(angle);
+                float y = player->GetPositionY() + std::min(dist, distance) * sin(angle);
+                if (!MaNGOS::IsValidMapCoord(x, y))
+                    break;
+
+                RequestGridPreload(MaNGOS::ComputeGridPair(x, y));
+            }
+        }
+    }
+}
+
+void Map::RequestGridPreload(GridPair const& p)
+{
+    if (p.x_coord >= MAX_NUMBER_OF_GRIDS || p.y_coord >= MAX_NUMBER_OF_GRIDS || loaded(p))
+        return;
+
+    if (m_gridPreloads.size() >= MAX_PENDING_GRID_PRELOADS)
+        return;
+
+    for (auto const& request : m_gridPreloads)
+        if (request->grid == p)
+            return;
+
+    GridPreloadRequest* request = new GridPreloadRequest(p);
+    m_gridPreloads.push_back(std::unique_ptr<GridPreloadRequest>(request));
+
+    // keeps the read terrain from being cleaned up before the grid is linked
+    m_TerrainData->RefGrid(request->terrainX, request->terrainY);
+
+    MapUpdater& preloader = sMapMgr.GetGridPreloader();
+    preloader.schedule_specific(new GridPreloadWorker(*m_TerrainData, *request, preloader));
+}
+
+void Map::FinishGridPreload(GridPreloadRequest& request)
+{
+    // the grid may have been entered while it was read
+    if (!loaded(request.grid))
+    {
+        DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Preloaded grid[%u,%u] on map %u", request.grid.x_coord, request.grid.y_coord, i_id);
+
+        m_TerrainData->FinishPreloadGrid(request.terrainX, request.terrainY, request.navTile);
+
+        // creatures and gameobjects are created in the map thread, before any player reaches the grid
+        Cell cell(CellPair(request.grid.x_coord * MAX_NUMBER_OF_CELLS, request.grid.y_coord * MAX_NUMBER_OF_CELLS));
+        EnsureGridLoaded(cell);
+    }
+
+    m_TerrainData->UnrefGrid(request.terrainX, request.terrainY);
+}
+
+void Map::UpdateRegions(std::vector<Cell> const& cells, uint32 diff)
+{
+    MapUpdater& updater = sMapMgr.GetRegionUpdater();
+
+    // one region per grid, grids are split in 4 phases so that regions updated at the same time
+    // are always separated by a whole grid, more than any visibility or interaction distance
+    std::map<uint32, MapUpdateRegion> regions;
+    for (Cell const& cell : cells)
+    {
+        uint32 gridId = cell.GridY() * MAX_NUMBER_OF_GRIDS + cell.GridX();
+        auto itr = regions.find(gridId);
+        if (itr == regions.end())
+            itr = regions.insert(std::make_pair(gridId, MapUpdateRegion(this, GridPair(cell.GridX(), cell.GridY())))).first;
+
+        itr->second.cells.push_back(cell);
+    }
+
+    // the region updater is shared by all continents, only wait for the workers of this map
+    std::vector<std::promise<void>> crawled(regions.size());
+    std::vector<std::future<void>> crawledFutures;
+    crawledFutures.reserve(regions.size());
+    for (std::promise<void>& done : crawled)
+        crawledFutures.push_back(done.get_future());
+
+    // collect objects, cell containers are only read at this stage
+    size_t index = 0;
+    for (auto& region : regions)
+        updater.schedule_specific(new GridCrawler(*this, region.second.cells, region.second.objects, crawled[index++], updater));
+    for (std::future<void>& future : crawledFutures)
+        future.wait();
+
+    for (uint32 phase = 0; phase < 4; ++phase)
+    {
+        std::vector<MapUpdateRegion*> phaseRegions;
+        for (auto& region : regions)
+        {
+            uint32 gridX = region.first % MAX_NUMBER_OF_GRIDS;
+            uint32 gridY = region.first / MAX_NUMBER_OF_GRIDS;
+            if (((gridX & 1) | ((gridY & 1) << 1)) == phase)
+                phaseRegions.push_back(&region.second);
+        }
+
+        if (phaseRegions.empty())
+            continue;
+
+        std::vector<std::promise<void>> updated(phaseRegions.size());
+        std::vector<std::future<void>> updatedFutures;
+        updatedFutures.reserve(phaseRegions.size());
+        for (std::promise<void>& done : updated)
+            updatedFutures.push_back(done.get_future());
+
+        for (size_t i = 0; i < phaseRegions.size(); ++i)
+            updater.schedule_specific(new ObjectUpdateWorker(*phaseRegions[i], diff, updated[i], updater));
+        for (std::future<void>& future : updatedFutures)
+            future.wait();
+
+        // merge point: apply cross-region side effects in this thread, in region order
+        for (MapUpdateRegion* region : phaseRegions)
+        {
+            for (auto& message : region->deferred)
+                message(this);
+
+            region->deferred.clear();
+        }
+    }
+}
+
+bool Map::DeferToRegionMerge(const std::function<void(Map*)>& message)
+{
+    if (!m_currentUpdateRegion || m_currentUpdateRegion->map != this)
+        return false;
+
+    m_currentUpdateRegion->deferred.push_back(message);
+    return true;
+}
+
 void Map::Remove(Player* player, bool remove)
 {
     if (i_data)
@@ -835,6 +1051,18 @@ void Map::CreatureRelocation(Creature* creature, float x, float y, float z, floa
 {
     Cell new_cell(MaNGOS::ComputeCellPair(x, y));
 
+    // leaving the grid of a region worker touches cells owned by another region, delay to the merge point
+    if (m_currentUpdateRegion && creature->GetCurrentCell().DiffGrid(new_cell))
+    {
+        ObjectGuid guid = creature->GetObjectGuid();
+        if (DeferToRegionMerge([guid, x, y, z, ang](Map* map)
+        {
+            if (Creature* pCreature = map->GetAnyTypeCreature(guid))
+                map->CreatureRelocation(pCreature, x, y, z, ang);
+        }))
+            return;
+    }
+
     // do move or do move to respawn or remove creature if previous all fail
     if (CreatureCellRelocation(creature, new_cell))
     {
@@ -1068,6 +1296,10 @@ void Map::AddObjectToRemoveList(WorldObject* obj)
 {
     MANGOS_ASSERT(obj->GetMapId() == GetId() && obj->GetInstanceId() == GetInstanceId());
 
+    // cleanup touches cross referenced objects that may belong to another region, delay to the merge point
+    if (m_currentUpdateRegion && DeferToRegionMerge([obj](Map* map) { map->AddObjectToRemoveList(obj); }))
+        return;
+
     obj->CleanupsBeforeDelete();                            // remove or simplify at least cross referenced links
 
     i_objectsToRemove.insert(obj);
@@ -1176,8 +1408,9 @@ uint32 Map::GetPlayersCountExceptGMs() const
 
 void Map::SendToPlayers(WorldPacket const& data) const
 {
+    SharedPacketContents contents;
     for (const auto& itr : m_mapRefManager)
-        itr.getSource()->GetSession()->SendPacket(data);
+        itr.getSource()->GetSession()->SendPacket(data, contents);
 }
 
 bool Map::SendToPlayersInZone(WorldPacket const& data, uint32 zoneId) const
@@ -1234,6 +1467,9 @@ bool Map::ActiveObjectsNearGrid(uint32 x, uint32 y) const
 
 void Map::AddToActive(WorldObject* obj)
 {
+    if (m_currentUpdateRegion && DeferToRegionMerge([obj](Map* map) { map->AddToActive(obj); }))
+        return;
+
     m_activeNonPlayers.insert(obj);
     Cell cell = Cell(MaNGOS::ComputeCellPair(obj->GetPositionX(), obj->GetPositionY()));
     EnsureGridLoaded(cell);
@@ -1262,6 +1498,9 @@ void Map::AddToActive(WorldObject* obj)
 
 void Map::RemoveFromActive(WorldObject* obj)
 {
+    if (m_currentUpdateRegion && DeferToRegionMerge([obj](Map* map) { map->RemoveFromActive(obj); }))
+        return;
+
     // Map::Update for active object in proccess
     if (m_activeNonPlayersIter != m_activeNonPlayers.end())
     {
@@ -1297,11 +1536,17 @@ void Map::RemoveFromActive(WorldObject* obj)
 
 void Map::AddToOnEventNotified(WorldObject* obj)
 {
+    if (m_currentUpdateRegion && DeferToRegionMerge([obj](Map* map) { map->AddToOnEventNotified(obj); }))
+        return;
+
     m_onEventNotifiedObjects.insert(obj);
 }
 
 void Map::RemoveFromOnEventNotified(WorldObject* obj)
 {
+    if (m_currentUpdateRegion && DeferToRegionMerge([obj](Map* map) { map->RemoveFromOnEventNotified(obj); }))
+        return;
+
     if (m_onEventNotifiedIter != m_onEventNotifiedObjects.end())
     {
         auto itr = m_onEventNotifiedObjects.find(obj);
@@ -1803,33 +2048,45 @@ bool Map::ScriptsStart(ScriptMapMapName const& scripts, uint32 id, Object* sourc
     ObjectGuid sourceGuid = source->GetObjectGuid();
     ObjectGuid targetGuid = target ? target->GetObjectGuid() : ObjectGuid();
     ObjectGuid ownerGuid  = source->isType(TYPEMASK_ITEM) ? ((Item*)source)->GetOwnerGuid() : ObjectGuid();
+    char const* tableName = scripts.first;
+    ScriptMap const* scriptMap = &(s->second);
+
+    // the schedule is shared by all regions, scripts started by a region are scheduled at the merge point
+    if (m_currentUpdateRegion && DeferToRegionMerge([tableName, id, scriptMap, sourceGuid, targetGuid, ownerGuid, execParams](Map* map)
+    {
+        map->ScheduleScripts(tableName, id, *scriptMap, sourceGuid, targetGuid, ownerGuid, execParams);
+    }))
+        return true;
 
+    ScheduleScripts(tableName, id, *scriptMap, sourceGuid, targetGuid, ownerGuid, execParams);
+    return true;
+}
+
+void Map::ScheduleScripts(char const* tableName, uint32 id, ScriptMap const& scriptMap, ObjectGuid sourceGuid, ObjectGuid targetGuid, ObjectGuid ownerGuid, ScriptExecutionParam execParams)
+{
     if (execParams)                                         // Check if the execution should be uniquely
     {
         for (ScriptScheduleMap::const_iterator searchItr = m_scriptSchedule.begin(); searchItr != m_scriptSchedule.end(); ++searchItr)
         {
-            if (searchItr->second.IsSameScript(scripts.first, id,
+            if (searchItr->second.IsSameScript(tableName, id,
                                                execParams & SCRIPT_EXEC_PARAM_UNIQUE_BY_SOURCE ? sourceGuid : ObjectGuid(),
                                                execParams & SCRIPT_EXEC_PARAM_UNIQUE_BY_TARGET ? targetGuid : ObjectGuid(), ownerGuid))
             {
-                DEBUG_LOG("DB-SCRIPTS: Process table `%s` id %u. Skip script as script already started for source %s, target %s - ScriptsStartParams %u", scripts.first, id, sourceGuid.GetString().c_str(), targetGuid.GetString().c_str(), execParams);
-                return true;
+                DEBUG_LOG("DB-SCRIPTS: Process table `%s` id %u. Skip script as script already started for source %s, target %s - ScriptsStartParams %u", tableName, id, sourceGuid.GetString().c_str(), targetGuid.GetString().c_str(), execParams);
+                return;
             }
         }
     }
 
     ///- Schedule script execution for all scripts in the script map
-    ScriptMap const* s2 = &(s->second);
-    for (const auto& iter : *s2)
+    for (const auto& iter : scriptMap)
     {
-        ScriptAction sa(scripts.first, this, sourceGuid, targetGuid, ownerGuid, &iter.second);
+        ScriptAction sa(tableName, this, sourceGuid, targetGuid, ownerGuid, &iter.second);
 
         m_scriptSchedule.insert(ScriptScheduleMap::value_type(time_t(sWorld.GetGameTime() + iter.first), sa));
 
         sScriptMgr.IncreaseScheduledScriptsCount();
     }
-
-    return true;
 }
 
 void Map::ScriptCommandStart(ScriptInfo const& script, uint32 delay, Object* source, Object* target)
@@ -1843,6 +2100,13 @@ void Map::ScriptCommandStart(ScriptInfo const& script, uint32 delay, Object* sou
 
     ScriptAction sa("Internal Activate Command used for spell", this, sourceGuid, targetGuid, ownerGuid, &script);
 
+    if (m_currentUpdateRegion && DeferToRegionMerge([sa, delay](Map* map)
+    {
+        map->m_scriptSchedule.insert(ScriptScheduleMap::value_type(time_t(sWorld.GetGameTime() + delay), sa));
+        sScriptMgr.IncreaseScheduledScriptsCount();
+    }))
+        return;
+
     m_scriptSchedule.insert(ScriptScheduleMap::value_type(time_t(sWorld.GetGameTime() + delay), sa));
 
     sScriptMgr.IncreaseScheduledScriptsCount();
@@ -1910,7 +2174,7 @@ Player* Map::GetPlayer(ObjectGuid guid)
  */
 Creature* Map::GetCreature(ObjectGuid guid)
 {
-    return m_objectsStore.find<Creature>(guid, (Creature*)nullptr);
+    return FindObject<Creature>(guid);
 }
 
 /**
@@ -1920,7 +2184,7 @@ Creature* Map::GetCreature(ObjectGuid guid)
  */
 Pet* Map::GetPet(ObjectGuid guid)
 {
-    return m_objectsStore.find<Pet>(guid, (Pet*)nullptr);
+    return FindObject<Pet>(guid);
 }
 
 /**
@@ -1960,7 +2224,7 @@ Creature* Map::GetAnyTypeCreature(ObjectGuid guid)
  */
 GameObject* Map::GetGameObject(ObjectGuid guid)
 {
-    return m_objectsStore.find<GameObject>(guid, (GameObject*)nullptr);
+    return FindObject<GameObject>(guid);
 }
 
 /**
@@ -1970,7 +2234,7 @@ GameObject* Map::GetGameObject(ObjectGuid guid)
  */
 DynamicObject* Map::GetDynamicObject(ObjectGuid guid)
 {
-    return m_objectsStore.find<DynamicObject>(guid, (DynamicObject*)nullptr);
+    return FindObject<DynamicObject>(guid);
 }
 
 /**
@@ -2158,8 +2422,20 @@ void Map::PlayDirectSoundToMap(uint32 soundId, uint32 zoneId /*=0*/) const
  */
 bool Map::IsInLineOfSight(float srcX, float srcY, float srcZ, float destX, float destY, float destZ, bool ignoreM2Model) const
 {
-    return VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), srcX, srcY, srcZ, destX, destY, destZ, ignoreM2Model)
-           && m_dyn_tree.isInLineOfSight(srcX, srcY, srcZ, destX, destY, destZ);
+    // generations are taken before the calculation, a tile loaded meanwhile makes the stored result stale
+    TerrainQueryKey key = TerrainQueryKey::LineOfSight(srcX, srcY, srcZ, destX, destY, destZ, ignoreM2Model);
+    uint32 terrainGeneration = m_TerrainData->GetGeneration(srcX, srcY, destX, destY);
+    uint32 modelGeneration = m_terrainQueries->GetModelGeneration(srcX, srcY, destX, destY);
+
+    float cached;
+    if (m_terrainQueries->Find(key, terrainGeneration, modelGeneration, cached))
+        return cached != 0.0f;
+
+    bool result = VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), srcX, srcY, srcZ, destX, destY, destZ, ignoreM2Model)
+                  && m_dyn_tree.isInLineOfSight(srcX, srcY, srcZ, destX, destY, destZ);
+
+    m_terrainQueries->Store(key, terrainGeneration, modelGeneration, result ? 1.0f : 0.0f);
+    return result;
 }
 
 /**
@@ -2248,21 +2524,53 @@ bool Map::GetHeightInRange(float x, float y, float& z, float maxSearchDist /*= 4
 
 float Map::GetHeight(float x, float y, float z) const
 {
+    TerrainQueryKey key = TerrainQueryKey::Height(x, y, z);
+    uint32 terrainGeneration = m_TerrainData->GetGeneration(x, y);
+    uint32 modelGeneration = m_terrainQueries->GetModelGeneration(x, y);
+
+    float height;
+    if (m_terrainQueries->Find(key, terrainGeneration, modelGeneration, height))
+        return height;
+
     float staticHeight = m_TerrainData->GetHeightStatic(x, y, z);
 
     // Get Dynamic Height around static Height (if valid)
     float dynSearchHeight = 2.0f + (z < staticHeight ? staticHeight : z);
-    return std::max<float>(staticHeight, m_dyn_tree.getHeight(x, y, dynSearchHeight, dynSearchHeight - staticHeight));
+    height = std::max<float>(staticHeight, m_dyn_tree.getHeight(x, y, dynSearchHeight, dynSearchHeight - staticHeight));
+
+    m_terrainQueries->Store(key, terrainGeneration, modelGeneration, height);
+    return height;
 }
 
 void Map::InsertGameObjectModel(const GameObjectModel& mdl)
 {
+    // the model tree is read by all regions, models live as long as their gameobject, which is only deleted after the merge point
+    if (m_currentUpdateRegion && DeferToRegionMerge([&mdl](Map* map) { map->InsertGameObjectModel(mdl); }))
+        return;
+
     m_dyn_tree.insert(mdl);
+    InvalidateModelQueries(mdl);
 }
 
 void Map::RemoveGameObjectModel(const GameObjectModel& mdl)
 {
+    if (m_currentUpdateRegion && DeferToRegionMerge([&mdl](Map* map) { map->RemoveGameObjectModel(mdl); }))
+        return;
+
     m_dyn_tree.remove(mdl);
+    InvalidateModelQueries(mdl);
+}
+
+void Map::EnableGameObjectModel(GameObjectModel& mdl, bool enable)
+{
+    mdl.enable(enable);
+    InvalidateModelQueries(mdl);
+}
+
+void Map::InvalidateModelQueries(const GameObjectModel& mdl)
+{
+    G3D::AABox const& bounds = mdl.getBounds();
+    m_terrainQueries->InvalidateModels(bounds.low().x, bounds.low().y, bounds.high().x, bounds.high().y);
 }
 
 bool Map::ContainsGameObjectModel(const GameObjectModel& mdl) const
@@ -2474,10 +2782,16 @@ uint32 Map::SpawnedCountForEntry(uint32 entry)
 
 void Map::AddToSpawnCount(const ObjectGuid& guid)
 {
+    if (m_currentUpdateRegion && DeferToRegionMerge([guid](Map* map) { map->AddToSpawnCount(guid); }))
+        return;
+
     m_spawnedCount[guid.GetEntry()].insert(guid);
 }
 
 void Map::RemoveFromSpawnCount(const ObjectGuid& guid)
 {
+    if (m_currentUpdateRegion && DeferToRegionMerge([guid](Map* map) { map->RemoveFromSpawnCount(guid); }))
+        return;
+
     m_spawnedCount[guid.GetEntry()].erase(guid);
 }
@@ -38,6 +38,7 @@
 #include <bitset>
 #include <functional>
 #include <list>
+#include <memory>
 
 struct CreatureInfo;
 class Creature;
@@ -54,6 +55,9 @@ class BattleGround;
 class GridMap;
 class GameObjectModel;
 class WeatherSystem;
+struct GridPreloadRequest;
+class PathRequestQueue;
+class TerrainQueryCache;
 namespace MaNGOS { struct ObjectUpdater; }
 
 // GCC have alternative #pragma pack(N) syntax and old gcc version not support pack(push,N), also any gcc version not support it at some platform
@@ -93,6 +97,19 @@ struct WorldTemplate
 
 #define MIN_UNLOAD_DELAY      1                             // immediate unload
 
+// Part of a continent updated by one worker during a region update (see Map::UpdateRegions)
+struct MapUpdateRegion
+{
+    MapUpdateRegion(Map* map, GridPair const& grid) : map(map), grid(grid) {}
+
+    Map* map;
+    GridPair grid;                                          // the only grid the worker of the region changes
+    std::vector<Cell> cells;                                // marked active cells inside the region
+    WorldObjectUnSet objects;                               // filled by GridCrawler
+    std::vector<std::function<void(Map*)>> deferred;        // cross-region side effects, applied at the merge point
+    TypeUnorderedMapContainer<AllMapStoredObjectTypes, ObjectGuid> objectsStore;    // objects entered by the region, moved to the map store at the merge point
+};
+
 class Map : public GridRefManager<NGridType>
 {
         friend class MapReference;
@@ -122,7 +139,7 @@ class Map : public GridRefManager<NGridType>
 
         static void DeleteFromWorld(Player* pl);        // player object will deleted at call
 
-        void VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<MaNGOS::ObjectUpdater, GridTypeMapContainer> &gridVisitor, TypeContainerVisitor<MaNGOS::ObjectUpdater, WorldTypeMapContainer> &worldVisitor);
+        void MarkNearbyCellsOf(WorldObject* obj, std::vector<Cell>& cells);
         virtual void Update(const uint32&);
 
         void MessageBroadcast(Player const*, WorldPacket const&, bool to_self);
@@ -251,24 +268,74 @@ class Map : public GridRefManager<NGridType>
         WorldObject* GetWorldObject(ObjectGuid guid);       // only use if sure that need objects at current map, specially for player case
 
         typedef TypeUnorderedMapContainer<AllMapStoredObjectTypes, ObjectGuid> MapStoredObjectTypesContainer;
-        MapStoredObjectTypesContainer& GetObjectsStore() { return m_objectsStore; }
+
+        // register objects for guid lookup, the store is read by all regions of a continent at once so
+        // objects entering in a region are only found by that region until its merge point
+        template<class T>
+        void InsertObject(ObjectGuid const& guid, T* obj)
+        {
+            if (m_currentUpdateRegion && m_currentUpdateRegion->map == this)
+            {
+                MapUpdateRegion* region = m_currentUpdateRegion;
+                region->objectsStore.insert<T>(guid, obj);
+                DeferToRegionMerge([region, guid](Map* map)
+                {
+                    if (T* entered = region->objectsStore.find<T>(guid, (T*)nullptr))
+                        map->m_objectsStore.insert<T>(guid, entered);
+                });
+                return;
+            }
+
+            m_objectsStore.insert<T>(guid, obj);
+        }
+
+        template<class T>
+        void EraseObject(ObjectGuid const& guid)
+        {
+            if (m_currentUpdateRegion && m_currentUpdateRegion->map == this)
+            {
+                if (m_currentUpdateRegion->objectsStore.find<T>(guid, (T*)nullptr))
+                    m_currentUpdateRegion->objectsStore.erase<T>(guid, (T*)nullptr);
+                else
+                    DeferToRegionMerge([guid](Map* map) { map->m_objectsStore.erase<T>(guid, (T*)nullptr); });
+                return;
+            }
+
+            m_objectsStore.erase<T>(guid, (T*)nullptr);
+        }
 
         void AddUpdateObject(Object* obj)
         {
+            if (m_currentUpdateRegion && DeferToRegionMerge([obj](Map* map) { map->i_objectsToClientUpdate.insert(obj); }))
+                return;
+
             i_objectsToClientUpdate.insert(obj);
         }
 
         void RemoveUpdateObject(Object* obj)
         {
+            if (m_currentUpdateRegion && DeferToRegionMerge([obj](Map* map) { map->i_objectsToClientUpdate.erase(obj); }))
+                return;
+
             i_objectsToClientUpdate.erase(obj);
         }
 
+        // Queue a side effect of a region worker into its region, applied serially once all regions of the phase are done
+        // Returns false when not called from a region worker of this map, the caller then has to apply it directly
+        // Objects of the map are only deleted by the map thread after the merge point and may be held by pointer,
+        // anything that can go away before (items, script sources and targets) has to be held by guid
+        bool DeferToRegionMerge(const std::function<void(Map*)>& message);
+        static void SetCurrentUpdateRegion(MapUpdateRegion* region) { m_currentUpdateRegion = region; }
+
         // DynObjects currently
         uint32 GenerateLocalLowGuid(HighGuid guidhigh);
 
         // get corresponding TerrainData object for this particular map
         const TerrainInfo* GetTerrain() const { return m_TerrainData; }
 
+        // paths of movement generators calculated on the path workers, nullptr when they are calculated at once
+        PathRequestQueue* GetPathRequests() const { return m_pathRequests.get(); }
+
         void CreateInstanceData(bool load);
         InstanceData* GetInstanceData() const { return i_data; }
         uint32 GetScriptId() const { return i_script_id; }
@@ -287,6 +354,10 @@ class Map : public GridRefManager<NGridType>
         void InsertGameObjectModel(const GameObjectModel& mdl);
         void RemoveGameObjectModel(const GameObjectModel& mdl);
         bool ContainsGameObjectModel(const GameObjectModel& mdl) const;
+        // collision of a door or other gameobject changing with its state
+        void EnableGameObjectModel(GameObjectModel& mdl, bool enable);
+
+        TerrainQueryCache const& GetTerrainQueries() const { return *m_terrainQueries; }
 
         // Get Holder for Creature Linking
         CreatureLinkingHolder* GetCreatureLinkingHolder() { return &m_creatureLinkingHolder; }
@@ -334,6 +405,13 @@ class Map : public GridRefManager<NGridType>
 
         bool CreatureCellRelocation(Creature* c, const Cell& new_cell);
 
+        void UpdateRegions(std::vector<Cell> const& cells, uint32 diff);
+
+        // grids players are about to enter, terrain files read by the grid preloader
+        void UpdateGridPreloads();
+        void RequestGridPreload(GridPair const& p);
+        void FinishGridPreload(GridPreloadRequest& request);
+
 		float m_dungeonscaling = -1.0f;
 		int m_playersInGroup = -1;
 
@@ -356,6 +434,9 @@ class Map : public GridRefManager<NGridType>
 
         void setNGrid(NGridType* grid, uint32 x, uint32 y);
         void ScriptsProcess();
+        // makes the cached terrain queries on the tiles under the model stale
+        void InvalidateModelQueries(const GameObjectModel& mdl);
+        void ScheduleScripts(char const* tableName, uint32 id, ScriptMap const& scriptMap, ObjectGuid sourceGuid, ObjectGuid targetGuid, ObjectGuid ownerGuid, ScriptExecutionParam execParams);
 
         void SendObjectUpdates();
         std::set<Object*> i_objectsToClientUpdate;
@@ -376,6 +457,18 @@ class Map : public GridRefManager<NGridType>
         ActiveNonPlayers::iterator m_activeNonPlayersIter;
         MapStoredObjectTypesContainer m_objectsStore;
 
+        template<class T>
+        T* FindObject(ObjectGuid const& guid)
+        {
+            if (T* obj = m_objectsStore.find<T>(guid, (T*)nullptr))
+                return obj;
+
+            if (m_currentUpdateRegion && m_currentUpdateRegion->map == this)
+                return m_currentUpdateRegion->objectsStore.find<T>(guid, (T*)nullptr);
+
+            return nullptr;
+        }
+
         std::vector<std::function<void(Map*)>> m_messageVector;
         std::mutex m_messageMutex;
 
@@ -393,6 +486,16 @@ class Map : public GridRefManager<NGridType>
 
         std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP* TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
 
+        std::vector<std::unique_ptr<GridPreloadRequest>> m_gridPreloads;
+
+        std::unique_ptr<PathRequestQueue> m_pathRequests;
+
+        // recent line of sight and height results, asked again and again by units standing still
+        std::unique_ptr<TerrainQueryCache> m_terrainQueries;
+
+        // region of this thread while a region worker is running, nullptr otherwise
+        static thread_local MapUpdateRegion* m_currentUpdateRegion;
+
         WorldObjectSet i_objectsToRemove;
 
         typedef std::multimap<time_t, ScriptAction> ScriptScheduleMap;
@@ -502,7 +605,8 @@ Map::Visit(const Cell& cell, TypeContainerVisitor<T, CONTAINER>& visitor)
     const uint32 cell_x = cell.CellX();
     const uint32 cell_y = cell.CellY();
 
-    if (!cell.NoCreate() || loaded(GridPair(x, y)))
+    // regions only visit loaded grids, loading one changes state shared by all regions
+    if ((!cell.NoCreate() && !m_currentUpdateRegion) || loaded(GridPair(x, y)))
     {
         EnsureGridLoaded(cell);
         getNGrid(x, y)->Visit(cell_x, cell_y, visitor);
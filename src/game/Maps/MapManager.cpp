@@ -40,6 +40,11 @@ MapManager::MapManager()
 
 MapManager::~MapManager()
 {
+    m_updater.deactivate();
+    m_regionUpdater.deactivate();
+    m_gridPreloader.deactivate();
+    m_pathUpdater.deactivate();
+
     for (auto& i_map : i_maps)
         delete i_map.second;
 
@@ -55,6 +60,30 @@ MapManager::Initialize()
     InitStateMachine();
     InitMaxInstanceId();
     CreateContinents();
+
+    if (uint32 numThreads = sWorld.getConfig(CONFIG_UINT32_NUM_MAP_THREADS))
+    {
+        m_updater.activate(numThreads);
+        sLog.outString("Map update uses %u worker threads", numThreads);
+    }
+
+    if (uint32 numThreads = sWorld.getConfig(CONFIG_UINT32_NUM_MAP_REGION_THREADS))
+    {
+        m_regionUpdater.activate(numThreads);
+        sLog.outString("Continent region update uses %u worker threads", numThreads);
+    }
+
+    if (uint32 numThreads = sWorld.getConfig(CONFIG_UINT32_NUM_GRID_PRELOAD_THREADS))
+    {
+        m_gridPreloader.activate(numThreads);
+        sLog.outString("Grid preloading uses %u threads", numThreads);
+    }
+
+    if (uint32 numThreads = sWorld.getConfig(CONFIG_UINT32_NUM_PATHFINDING_THREADS))
+    {
+        m_pathUpdater.activate(numThreads);
+        sLog.outString("Creature pathfinding uses %u worker threads", numThreads);
+    }
 }
 
 void MapManager::InitStateMachine()
@@ -191,8 +220,23 @@ void MapManager::Update(uint32 diff)
     if (!i_timer.Passed())
         return;
 
-    for (auto& i_map : i_maps)
-        i_map.second->Update((uint32)i_timer.GetCurrent());
+    if (m_updater.activated())
+    {
+        // maps are processed concurrently. Only the guid and id generators are atomic and only the player and
+        // corpse holders of ObjectAccessor are locked, the rest of the global state (auctions, guilds, groups,
+        // mail, chat channels, ObjectMgr) is not protected at all. Map updates must keep off it, which is why
+        // MapSessionFilter leaves PROCESS_THREADUNSAFE opcodes to World::UpdateSessions
+        for (auto& i_map : i_maps)
+            m_updater.schedule_update(*i_map.second, (uint32)i_timer.GetCurrent());
+
+        // all maps must be finished before transports move between them and maps get unloaded
+        m_updater.wait();
+    }
+    else
+    {
+        for (auto& i_map : i_maps)
+            i_map.second->Update((uint32)i_timer.GetCurrent());
+    }
 
     for (Transport* m_Transport : m_Transports)
         m_Transport->Update((uint32)i_timer.GetCurrent());
@@ -242,6 +286,11 @@ bool MapManager::IsValidMAP(uint32 mapid)
 
 void MapManager::UnloadAll()
 {
+    m_updater.deactivate();
+    m_regionUpdater.deactivate();
+    m_gridPreloader.deactivate();
+    m_pathUpdater.deactivate();
+
     for (auto& i_map : i_maps)
         i_map.second->UnloadAll(true);
 
@@ -23,6 +23,7 @@
 #include "Platform/Define.h"
 #include "Policies/Singleton.h"
 #include "Maps/Map.h"
+#include "Maps/MapUpdater.h"
 #include "Grids/GridStates.h"
 
 class Transport;
@@ -151,6 +152,13 @@ class MapManager : public MaNGOS::Singleton<MapManager, MaNGOS::ClassLevelLockab
 
         template<typename Do> void DoForAllMapsWithMapId(uint32 mapId, Do& _do);
         template<typename Check> inline WorldObject* SearchOnAllLoadedMap(Check& check);
+        // workers used by continents to update their active cells in parallel regions
+        MapUpdater& GetRegionUpdater() { return m_regionUpdater; }
+        // threads reading terrain files of continent grids ahead of players, never waited for by map updates
+        MapUpdater& GetGridPreloader() { return m_gridPreloader; }
+        // workers calculating the paths requested by movement generators at the end of each map update
+        MapUpdater& GetPathUpdater() { return m_pathUpdater; }
+
         void DoForAllMaps(const std::function<void(Map*)>& worker)
         {
             for (MapMapType::const_iterator itr = i_maps.begin(); itr != i_maps.end(); ++itr)
@@ -181,6 +189,10 @@ class MapManager : public MaNGOS::Singleton<MapManager, MaNGOS::ClassLevelLockab
         uint32 i_gridCleanUpDelay;
         MapMapType i_maps;
         IntervalTimer i_timer;
+        MapUpdater m_updater;
+        MapUpdater m_regionUpdater;
+        MapUpdater m_gridPreloader;
+        MapUpdater m_pathUpdater;
 
         uint32 i_MaxInstanceId;
 };
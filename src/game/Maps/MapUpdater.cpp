@@ -0,0 +1,110 @@
+/*
+* This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+*
+* This program is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation; either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program; if not, write to the Free Software
+* Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#include "Maps/MapUpdater.h"
+#include "Maps/MapWorkers.h"
+#include "Maps/Map.h"
+#include "Log.h"
+#include "Errors.h"
+
+void MapUpdater::activate(size_t num_threads)
+{
+    MANGOS_ASSERT(!activated());
+
+    m_cancelationToken = false;
+    m_workerThreads.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i)
+        m_workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this));
+}
+
+void MapUpdater::deactivate()
+{
+    if (!activated())
+        return;
+
+    wait();
+
+    m_cancelationToken = true;
+    {
+        std::lock_guard<std::mutex> guard(m_queueLock);
+        m_queueCondition.notify_all();
+    }
+
+    for (auto& thread : m_workerThreads)
+        thread.join();
+
+    m_workerThreads.clear();
+}
+
+void MapUpdater::schedule_specific(Worker* worker)
+{
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        ++m_pendingRequests;
+    }
+
+    std::lock_guard<std::mutex> guard(m_queueLock);
+    m_queue.push(worker);
+    m_queueCondition.notify_one();
+}
+
+void MapUpdater::schedule_update(Map& map, uint32 diff)
+{
+    schedule_specific(new MapUpdateWorker(map, diff, *this));
+}
+
+void MapUpdater::wait()
+{
+    std::unique_lock<std::mutex> guard(m_lock);
+    m_condition.wait(guard, [this] { return m_pendingRequests == 0; });
+}
+
+void MapUpdater::update_finished()
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    if (m_pendingRequests == 0)
+    {
+        sLog.outError("MapUpdater::update_finished: pending update count already 0");
+        return;
+    }
+
+    if (--m_pendingRequests == 0)
+        m_condition.notify_all();
+}
+
+void MapUpdater::WorkerThread()
+{
+    while (true)
+    {
+        Worker* worker;
+        {
+            std::unique_lock<std::mutex> guard(m_queueLock);
+            m_queueCondition.wait(guard, [this] { return m_cancelationToken || !m_queue.empty(); });
+
+            if (m_queue.empty())                            // woken up by deactivate()
+                return;
+
+            worker = m_queue.front();
+            m_queue.pop();
+        }
+
+        worker->execute();
+        delete worker;
+    }
+}
@@ -0,0 +1,74 @@
+/*
+* This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+*
+* This program is free software; you can redistribute it and/or modify
+* it under the terms of the GNU General Public License as published by
+* the Free Software Foundation; either version 2 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU General Public License
+* along with this program; if not, write to the Free Software
+* Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#ifndef _MAP_UPDATER_H_INCLUDED
+#define _MAP_UPDATER_H_INCLUDED
+
+#include "Platform/Define.h"
+
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <queue>
+
+class Map;
+class Worker;
+
+/// Thread pool executing Worker jobs (whole maps or parts of a map) scheduled by MapManager
+class MapUpdater
+{
+    public:
+        MapUpdater() : m_cancelationToken(false), m_pendingRequests(0) {}
+        ~MapUpdater() { deactivate(); }
+
+        void activate(size_t num_threads);
+        void deactivate();
+        bool activated() const { return !m_workerThreads.empty(); }
+        size_t GetThreadCount() const { return m_workerThreads.size(); }
+
+        // ownership of the worker is passed to the updater, it is deleted after execution
+        void schedule_specific(Worker* worker);
+        void schedule_update(Map& map, uint32 diff);
+
+        // barrier: blocks until all scheduled workers finished
+        void wait();
+
+        // called by a worker at the end of its execute()
+        void update_finished();
+
+    private:
+        void WorkerThread();
+
+        std::vector<std::thread> m_workerThreads;
+        std::atomic<bool> m_cancelationToken;
+
+        std::queue<Worker*> m_queue;
+        std::mutex m_queueLock;
+        std::condition_variable m_queueCondition;
+
+        std::mutex m_lock;
+        std::condition_variable m_condition;
+        size_t m_pendingRequests;
+
+        MapUpdater(MapUpdater const&);
+        MapUpdater& operator=(MapUpdater const&);
+};
+
+#endif //_MAP_UPDATER_H_INCLUDED
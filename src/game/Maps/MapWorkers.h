@@ -23,13 +23,19 @@
 #include "Grids/GridNotifiersImpl.h"
 #include "MapUpdater.h"
 #include "MotionGenerators/MovementGenerator.h"
+#include "MotionGenerators/MoveMap.h"
+#include "MotionGenerators/PathRequestQueue.h"
 #include "Entities/Object.h"
+#include "Maps/Map.h"
 #include "Platform/Define.h"
 
+#include <future>
+
 class Worker
 {
     public:
         Worker(MapUpdater& updater) : m_updater(updater) {}
+        virtual ~Worker() {}
         virtual void execute() {};
 
     protected:
@@ -60,13 +66,13 @@ class MapUpdateWorker : public Worker
 class GridCrawler : public Worker
 {
     public:
-        GridCrawler(Map& map, std::vector<Cell> &cells, uint32 diff, MapUpdater& updater) :
-            Worker(updater), m_map(map), m_cells(cells), m_diff(diff)
+        GridCrawler(Map& map, std::vector<Cell> &cells, WorldObjectUnSet& objects, std::promise<void>& done, MapUpdater& updater) :
+            Worker(updater), m_map(map), m_cells(cells), m_objects(objects), m_done(done)
         {}
 
         void execute() override
         {
-            MaNGOS::ObjectUpdater obj_updater(m_diff);
+            MaNGOS::ObjectUpdater obj_updater(m_objects);
             TypeContainerVisitor<MaNGOS::ObjectUpdater, GridTypeMapContainer  > grid_object_update(obj_updater);    // For creature
             TypeContainerVisitor<MaNGOS::ObjectUpdater, WorldTypeMapContainer > world_object_update(obj_updater);   // For pets
 
@@ -76,34 +82,102 @@ class GridCrawler : public Worker
                 m_map.Visit(cell, world_object_update);
             }
 
+            m_done.set_value();
             GetWorker().update_finished();
         }
 
     private:
         Map& m_map;
         std::vector<Cell> &m_cells;
-        uint32 m_diff;
+        WorldObjectUnSet& m_objects;
+        std::promise<void>& m_done;                         // waited for by the Map::UpdateRegions call that scheduled it
 };
 
 
 class ObjectUpdateWorker : public Worker
 {
     public:
-        ObjectUpdateWorker(std::unordered_set<WorldObject*>& objects, uint32 diff, MapUpdater& updater) :
-            Worker(updater), m_objects(objects), m_diff(diff)
+        ObjectUpdateWorker(MapUpdateRegion& region, uint32 diff, std::promise<void>& done, MapUpdater& updater) :
+            Worker(updater), m_region(region), m_diff(diff), m_done(done)
         {}
 
         void execute() override
         {
-            for (WorldObject* const &object : m_objects)
+            // side effects leaving the region are queued into it until the merge point
+            Map::SetCurrentUpdateRegion(&m_region);
+
+            for (WorldObject* const &object : m_region.objects)
                 object->Update(m_diff);
 
+            Map::SetCurrentUpdateRegion(nullptr);
+
+            m_done.set_value();
             GetWorker().update_finished();
         }
 
     private:
-        std::unordered_set<WorldObject*>& m_objects;
+        MapUpdateRegion& m_region;
         uint32 m_diff;
+        std::promise<void>& m_done;                         // waited for by the Map::UpdateRegions call that scheduled it
+};
+
+// terrain of a grid read ahead of the players of a map, kept by the map until it is linked or the map is destroyed
+struct GridPreloadRequest
+{
+    explicit GridPreloadRequest(GridPair const& _grid) :
+        grid(_grid), terrainX((MAX_NUMBER_OF_GRIDS - 1) - _grid.x_coord), terrainY((MAX_NUMBER_OF_GRIDS - 1) - _grid.y_coord),
+        read(done.get_future())
+    {}
+
+    GridPair grid;
+    uint32 terrainX;
+    uint32 terrainY;
+    MMAP::MMapTileData navTile;
+
+    std::promise<void> done;                                // set by the worker
+    std::future<void> read;                                 // polled by the map
+};
+
+class GridPreloadWorker : public Worker
+{
+    public:
+        GridPreloadWorker(TerrainInfo& terrain, GridPreloadRequest& request, MapUpdater& updater) :
+            Worker(updater), m_terrain(terrain), m_request(request)
+        {}
+
+        void execute() override
+        {
+            m_terrain.PreloadGrid(m_request.terrainX, m_request.terrainY, m_request.navTile);
+            m_request.done.set_value();
+            GetWorker().update_finished();
+        }
+
+    private:
+        TerrainInfo& m_terrain;
+        GridPreloadRequest& m_request;
+};
+
+class PathWorker : public Worker
+{
+    public:
+        PathWorker(std::vector<PathRequest*> const& requests, size_t begin, size_t end, std::promise<void>& done, MapUpdater& updater) :
+            Worker(updater), m_requests(requests), m_begin(begin), m_end(end), m_done(done)
+        {}
+
+        void execute() override
+        {
+            for (size_t i = m_begin; i < m_end; ++i)
+                m_requests[i]->Calculate();
+
+            m_done.set_value();
+            GetWorker().update_finished();
+        }
+
+    private:
+        std::vector<PathRequest*> const& m_requests;
+        size_t m_begin;
+        size_t m_end;
+        std::promise<void>& m_done;                         // waited for by the PathRequestQueue::Process call that scheduled it
 };
 
 #endif //_MAP_WORKERS_H_INCLUDED
\ No newline at end of file
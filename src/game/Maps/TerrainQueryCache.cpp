@@ -0,0 +1,164 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Maps/TerrainQueryCache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+static int32 ToQueryCell(float coord)
+{
+    return int32(std::floor(coord / TERRAIN_QUERY_CELL_SIZE));
+}
+
+static int32 ToQueryBits(float coord)
+{
+    int32 bits;
+    memcpy(&bits, &coord, sizeof(bits));
+    return bits;
+}
+
+TerrainQueryKey TerrainQueryKey::LineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, bool ignoreM2Model)
+{
+    TerrainQueryKey key;
+    key.type = ignoreM2Model ? TERRAIN_QUERY_LOS_IGNORE_M2 : TERRAIN_QUERY_LOS;
+    key.values[0] = ToQueryCell(x1);
+    key.values[1] = ToQueryCell(y1);
+    key.values[2] = ToQueryCell(z1);
+    key.values[3] = ToQueryCell(x2);
+    key.values[4] = ToQueryCell(y2);
+    key.values[5] = ToQueryCell(z2);
+    return key;
+}
+
+TerrainQueryKey TerrainQueryKey::Height(float x, float y, float z)
+{
+    TerrainQueryKey key;
+    key.type = TERRAIN_QUERY_HEIGHT;
+    key.values[0] = ToQueryBits(x);
+    key.values[1] = ToQueryBits(y);
+    key.values[2] = ToQueryBits(z);
+    key.values[3] = 0;
+    key.values[4] = 0;
+    key.values[5] = 0;
+    return key;
+}
+
+TerrainQueryCache::TerrainQueryCache(uint32 size) : m_size(size), m_entries(new Entry[size])
+{
+    for (uint32 i = 0; i < m_size; ++i)
+        m_entries[i].used = false;
+
+    for (uint32 x = 0; x < MAX_NUMBER_OF_GRIDS; ++x)
+        for (uint32 y = 0; y < MAX_NUMBER_OF_GRIDS; ++y)
+            m_modelGenerations[x][y] = 0;
+
+    for (Stripe& stripe : m_stripes)
+    {
+        stripe.hits = 0;
+        stripe.misses = 0;
+    }
+}
+
+// tile of a coordinate as in TerrainInfo::GetGrid, clamped as models and queries may reach outside of the map
+static uint32 GetModelTile(float coord)
+{
+    int tile = (int)(32 - coord / SIZE_OF_GRIDS);
+    return uint32(std::min(std::max(tile, 0), MAX_NUMBER_OF_GRIDS - 1));
+}
+
+uint32 TerrainQueryCache::GetModelGeneration(float x, float y) const
+{
+    return m_modelGenerations[GetModelTile(x)][GetModelTile(y)];
+}
+
+uint32 TerrainQueryCache::GetModelGeneration(float x1, float y1, float x2, float y2) const
+{
+    // tile generations only grow, so the sum changes with any of them
+    uint32 minX = GetModelTile(std::max(x1, x2)), maxX = GetModelTile(std::min(x1, x2));
+    uint32 minY = GetModelTile(std::max(y1, y2)), maxY = GetModelTile(std::min(y1, y2));
+
+    uint32 generation = 0;
+    for (uint32 x = minX; x <= maxX; ++x)
+        for (uint32 y = minY; y <= maxY; ++y)
+            generation += m_modelGenerations[x][y];
+
+    return generation;
+}
+
+void TerrainQueryCache::InvalidateModels(float minX, float minY, float maxX, float maxY)
+{
+    // tiles count down as coordinates grow
+    for (uint32 x = GetModelTile(maxX); x <= GetModelTile(minX); ++x)
+        for (uint32 y = GetModelTile(maxY); y <= GetModelTile(minY); ++y)
+            ++m_modelGenerations[x][y];
+}
+
+uint32 TerrainQueryCache::GetSlot(TerrainQueryKey const& key) const
+{
+    uint32 hash = 2166136261u;                              // FNV-1a over the fields
+    hash = (hash ^ key.type) * 16777619u;
+    for (int32 value : key.values)
+        hash = (hash ^ uint32(value)) * 16777619u;
+    return hash & (m_size - 1);
+}
+
+bool TerrainQueryCache::Find(TerrainQueryKey const& key, uint32 terrainGeneration, uint32 modelGeneration, float& result) const
+{
+    uint32 slot = GetSlot(key);
+    Stripe& stripe = m_stripes[slot % TERRAIN_QUERY_CACHE_LOCKS];
+    Entry const& entry = m_entries[slot];
+
+    std::lock_guard<std::mutex> guard(stripe.lock);
+    if (!entry.used || !(entry.key == key) || entry.terrainGeneration != terrainGeneration || entry.modelGeneration != modelGeneration)
+    {
+        ++stripe.misses;
+        return false;
+    }
+
+    ++stripe.hits;
+    result = entry.result;
+    return true;
+}
+
+void TerrainQueryCache::Store(TerrainQueryKey const& key, uint32 terrainGeneration, uint32 modelGeneration, float result) const
+{
+    uint32 slot = GetSlot(key);
+    Stripe& stripe = m_stripes[slot % TERRAIN_QUERY_CACHE_LOCKS];
+    Entry& entry = m_entries[slot];
+
+    std::lock_guard<std::mutex> guard(stripe.lock);
+    entry.key = key;
+    entry.terrainGeneration = terrainGeneration;
+    entry.modelGeneration = modelGeneration;
+    entry.result = result;
+    entry.used = true;
+}
+
+void TerrainQueryCache::GetStats(uint64& hits, uint64& misses) const
+{
+    hits = 0;
+    misses = 0;
+    for (Stripe& stripe : m_stripes)
+    {
+        std::lock_guard<std::mutex> guard(stripe.lock);
+        hits += stripe.hits;
+        misses += stripe.misses;
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_TERRAIN_QUERY_CACHE_H
+#define MANGOS_TERRAIN_QUERY_CACHE_H
+
+#include "Platform/Define.h"
+#include "Maps/GridDefines.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+// line of sight queries with both points in the same cells of this size (in yards) share one result
+#define TERRAIN_QUERY_CELL_SIZE         0.25f
+// number of results kept per map, powers of 2
+#define TERRAIN_QUERY_CACHE_SIZE        1024
+#define TERRAIN_QUERY_CACHE_SIZE_WORLD  8192
+// number of locks the results are spread over
+#define TERRAIN_QUERY_CACHE_LOCKS       16
+
+enum TerrainQueryType : uint32
+{
+    TERRAIN_QUERY_LOS               = 0,
+    TERRAIN_QUERY_LOS_IGNORE_M2     = 1,
+    TERRAIN_QUERY_HEIGHT            = 2,
+};
+
+struct TerrainQueryKey
+{
+    uint32 type;
+    int32 values[6];                                        // rounded line of sight points, bits of the height position
+
+    bool operator==(TerrainQueryKey const& other) const
+    {
+        for (int i = 0; i < 6; ++i)
+            if (values[i] != other.values[i])
+                return false;
+        return type == other.type;
+    }
+
+    static TerrainQueryKey LineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, bool ignoreM2Model);
+    static TerrainQueryKey Height(float x, float y, float z);
+};
+
+/**
+ * Results of the line of sight and height queries of one map, for units asking again while
+ * they and their targets stand still.
+ *
+ * Line of sight is keyed on the points rounded to small cells. Heights are keyed on the exact
+ * position, as the ground under it is interpolated. A result is stored in the slot of its key
+ * hash, replacing the one there. Each result keeps the generations of the terrain tiles it
+ * touches and of the gameobject models on those tiles. A tile loading or unloading makes the
+ * older results on that tile stale, and so does a gameobject model on the tile being added,
+ * removed or changing its collision. The slots are locked in stripes, since region threads of
+ * continents query at the same time.
+ */
+class TerrainQueryCache
+{
+    public:
+        explicit TerrainQueryCache(uint32 size);
+
+        // generation of the gameobject models on the tile of a point or on the tiles between two points,
+        // to be read before the result to store is calculated
+        uint32 GetModelGeneration(float x, float y) const;
+        uint32 GetModelGeneration(float x1, float y1, float x2, float y2) const;
+        // called when a gameobject model within these bounds is added, removed or changes its collision
+        void InvalidateModels(float minX, float minY, float maxX, float maxY);
+
+        bool Find(TerrainQueryKey const& key, uint32 terrainGeneration, uint32 modelGeneration, float& result) const;
+        void Store(TerrainQueryKey const& key, uint32 terrainGeneration, uint32 modelGeneration, float result) const;
+
+        void GetStats(uint64& hits, uint64& misses) const;
+
+    private:
+        struct Entry
+        {
+            TerrainQueryKey key;
+            uint32 terrainGeneration;
+            uint32 modelGeneration;
+            float result;
+            bool used;
+        };
+
+        struct Stripe
+        {
+            std::mutex lock;
+            uint64 hits;                                    // counted under the lock
+            uint64 misses;
+        };
+
+        uint32 GetSlot(TerrainQueryKey const& key) const;
+
+        uint32 m_size;
+        std::unique_ptr<Entry[]> m_entries;
+        mutable Stripe m_stripes[TERRAIN_QUERY_CACHE_LOCKS];
+        std::atomic<uint32> m_modelGenerations[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
+};
+
+#endif
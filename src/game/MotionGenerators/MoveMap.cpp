@@ -116,6 +116,9 @@ namespace MMAP
     }
 
     // ######################## MMapManager ########################
+    // queries leased by the current thread, it must not wait for tile changes while it holds one
+    static thread_local uint32 t_leasedQueries = 0;
+
     MMapManager::~MMapManager()
     {
         for (auto& loadedMMap : loadedMMaps)
@@ -179,6 +182,8 @@ namespace MMAP
 
     bool MMapManager::IsMMapIsLoaded(uint32 mapId, uint32 x, uint32 y) const
     {
+        std::lock_guard<std::mutex> guard(m_lock);
+
         // get this mmap data
         auto itr = loadedMMaps.find(mapId);
 
@@ -187,31 +192,39 @@ namespace MMAP
 
         auto mmap = itr->second;
 
-        uint32 packedGridPos = packTileID(x, y);
-        if (mmap->mmapLoadedTiles.find(packedGridPos) != mmap->mmapLoadedTiles.end())
-            return true;
-
-        return false;
+        auto tile = mmap->mmapLoadedTiles.find(packTileID(x, y));
+        return tile != mmap->mmapLoadedTiles.end() && tile->second.refCount;
     }
 
     bool MMapManager::loadMap(uint32 mapId, int32 x, int32 y)
     {
-        // make sure the mmap is loaded and ready to load tiles
-        if (!loadMapData(mapId))
-            return false;
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
 
-        // get this mmap data
-        MMapData* mmap = loadedMMaps[mapId];
-        MANGOS_ASSERT(mmap->navMesh);
+            // make sure the mmap is loaded and ready to load tiles
+            if (!loadMapData(mapId))
+                return false;
 
-        // check if we already have this tile loaded
-        uint32 packedGridPos = packTileID(x, y);
-        if (mmap->mmapLoadedTiles.find(packedGridPos) != mmap->mmapLoadedTiles.end())
-        {
-            sLog.outError("MMAP:loadMap: Asked to load already loaded navmesh tile. %03u%02i%02i.mmtile", mapId, x, y);
-            return false;
+            // check if we already have this tile loaded
+            MMapTileSet& tiles = loadedMMaps[mapId]->mmapLoadedTiles;
+            auto itr = tiles.find(packTileID(x, y));
+            if (itr != tiles.end())
+            {
+                ++itr->second.refCount;
+                return true;
+            }
         }
 
+        // the file is read without lock, another thread may add the tile meanwhile
+        MMapTileData tile;
+        if (!readTile(mapId, x, y, tile))
+            return false;
+
+        return addTile(mapId, x, y, tile);
+    }
+
+    bool MMapManager::readTile(uint32 mapId, int32 x, int32 y, MMapTileData& tile)
+    {
         // load this tile :: mmaps/MMMXXYY.mmtile
         uint32 pathLen = sWorld.GetDataPath().length() + strlen("mmaps/%03i%02i%02i.mmtile") + 1;
         char* fileName = new char[pathLen];
@@ -252,32 +265,107 @@ namespace MMAP
         if (!result)
         {
             sLog.outError("MMAP:loadMap: Bad header or data in mmap %03u%02i%02i.mmtile", mapId, x, y);
+            dtFree(data);
             fclose(file);
             return false;
         }
 
         fclose(file);
 
-        dtMeshHeader* header = (dtMeshHeader*)data;
-        dtTileRef tileRef = 0;
+        tile.data = data;
+        tile.size = int(fileHeader.size);
+        return true;
+    }
 
-        // memory allocated for data is now managed by detour, and will be deallocated when the tile is removed
-        dtStatus dtResult = mmap->navMesh->addTile(data, fileHeader.size, DT_TILE_FREE_DATA, 0, &tileRef);
-        if (dtStatusFailed(dtResult))
-        {
-            sLog.outError("MMAP:loadMap: Could not load %03u%02i%02i.mmtile into navmesh", mapId, x, y);
-            dtFree(data);
+    bool MMapManager::addTile(uint32 mapId, int32 x, int32 y, MMapTileData& tile)
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+
+        if (!tile.data || !loadMapData(mapId))
             return false;
-        }
 
-        mmap->mmapLoadedTiles.insert(std::pair<uint32, dtTileRef>(packedGridPos, tileRef));
-        ++loadedTiles;
-        DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "MMAP:loadMap: Loaded mmtile %03i[%02i,%02i] into %03i[%02i,%02i]", mapId, x, y, mapId, header->x, header->y);
+        // get this mmap data
+        MMapData* mmap = loadedMMaps[mapId];
+        MANGOS_ASSERT(mmap->navMesh);
+
+        // a tile still in the navmesh (maybe waiting for removal) is only referenced once more
+        MMapTile& navTile = mmap->mmapLoadedTiles[packTileID(x, y)];
+        if (navTile.refCount++ || navTile.ref)
+            return true;
+
+        navTile.pendingData.data = tile.data;
+        navTile.pendingData.size = tile.size;
+        tile.data = nullptr;
+        tile.size = 0;
+
+        mmap->pendingChanges = true;
+        if (!mmap->leasedQueries)
+            applyTileChanges(mapId, mmap);
+
         return true;
     }
 
+    void MMapManager::applyTileChanges(uint32 mapId, MMapData* mmap)
+    {
+        for (MMapTileSet::iterator itr = mmap->mmapLoadedTiles.begin(); itr != mmap->mmapLoadedTiles.end();)
+        {
+            uint32 x = (itr->first >> 16);
+            uint32 y = (itr->first & 0x0000FFFF);
+            MMapTile& tile = itr->second;
+
+            if (!tile.refCount)
+            {
+                if (tile.ref)
+                {
+                    // unload, and mark as non loaded
+                    dtStatus dtResult = mmap->navMesh->removeTile(tile.ref, nullptr, nullptr);
+                    if (dtStatusFailed(dtResult))
+                    {
+                        // this is technically a memory leak
+                        // if the grid is later reloaded, dtNavMesh::addTile will return error but no extra memory is used
+                        // we cannot recover from this error - assert out
+                        sLog.outError("MMAP:unloadMap: Could not unload %03u%02i%02i.mmtile from navmesh", mapId, x, y);
+                        MANGOS_ASSERT(false);
+                    }
+
+                    --loadedTiles;
+                    DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "MMAP:unloadMap: Unloaded mmtile %03i[%02i,%02i] from %03i", mapId, x, y, mapId);
+                }
+
+                itr = mmap->mmapLoadedTiles.erase(itr);
+                continue;
+            }
+
+            if (!tile.ref && tile.pendingData.data)
+            {
+                dtMeshHeader* header = (dtMeshHeader*)tile.pendingData.data;
+
+                // memory allocated for data is now managed by detour, and will be deallocated when the tile is removed
+                dtStatus dtResult = mmap->navMesh->addTile(tile.pendingData.data, tile.pendingData.size, DT_TILE_FREE_DATA, 0, &tile.ref);
+                if (dtStatusFailed(dtResult))
+                {
+                    sLog.outError("MMAP:loadMap: Could not load %03u%02i%02i.mmtile into navmesh", mapId, x, y);
+                    itr = mmap->mmapLoadedTiles.erase(itr);
+                    continue;
+                }
+
+                tile.pendingData.data = nullptr;
+                tile.pendingData.size = 0;
+
+                ++loadedTiles;
+                DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "MMAP:loadMap: Loaded mmtile %03i[%02i,%02i] into %03i[%02i,%02i]", mapId, x, y, mapId, header->x, header->y);
+            }
+
+            ++itr;
+        }
+
+        mmap->pendingChanges = false;
+    }
+
     bool MMapManager::unloadMap(uint32 mapId, int32 x, int32 y)
     {
+        std::lock_guard<std::mutex> guard(m_lock);
+
         // check if we have this map loaded
         if (loadedMMaps.find(mapId) == loadedMMaps.end())
         {
@@ -289,39 +377,29 @@ namespace MMAP
         MMapData* mmap = loadedMMaps[mapId];
 
         // check if we have this tile loaded
-        uint32 packedGridPos = packTileID(x, y);
-        if (mmap->mmapLoadedTiles.find(packedGridPos) == mmap->mmapLoadedTiles.end())
+        auto itr = mmap->mmapLoadedTiles.find(packTileID(x, y));
+        if (itr == mmap->mmapLoadedTiles.end() || !itr->second.refCount)
         {
             // file may not exist, therefore not loaded
             DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "MMAP:unloadMap: Asked to unload not loaded navmesh tile. %03u%02i%02i.mmtile", mapId, x, y);
             return false;
         }
 
-        dtTileRef tileRef = mmap->mmapLoadedTiles[packedGridPos];
-
-        // unload, and mark as non loaded
-        dtStatus dtResult = mmap->navMesh->removeTile(tileRef, nullptr, nullptr);
-        if (dtStatusFailed(dtResult))
-        {
-            // this is technically a memory leak
-            // if the grid is later reloaded, dtNavMesh::addTile will return error but no extra memory is used
-            // we cannot recover from this error - assert out
-            sLog.outError("MMAP:unloadMap: Could not unload %03u%02i%02i.mmtile from navmesh", mapId, x, y);
-            MANGOS_ASSERT(false);
-        }
-        else
-        {
-            mmap->mmapLoadedTiles.erase(packedGridPos);
-            --loadedTiles;
-            DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "MMAP:unloadMap: Unloaded mmtile %03i[%02i,%02i] from %03i", mapId, x, y, mapId);
+        // still used by another load
+        if (--itr->second.refCount)
             return true;
-        }
 
-        return false;
+        mmap->pendingChanges = true;
+        if (!mmap->leasedQueries)
+            applyTileChanges(mapId, mmap);
+
+        return true;
     }
 
     bool MMapManager::unloadMap(uint32 mapId)
     {
+        std::unique_lock<std::mutex> guard(m_lock);
+
         if (loadedMMaps.find(mapId) == loadedMMaps.end())
         {
             // file may not exist, therefore not loaded
@@ -329,13 +407,19 @@ namespace MMAP
             return false;
         }
 
-        // unload all tiles from given map
+        // whole maps are unloaded when none of their instances is left, paths still being calculated are waited for
         MMapData* mmap = loadedMMaps[mapId];
+        m_queriesReturned.wait(guard, [mmap] { return mmap->leasedQueries == 0; });
+
+        // unload all tiles from given map
         for (MMapTileSet::iterator i = mmap->mmapLoadedTiles.begin(); i != mmap->mmapLoadedTiles.end(); ++i)
         {
+            if (!i->second.ref)
+                continue;
+
             uint32 x = (i->first >> 16);
             uint32 y = (i->first & 0x0000FFFF);
-            dtStatus dtResult = mmap->navMesh->removeTile(i->second, nullptr, nullptr);
+            dtStatus dtResult = mmap->navMesh->removeTile(i->second.ref, nullptr, nullptr);
             if (dtStatusFailed(dtResult))
                 sLog.outError("MMAP:unloadMap: Could not unload %03u%02i%02i.mmtile from navmesh", mapId, x, y);
             else
@@ -352,63 +436,89 @@ namespace MMAP
         return true;
     }
 
-    bool MMapManager::unloadMapInstance(uint32 mapId, uint32 instanceId)
+    uint32 MMapManager::getLoadedTilesCount() const
     {
-        // check if we have this map loaded
-        if (loadedMMaps.find(mapId) == loadedMMaps.end())
-        {
-            // file may not exist, therefore not loaded
-            DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "MMAP:unloadMapInstance: Asked to unload not loaded navmesh map %03u", mapId);
-            return false;
-        }
-
-        MMapData* mmap = loadedMMaps[mapId];
-        if (mmap->navMeshQueries.find(instanceId) == mmap->navMeshQueries.end())
-        {
-            DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "MMAP:unloadMapInstance: Asked to unload not loaded dtNavMeshQuery mapId %03u instanceId %u", mapId, instanceId);
-            return false;
-        }
-
-        dtNavMeshQuery* query = mmap->navMeshQueries[instanceId];
-
-        dtFreeNavMeshQuery(query);
-        mmap->navMeshQueries.erase(instanceId);
-        DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "MMAP:unloadMapInstance: Unloaded mapId %03u instanceId %u", mapId, instanceId);
-
-        return true;
+        std::lock_guard<std::mutex> guard(m_lock);
+        return loadedTiles;
     }
 
-    dtNavMesh const* MMapManager::GetNavMesh(uint32 mapId)
+    uint32 MMapManager::getLoadedMapsCount() const
     {
-        if (loadedMMaps.find(mapId) == loadedMMaps.end())
-            return nullptr;
-
-        return loadedMMaps[mapId]->navMesh;
+        std::lock_guard<std::mutex> guard(m_lock);
+        return uint32(loadedMMaps.size());
     }
 
-    dtNavMeshQuery const* MMapManager::GetNavMeshQuery(uint32 mapId, uint32 instanceId)
+    MMapData* MMapManager::acquireQuery(uint32 mapId, dtNavMeshQuery*& query)
     {
-        if (loadedMMaps.find(mapId) == loadedMMaps.end())
+        std::unique_lock<std::mutex> guard(m_lock);
+
+        // waiting tile changes are applied first, unless this thread already holds a query and would wait for itself
+        if (!t_leasedQueries)
+        {
+            m_queriesReturned.wait(guard, [this, mapId]
+            {
+                auto itr = loadedMMaps.find(mapId);
+                return itr == loadedMMaps.end() || !itr->second->pendingChanges;
+            });
+        }
+
+        auto itr = loadedMMaps.find(mapId);
+        if (itr == loadedMMaps.end())
             return nullptr;
 
-        MMapData* mmap = loadedMMaps[mapId];
-        if (mmap->navMeshQueries.find(instanceId) == mmap->navMeshQueries.end())
+        MMapData* mmap = itr->second;
+        if (mmap->freeQueries.empty())
         {
             // allocate mesh query
-            dtNavMeshQuery* query = dtAllocNavMeshQuery();
+            query = dtAllocNavMeshQuery();
             MANGOS_ASSERT(query);
             dtStatus dtResult = query->init(mmap->navMesh, 1024);
             if (dtStatusFailed(dtResult))
             {
                 dtFreeNavMeshQuery(query);
-                sLog.outError("MMAP:GetNavMeshQuery: Failed to initialize dtNavMeshQuery for mapId %03u instanceId %u", mapId, instanceId);
+                query = nullptr;
+                sLog.outError("MMAP:GetNavMeshQuery: Failed to initialize dtNavMeshQuery for mapId %03u", mapId);
                 return nullptr;
             }
 
-            DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "MMAP:GetNavMeshQuery: created dtNavMeshQuery for mapId %03u instanceId %u", mapId, instanceId);
-            mmap->navMeshQueries.insert(std::pair<uint32, dtNavMeshQuery*>(instanceId, query));
+            DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "MMAP:GetNavMeshQuery: created dtNavMeshQuery %u for mapId %03u", mmap->leasedQueries + 1, mapId);
+        }
+        else
+        {
+            query = mmap->freeQueries.back();
+            mmap->freeQueries.pop_back();
         }
 
-        return mmap->navMeshQueries[instanceId];
+        ++mmap->leasedQueries;
+        ++t_leasedQueries;
+        return mmap;
+    }
+
+    void MMapManager::releaseQuery(uint32 mapId, MMapData* mmap, dtNavMeshQuery* query)
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+
+        mmap->freeQueries.push_back(query);
+        --t_leasedQueries;
+
+        if (--mmap->leasedQueries == 0)
+        {
+            if (mmap->pendingChanges)
+                applyTileChanges(mapId, mmap);
+
+            m_queriesReturned.notify_all();
+        }
+    }
+
+    // ######################## NavMeshQueryLease ########################
+    NavMeshQueryLease::NavMeshQueryLease(uint32 mapId) : m_mapId(mapId), m_mmap(nullptr), m_query(nullptr)
+    {
+        m_mmap = MMapFactory::createOrGetMMapManager()->acquireQuery(mapId, m_query);
+    }
+
+    NavMeshQueryLease::~NavMeshQueryLease()
+    {
+        if (m_mmap)
+            MMapFactory::createOrGetMMapManager()->releaseQuery(m_mapId, m_mmap, m_query);
     }
 }
@@ -24,6 +24,10 @@
 #include <Detour/Include/DetourNavMesh.h>
 #include <Detour/Include/DetourNavMeshQuery.h>
 
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
 class Unit;
 
 //  memory management
@@ -40,17 +44,40 @@ inline void dtCustomFree(void* ptr)
 //  move map related classes
 namespace MMAP
 {
-    typedef std::unordered_map<uint32, dtTileRef> MMapTileSet;
-    typedef std::unordered_map<uint32, dtNavMeshQuery*> NavMeshQuerySet;
+    // navmesh tile read from its file, owned until added to a navmesh
+    struct MMapTileData
+    {
+        MMapTileData() : data(nullptr), size(0) {}
+        ~MMapTileData() { if (data) dtFree(data); }
+
+        unsigned char* data;
+        int size;
+
+        private:
+            MMapTileData(MMapTileData const&);
+            MMapTileData& operator=(MMapTileData const&);
+    };
+
+    // navmesh tile of a map, shared by all instances of the map
+    struct MMapTile
+    {
+        MMapTile() : ref(0), refCount(0) {}
+
+        dtTileRef ref;                      // 0 until the tile is added to the navmesh
+        uint32 refCount;                    // loads not matched by an unload, the tile is removed at 0
+        MMapTileData pendingData;           // read tile waiting for the leased queries to be returned
+    };
+
+    typedef std::unordered_map<uint32, MMapTile> MMapTileSet;
 
     // dummy struct to hold map's mmap data
     struct MMapData
     {
-        MMapData(dtNavMesh* mesh) : navMesh(mesh) {}
+        MMapData(dtNavMesh* mesh) : navMesh(mesh), leasedQueries(0), pendingChanges(false) {}
         ~MMapData()
         {
-            for (auto& navMeshQuerie : navMeshQueries)
-                dtFreeNavMeshQuery(navMeshQuerie.second);
+            for (auto& freeQuery : freeQueries)
+                dtFreeNavMeshQuery(freeQuery);
 
             if (navMesh)
                 dtFreeNavMesh(navMesh);
@@ -58,42 +85,76 @@ namespace MMAP
 
         dtNavMesh* navMesh;
 
-        // we have to use single dtNavMeshQuery for every instance, since those are not thread safe
-        NavMeshQuerySet navMeshQueries;     // instanceId to query
+        // dtNavMeshQuery is not thread safe, every path calculation leases one from the pool
+        std::vector<dtNavMeshQuery*> freeQueries;
+        uint32 leasedQueries;
+
+        // tiles are only added to or removed from the navmesh while no query is leased,
+        // changes wait in mmapLoadedTiles until the last leased query is returned
+        bool pendingChanges;
         MMapTileSet mmapLoadedTiles;        // maps [map grid coords] to [dtTile]
     };
 
-
     typedef std::unordered_map<uint32, MMapData*> MMapDataSet;
 
     // singelton class
-    // holds all all access to mmap loading unloading and meshes
+    // holds all all access to mmap loading unloading and meshes, can be used from any thread
     class MMapManager
     {
         public:
             MMapManager() : loadedTiles(0) {}
             ~MMapManager();
 
+            // loads are counted, a tile loaded several times is removed at its last unload
             bool loadMap(uint32 mapId, int32 x, int32 y);
+            // reads a tile file without touching loaded navmeshes
+            static bool readTile(uint32 mapId, int32 x, int32 y, MMapTileData& tile);
+            // same as loadMap with a tile read by readTile, takes its data unless the tile is already loaded
+            bool addTile(uint32 mapId, int32 x, int32 y, MMapTileData& tile);
             bool unloadMap(uint32 mapId, int32 x, int32 y);
             bool unloadMap(uint32 mapId);
-            bool unloadMapInstance(uint32 mapId, uint32 instanceId);
             bool IsMMapIsLoaded(uint32 mapId, uint32 x, uint32 y) const;
 
-            // the returned [dtNavMeshQuery const*] is NOT threadsafe
-            dtNavMeshQuery const* GetNavMeshQuery(uint32 mapId, uint32 instanceId);
-            dtNavMesh const* GetNavMesh(uint32 mapId);
-
-            uint32 getLoadedTilesCount() const { return loadedTiles; }
-            uint32 getLoadedMapsCount() const { return loadedMMaps.size(); }
+            uint32 getLoadedTilesCount() const;
+            uint32 getLoadedMapsCount() const;
         private:
+            friend class NavMeshQueryLease;
+
+            MMapData* acquireQuery(uint32 mapId, dtNavMeshQuery*& query);
+            void releaseQuery(uint32 mapId, MMapData* mmap, dtNavMeshQuery* query);
+
+            // called with m_lock held
             bool loadMapData(uint32 mapId);
+            void applyTileChanges(uint32 mapId, MMapData* mmap);
             uint32 packTileID(int32 x, int32 y) const;
 
+            mutable std::mutex m_lock;
+            std::condition_variable m_queriesReturned;
+
             MMapDataSet loadedMMaps;
             uint32 loadedTiles;
     };
 
+    // navmesh query of a map leased for the lifetime of the object, the navmesh does not change meanwhile
+    class NavMeshQueryLease
+    {
+        public:
+            explicit NavMeshQueryLease(uint32 mapId);
+            ~NavMeshQueryLease();
+
+            // nullptr if the map has no navmesh
+            dtNavMesh const* GetNavMesh() const { return m_mmap ? m_mmap->navMesh : nullptr; }
+            dtNavMeshQuery const* GetNavMeshQuery() const { return m_query; }
+
+        private:
+            uint32 m_mapId;
+            MMapData* m_mmap;
+            dtNavMeshQuery* m_query;
+
+            NavMeshQueryLease(NavMeshQueryLease const&);
+            NavMeshQueryLease& operator=(NavMeshQueryLease const&);
+    };
+
     // static class
     // holds all mmap global data
     // access point to MMapManager singelton
@@ -34,14 +34,6 @@ PathFinder::PathFinder(const Unit* owner) :
 {
     DEBUG_FILTER_LOG(LOG_FILTER_PATHFINDING, "++ PathFinder::PathInfo for %u \n", m_sourceUnit->GetGUIDLow());
 
-    uint32 mapId = m_sourceUnit->GetMapId();
-    if (MMAP::MMapFactory::IsPathfindingEnabled(mapId, owner))
-    {
-        MMAP::MMapManager* mmap = MMAP::MMapFactory::createOrGetMMapManager();
-        m_navMesh = mmap->GetNavMesh(mapId);
-        m_navMeshQuery = mmap->GetNavMeshQuery(mapId, m_sourceUnit->GetInstanceId());
-    }
-
     createFilter();
 }
 
@@ -70,6 +62,16 @@ bool PathFinder::calculate(float destX, float destY, float destZ, bool forceDest
 
     DEBUG_FILTER_LOG(LOG_FILTER_PATHFINDING, "++ PathFinder::calculate() for %u \n", m_sourceUnit->GetGUIDLow());
 
+    // the query is only held while calculating, so paths of the map can be calculated from several threads
+    uint32 mapId = m_sourceUnit->GetMapId();
+    std::unique_ptr<MMAP::NavMeshQueryLease> lease;
+    if (MMAP::MMapFactory::IsPathfindingEnabled(mapId, m_sourceUnit))
+    {
+        lease.reset(new MMAP::NavMeshQueryLease(mapId));
+        m_navMesh = lease->GetNavMesh();
+        m_navMeshQuery = lease->GetNavMeshQuery();
+    }
+
     // make sure navMesh works - we can run on map w/o mmap
     // check if the start and end point have a .mmtile loaded (can we pass via not loaded tile on the way?)
     if (!m_navMesh || !m_navMeshQuery || m_sourceUnit->hasUnitState(UNIT_STAT_IGNORE_PATHFINDING) ||
@@ -77,15 +79,62 @@ bool PathFinder::calculate(float destX, float destY, float destZ, bool forceDest
     {
         BuildShortcut();
         m_type = PathType(PATHFIND_NORMAL | PATHFIND_NOT_USING_PATH);
-        return true;
     }
+    else
+    {
+        updateFilter();
 
-    updateFilter();
+        BuildPolyPath(start, dest);
+    }
 
-    BuildPolyPath(start, dest);
+    m_navMesh = nullptr;
+    m_navMeshQuery = nullptr;
     return true;
 }
 
+uint32 PathFinder::getPathOptions(bool forceDest) const
+{
+    uint32 options = m_filter.getIncludeFlags() & 0xFF;
+    options |= m_pointPathLimit << 8;
+
+    if (forceDest)
+        options |= 0x010000;
+    if (m_useStraightPath)
+        options |= 0x020000;
+    if (m_sourceUnit->GetTypeId() == TYPEID_PLAYER)
+        options |= 0x040000;
+    if (m_sourceUnit->IsInWater() || m_sourceUnit->IsUnderwater())
+        options |= 0x080000;                                // see updateFilter()
+    if (m_sourceUnit->CanFly())
+        options |= 0x100000;                                // see NormalizePath()
+    if (m_sourceUnit->hasUnitState(UNIT_STAT_IGNORE_PATHFINDING))
+        options |= 0x200000;
+    if (MMAP::MMapFactory::IsPathfindingEnabled(m_sourceUnit->GetMapId(), m_sourceUnit))
+        options |= 0x400000;
+
+    return options;
+}
+
+void PathFinder::getResult(PathResult& result) const
+{
+    result.points = m_pathPoints;
+    result.type = m_type;
+    result.startPosition = m_startPosition;
+    result.actualEndPosition = m_actualEndPosition;
+}
+
+void PathFinder::setResult(PathResult const& result, const Vector3& dest)
+{
+    // the polygons of the previous path of this finder do not match the shared one
+    clear();
+
+    m_pathPoints = result.points;
+    m_type = result.type;
+    m_startPosition = result.startPosition;
+    m_endPosition = dest;
+    m_actualEndPosition = result.actualEndPosition;
+}
+
 dtPolyRef PathFinder::getPathPolyByPosition(const dtPolyRef* polyPath, uint32 polyPathSize, const float* point, float* distance) const
 {
     if (!polyPath || !polyPathSize)
@@ -58,6 +58,15 @@ enum PathType
     PATHFIND_SHORT          = 0x0020,   // path is longer or equal to its limited path length
 };
 
+// result of a calculation, handed to the finders of other units requesting the same path
+struct PathResult
+{
+    PointsArray points;
+    PathType type;
+    Vector3 startPosition;
+    Vector3 actualEndPosition;
+};
+
 class PathFinder
 {
     public:
@@ -80,6 +89,13 @@ class PathFinder
         PointsArray& getPath() { return m_pathPoints; }
         PathType getPathType() const { return m_type; }
 
+        // everything besides start and end deciding the path, finders with equal options calculate equal paths
+        uint32 getPathOptions(bool forceDest) const;
+
+        // share a calculated path, the receiving finder keeps its own destination
+        void getResult(PathResult& result) const;
+        void setResult(PathResult const& result, const Vector3& dest);
+
     private:
 
         dtPolyRef      m_pathPolyRefs[MAX_PATH_LENGTH];   // array of detour polygon references
@@ -97,8 +113,8 @@ class PathFinder
         Vector3        m_actualEndPosition;// {x, y, z} of the closest possible point to given destination
 
         const Unit* const       m_sourceUnit;       // the unit that is moving
-        const dtNavMesh*        m_navMesh;          // the nav mesh
-        const dtNavMeshQuery*   m_navMeshQuery;     // the nav mesh query used to find the path
+        const dtNavMesh*        m_navMesh;          // the nav mesh, set while calculating
+        const dtNavMeshQuery*   m_navMeshQuery;     // the nav mesh query used to find the path, leased while calculating
 
         dtQueryFilter m_filter;                     // use single filter for all movements, update it when needed
 
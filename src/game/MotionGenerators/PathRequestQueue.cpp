@@ -0,0 +1,199 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "MotionGenerators/PathRequestQueue.h"
+#include "Entities/Unit.h"
+#include "Maps/MapManager.h"
+#include "Maps/MapWorkers.h"
+#include "Timer.h"
+
+#include <cmath>
+#include <future>
+
+static int32 ToRequestCell(float coord)
+{
+    return int32(std::floor(coord / PATH_REQUEST_CELL_SIZE));
+}
+
+uint32 PathRequestQueue::Request(PathFinder& path, Unit const& owner, float x, float y, float z, bool forceDest)
+{
+    float startX, startY, startZ;
+    owner.GetPosition(startX, startY, startZ);
+
+    PathRequestKey key;
+    key.startX = ToRequestCell(startX);
+    key.startY = ToRequestCell(startY);
+    key.startZ = ToRequestCell(startZ);
+    key.endX = ToRequestCell(x);
+    key.endY = ToRequestCell(y);
+    key.endZ = ToRequestCell(z);
+    key.unitSize = uint32(owner.GetObjectBoundingRadius() * 2.0f);
+    key.options = path.getPathOptions(forceDest);
+
+    uint32 now = WorldTimer::getMSTime();
+
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    auto itr = m_cacheIndex.find(key);
+    if (itr != m_cacheIndex.end())
+    {
+        CachedPathList::iterator cached = itr->second;
+        if (WorldTimer::getMSTimeDiff(cached->time, now) < PATH_CACHE_LIFETIME)
+        {
+            path.setResult(cached->result, Vector3(x, y, z));
+            m_cache.splice(m_cache.begin(), m_cache, cached);
+            return 0;
+        }
+
+        m_cache.erase(cached);
+        m_cacheIndex.erase(itr);
+    }
+
+    if (++m_nextTicket == 0)                                // 0 is no ticket
+        ++m_nextTicket;
+
+    PathRequest request;
+    request.ticket = m_nextTicket;
+    request.path = &path;
+    request.dest = Vector3(x, y, z);
+    request.forceDest = forceDest;
+    request.key = key;
+    request.leader = nullptr;
+    request.calculated = false;
+    m_pending.push_back(request);
+
+    return request.ticket;
+}
+
+bool PathRequestQueue::TakeResult(uint32 ticket)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+    return m_done.erase(ticket) != 0;
+}
+
+void PathRequestQueue::Cancel(uint32 ticket)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    if (m_done.erase(ticket))
+        return;
+
+    for (PathRequest& request : m_pending)
+    {
+        if (request.ticket == ticket)
+        {
+            request.path = nullptr;
+            break;
+        }
+    }
+}
+
+void PathRequestQueue::Process()
+{
+    std::vector<PathRequest> requests;
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        requests.swap(m_pending);
+    }
+
+    // requests with the same key share the path of the first one
+    std::unordered_map<PathRequestKey, PathRequest const*, PathRequestKeyHash> leaders;
+    std::vector<PathRequest*> calculations;
+    for (PathRequest& request : requests)
+    {
+        if (!request.path)
+            continue;
+
+        auto result = leaders.insert(std::make_pair(request.key, &request));
+        if (result.second)
+            calculations.push_back(&request);
+        else
+            request.leader = result.first->second;
+    }
+
+    if (calculations.empty())
+        return;
+
+    MapUpdater& updater = sMapMgr.GetPathUpdater();
+    if (updater.activated())
+    {
+        size_t perWorker = (calculations.size() + updater.GetThreadCount() - 1) / updater.GetThreadCount();
+        std::vector<std::promise<void>> done((calculations.size() + perWorker - 1) / perWorker);
+        std::vector<std::future<void>> finished;
+        for (std::promise<void>& workerDone : done)
+            finished.push_back(workerDone.get_future());
+
+        for (size_t begin = 0, worker = 0; begin < calculations.size(); begin += perWorker, ++worker)
+            updater.schedule_specific(new PathWorker(calculations, begin, std::min(begin + perWorker, calculations.size()), done[worker], updater));
+
+        // other maps process their queues on the same updater, only wait for the workers of this call
+        for (std::future<void>& workerFinished : finished)
+            workerFinished.wait();
+    }
+    else                                                    // workers already stopped at shutdown
+    {
+        for (PathRequest* request : calculations)
+            request->Calculate();
+    }
+
+    uint32 now = WorldTimer::getMSTime();
+
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    PathResult result;
+    for (PathRequest& request : requests)
+    {
+        if (!request.path)
+            continue;
+
+        if (!request.leader)
+        {
+            if (request.calculated)
+                StoreInCache(request.key, *request.path, now);
+        }
+        else if (request.leader->calculated)
+        {
+            request.leader->path->getResult(result);
+            request.path->setResult(result, request.dest);
+        }
+
+        m_done.insert(request.ticket);
+    }
+}
+
+void PathRequestQueue::StoreInCache(PathRequestKey const& key, PathFinder const& path, uint32 now)
+{
+    auto itr = m_cacheIndex.find(key);
+    if (itr != m_cacheIndex.end())
+        m_cache.splice(m_cache.begin(), m_cache, itr->second);
+    else
+    {
+        if (m_cache.size() >= PATH_CACHE_SIZE)
+        {
+            m_cacheIndex.erase(m_cache.back().key);
+            m_cache.pop_back();
+        }
+
+        m_cache.push_front(CachedPath());
+        m_cache.front().key = key;
+        m_cacheIndex[key] = m_cache.begin();
+    }
+
+    path.getResult(m_cache.front().result);
+    m_cache.front().time = now;
+}
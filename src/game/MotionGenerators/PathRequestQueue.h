@@ -0,0 +1,128 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_PATH_REQUEST_QUEUE_H
+#define MANGOS_PATH_REQUEST_QUEUE_H
+
+#include "Platform/Define.h"
+#include "PathFinder.h"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class Unit;
+
+// requests with start and end points in the same cells of this size (in yards) share one path
+#define PATH_REQUEST_CELL_SIZE      2.0f
+// number of recently calculated paths kept for later requests
+#define PATH_CACHE_SIZE             128
+// time (in ms) a cached path is used, navmesh changes and moved units are picked up after it
+#define PATH_CACHE_LIFETIME         2000
+
+struct PathRequestKey
+{
+    int32 startX, startY, startZ;
+    int32 endX, endY, endZ;
+    uint32 unitSize;                                        // bounding radius in half yards
+    uint32 options;                                         // PathFinder::getPathOptions()
+
+    bool operator==(PathRequestKey const& other) const
+    {
+        return startX == other.startX && startY == other.startY && startZ == other.startZ &&
+               endX == other.endX && endY == other.endY && endZ == other.endZ &&
+               unitSize == other.unitSize && options == other.options;
+    }
+};
+
+struct PathRequestKeyHash
+{
+    size_t operator()(PathRequestKey const& key) const
+    {
+        uint32 hash = 2166136261u;                          // FNV-1a over the fields
+        int32 const fields[] = { key.startX, key.startY, key.startZ, key.endX, key.endY, key.endZ, int32(key.unitSize), int32(key.options) };
+        for (int32 field : fields)
+            hash = (hash ^ uint32(field)) * 16777619u;
+        return hash;
+    }
+};
+
+// a path calculation, filled in for the requests sharing it after the calculation
+struct PathRequest
+{
+    void Calculate() { calculated = path->calculate(dest.x, dest.y, dest.z, forceDest); }
+
+    uint32 ticket;
+    PathFinder* path;                                       // owned by the generator, nullptr once cancelled
+    Vector3 dest;
+    bool forceDest;
+    PathRequestKey key;
+    PathRequest const* leader;                              // request calculating the path of this one, nullptr if none
+    bool calculated;                                        // path changed by Calculate()
+};
+
+/**
+ * Paths requested by the movement generators of one map.
+ *
+ * Requests made during the map update are calculated together at its end on the path worker
+ * threads, while the map thread waits, so the units and the terrain read by the finders do not
+ * change meanwhile. Requests with the same key are calculated once, and the paths calculated
+ * last are kept for a while to answer later requests at once. A generator keeps its current
+ * movement until it picks the result up at its next update.
+ */
+class PathRequestQueue
+{
+    public:
+        PathRequestQueue() : m_nextTicket(0) {}
+
+        // returns 0 when path was filled at once from a recent path, otherwise the ticket to poll the result with.
+        // path must stay unchanged until the result is taken or the ticket is cancelled
+        uint32 Request(PathFinder& path, Unit const& owner, float x, float y, float z, bool forceDest);
+
+        // true once the path of the ticket is calculated, the ticket is released then
+        bool TakeResult(uint32 ticket);
+
+        // drops the request of the ticket, for generators deleted or reset while waiting
+        void Cancel(uint32 ticket);
+
+        // calculates the pending requests, called by the map after its objects were updated
+        void Process();
+
+    private:
+        struct CachedPath
+        {
+            PathRequestKey key;
+            PathResult result;
+            uint32 time;
+        };
+        typedef std::list<CachedPath> CachedPathList;
+
+        void StoreInCache(PathRequestKey const& key, PathFinder const& path, uint32 now);
+
+        std::mutex m_lock;                                  // requests come from the region threads of continents
+        std::vector<PathRequest> m_pending;
+        std::unordered_set<uint32> m_done;
+        uint32 m_nextTicket;
+
+        CachedPathList m_cache;                             // most recently used first
+        std::unordered_map<PathRequestKey, CachedPathList::iterator, PathRequestKeyHash> m_cacheIndex;
+};
+
+#endif
@@ -19,12 +19,15 @@
 #include "Entities/Creature.h"
 #include "RandomMovementGenerator.h"
 #include "Maps/Map.h"
+#include "PathFinder.h"
+#include "PathRequestQueue.h"
 #include "Util.h"
 #include "Movement/MoveSplineInit.h"
 #include "Movement/MoveSpline.h"
 
 template<>
-RandomMovementGenerator<Creature>::RandomMovementGenerator(const Creature& creature): i_verticalZ(0)
+RandomMovementGenerator<Creature>::RandomMovementGenerator(const Creature& creature): i_verticalZ(0),
+    i_path(nullptr), m_pathRequests(nullptr), m_pathTicket(0)
 {
     float respX, respY, respZ, respO, wander_distance;
     creature.GetRespawnCoord(respX, respY, respZ, &respO, &wander_distance);
@@ -35,9 +38,35 @@ RandomMovementGenerator<Creature>::RandomMovementGenerator(const Creature& creat
     i_radius = wander_distance;
 }
 
+template<>
+RandomMovementGenerator<Creature>::~RandomMovementGenerator()
+{
+    if (m_pathTicket)
+        m_pathRequests->Cancel(m_pathTicket);
+
+    delete i_path;
+}
+
+template<>
+void RandomMovementGenerator<Creature>::_moveByPath(Creature& creature, PathFinder& path)
+{
+    Movement::MoveSplineInit init(creature);
+    init.MovebyPath(path.getPath());
+    init.SetWalk(true);
+    init.Launch();
+    if (roll_chance_i(MOVEMENT_RANDOM_MMGEN_CHANCE_NO_BREAK))
+        i_nextMoveTime.Reset(50);
+    else
+        i_nextMoveTime.Reset(urand(3000, 10000));           // Keep a short wait time
+}
+
 template<>
 void RandomMovementGenerator<Creature>::_setRandomLocation(Creature& creature)
 {
+    // keep waiting for the requested path
+    if (m_pathTicket)
+        return;
+
     float destX = i_x;
     float destY = i_y;
     float destZ = i_z;
@@ -47,14 +76,22 @@ void RandomMovementGenerator<Creature>::_setRandomLocation(Creature& creature)
     // check if new random position is assigned (GetReachableRandomPosition may fail) and dest is visible
     if (creature.GetMap()->GetReachableRandomPosition(&creature, destX, destY, destZ, i_radius) && creature.IsWithinLOS(destX, destY, destZ))
     {
-        Movement::MoveSplineInit init(creature);
-        init.MoveTo(destX, destY, destZ, true);
-        init.SetWalk(true);
-        init.Launch();
-        if (roll_chance_i(MOVEMENT_RANDOM_MMGEN_CHANCE_NO_BREAK))
-            i_nextMoveTime.Reset(50);
+        if (PathRequestQueue* pathRequests = creature.GetMap()->GetPathRequests())
+        {
+            delete i_path;                                  // new finder for each move, as done for paths calculated at once
+            i_path = new PathFinder(&creature);
+
+            m_pathRequests = pathRequests;
+            m_pathTicket = pathRequests->Request(*i_path, creature, destX, destY, destZ, false);
+            if (!m_pathTicket)
+                _moveByPath(creature, *i_path);
+        }
         else
-            i_nextMoveTime.Reset(urand(3000, 10000));       // Keep a short wait time
+        {
+            PathFinder path(&creature);
+            path.calculate(destX, destY, destZ);
+            _moveByPath(creature, path);
+        }
     }
     else
         i_nextMoveTime.Reset(50);                           // Retry later
@@ -102,6 +139,17 @@ bool RandomMovementGenerator<Creature>::Update(Creature& creature, const uint32&
         return true;
     }
 
+    if (m_pathTicket)
+    {
+        // path requested at an earlier update is calculated
+        if (m_pathRequests->TakeResult(m_pathTicket))
+        {
+            m_pathTicket = 0;
+            _moveByPath(creature, *i_path);
+        }
+        return true;
+    }
+
     if (creature.movespline->Finalized())
     {
         i_nextMoveTime.Update(diff);
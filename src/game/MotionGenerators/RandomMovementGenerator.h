@@ -21,6 +21,9 @@
 
 #include "MovementGenerator.h"
 
+class PathFinder;
+class PathRequestQueue;
+
 // define chance for creature to not stop after reaching a waypoint
 #define MOVEMENT_RANDOM_MMGEN_CHANCE_NO_BREAK 30
 
@@ -31,7 +34,9 @@ class RandomMovementGenerator
     public:
         explicit RandomMovementGenerator(const Creature&);
         explicit RandomMovementGenerator(float x, float y, float z, float radius, float verticalZ = 0.0f) :
-            i_nextMoveTime(0), i_x(x), i_y(y), i_z(z), i_radius(radius), i_verticalZ(verticalZ) {}
+            i_nextMoveTime(0), i_x(x), i_y(y), i_z(z), i_radius(radius), i_verticalZ(verticalZ),
+            i_path(nullptr), m_pathRequests(nullptr), m_pathTicket(0) {}
+        ~RandomMovementGenerator();
 
         void _setRandomLocation(T&);
         void Initialize(T&);
@@ -45,6 +50,12 @@ class RandomMovementGenerator
         float i_x, i_y, i_z;
         float i_radius;
         float i_verticalZ;
+
+        void _moveByPath(T&, PathFinder& path);
+
+        PathFinder* i_path;                                 // only used for paths calculated by the map
+        PathRequestQueue* m_pathRequests;                   // queue of m_pathTicket
+        uint32 m_pathTicket;                                // i_path is calculated by the map while set
 };
 
 #endif
@@ -18,10 +18,12 @@
 
 #include "MotionGenerators/TargetedMovementGenerator.h"
 #include "PathFinder.h"
+#include "PathRequestQueue.h"
 #include "Entities/Unit.h"
 #include "Entities/Creature.h"
 #include "Entities/Player.h"
 #include "World/World.h"
+#include "Maps/Map.h"
 #include "Movement/MoveSplineInit.h"
 #include "Movement/MoveSpline.h"
 
@@ -33,6 +35,15 @@
 #define CHASE_MOVE_CLOSER_FACTOR                          0.875f
 
 //-----------------------------------------------//
+template<class T, typename D>
+TargetedMovementGeneratorMedium<T, D>::~TargetedMovementGeneratorMedium()
+{
+    if (m_pathTicket)
+        m_pathRequests->Cancel(m_pathTicket);
+
+    delete i_path;
+}
+
 template<class T, typename D>
 void TargetedMovementGeneratorMedium<T, D>::_setTargetLocation(T& owner, bool updateDestination)
 {
@@ -42,6 +53,10 @@ void TargetedMovementGeneratorMedium<T, D>::_setTargetLocation(T& owner, bool up
     if (owner.hasUnitState(UNIT_STAT_NOT_MOVE))
         return;
 
+    // keep the current movement until the requested path is calculated
+    if (m_pathTicket)
+        return;
+
     float x, y, z;
 
     // i_path can be nullptr in case this is the first call for this MMGen (via Update)
@@ -82,7 +97,24 @@ void TargetedMovementGeneratorMedium<T, D>::_setTargetLocation(T& owner, bool up
     // allow pets following their master to cheat while generating paths
     bool forceDest = (owner.GetTypeId() == TYPEID_UNIT && ((Creature*)&owner)->IsPet()
                       && owner.hasUnitState(UNIT_STAT_FOLLOW));
-    i_path->calculate(x, y, z, forceDest);
+
+    PathRequestQueue* pathRequests = owner.GetTypeId() == TYPEID_UNIT ? owner.GetMap()->GetPathRequests() : nullptr;
+    if (pathRequests)
+    {
+        m_pathRequests = pathRequests;
+        m_pathTicket = pathRequests->Request(*i_path, owner, x, y, z, forceDest);
+        if (m_pathTicket)
+            return;                                         // moved along it when it is calculated
+    }
+    else
+        i_path->calculate(x, y, z, forceDest);
+
+    _moveByPath(owner);
+}
+
+template<class T, typename D>
+void TargetedMovementGeneratorMedium<T, D>::_moveByPath(T& owner)
+{
     if (i_path->getPathType() & PATHFIND_NOPATH)
         return;
 
@@ -158,6 +190,13 @@ bool TargetedMovementGeneratorMedium<T, D>::Update(T& owner, const uint32& time_
         return true;
     }
 
+    // path requested at an earlier update is calculated
+    if (m_pathTicket && m_pathRequests->TakeResult(m_pathTicket))
+    {
+        m_pathTicket = 0;
+        _moveByPath(owner);
+    }
+
     bool targetMoved = false;
     i_recheckDistance.Update(time_diff);
     if (i_recheckDistance.Passed())
@@ -415,6 +454,10 @@ template bool TargetedMovementGeneratorMedium<Creature, ChaseMovementGenerator<C
 template bool TargetedMovementGeneratorMedium<Creature, FollowMovementGenerator<Creature> >::Update(Creature&, const uint32&);
 template bool TargetedMovementGeneratorMedium<Player, ChaseMovementGenerator<Player> >::IsReachable() const;
 template bool TargetedMovementGeneratorMedium<Player, FollowMovementGenerator<Player> >::IsReachable() const;
+template TargetedMovementGeneratorMedium<Player, ChaseMovementGenerator<Player> >::~TargetedMovementGeneratorMedium();
+template TargetedMovementGeneratorMedium<Player, FollowMovementGenerator<Player> >::~TargetedMovementGeneratorMedium();
+template TargetedMovementGeneratorMedium<Creature, ChaseMovementGenerator<Creature> >::~TargetedMovementGeneratorMedium();
+template TargetedMovementGeneratorMedium<Creature, FollowMovementGenerator<Creature> >::~TargetedMovementGeneratorMedium();
 template bool TargetedMovementGeneratorMedium<Creature, ChaseMovementGenerator<Creature> >::IsReachable() const;
 template bool TargetedMovementGeneratorMedium<Creature, FollowMovementGenerator<Creature> >::IsReachable() const;
 
@@ -24,6 +24,7 @@
 #include <G3D/Vector3.h>
 
 class PathFinder;
+class PathRequestQueue;
 
 class TargetedMovementGeneratorBase
 {
@@ -45,10 +46,10 @@ class TargetedMovementGeneratorMedium
             i_recheckDistance(0),
             i_offset(offset), i_angle(angle),
             m_speedChanged(false), i_targetReached(false),
-            i_path(nullptr)
+            i_path(nullptr), m_pathRequests(nullptr), m_pathTicket(0)
         {
         }
-        ~TargetedMovementGeneratorMedium() { delete i_path; }
+        ~TargetedMovementGeneratorMedium();
 
     public:
         bool Update(T&, const uint32&);
@@ -65,6 +66,7 @@ class TargetedMovementGeneratorMedium
 
     protected:
         void _setTargetLocation(T&, bool updateDestination);
+        void _moveByPath(T&);
         bool RequiresNewPosition(T& owner, float x, float y, float z) const;
         virtual float GetDynamicTargetDistance(T& /*owner*/, bool /*forRangeCheck*/) const { return i_offset; }
 
@@ -76,6 +78,8 @@ class TargetedMovementGeneratorMedium
         bool i_targetReached : 1;
 
         PathFinder* i_path;
+        PathRequestQueue* m_pathRequests;                   // queue of m_pathTicket
+        uint32 m_pathTicket;                                // i_path is calculated by the map while set
 };
 
 // TODO: need collision detection, but not on approaching but after being at target for 1-2 seconds
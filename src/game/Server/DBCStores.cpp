@@ -171,6 +171,10 @@ static bool LoadDBC_assert_print(uint32 fsize, uint32 rsize, const std::string&
     return false;
 }
 
+// directory of the store images (DBC.ImageDir), empty if stores are always loaded from the dbc files
+static std::string dbcImagePath;
+static uint32 dbcMappedImages = 0;
+
 template<class T>
 inline void LoadDBC(uint32& availableDbcLocales, BarGoLink& bar, StoreProblemList& errlist, DBCStorage<T>& storage, const std::string& dbc_path, const std::string& filename)
 {
@@ -178,6 +182,25 @@ inline void LoadDBC(uint32& availableDbcLocales, BarGoLink& bar, StoreProblemLis
     MANGOS_ASSERT(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()) == sizeof(T) || LoadDBC_assert_print(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()), sizeof(T), filename));
 
     std::string dbc_filename = dbc_path + filename;
+
+    // an image is only used while the dbc file and all its locale variants are unchanged
+    std::string image_filename;
+    uint64 sourceStamp = 0;
+    if (!dbcImagePath.empty())
+    {
+        image_filename = dbcImagePath + filename + ".img";
+        sourceStamp = DBCImageFile::GetFileStamp(dbc_filename.c_str());
+        for (uint8 i = 0; fullLocaleNameList[i].name; ++i)
+            sourceStamp = sourceStamp * 31 + DBCImageFile::GetFileStamp((dbc_path + fullLocaleNameList[i].name + "/" + filename).c_str());
+
+        if (sourceStamp && storage.LoadImage(image_filename.c_str(), sourceStamp))
+        {
+            ++dbcMappedImages;
+            bar.step();
+            return;
+        }
+    }
+
     if (storage.Load(dbc_filename.c_str()))
     {
         bar.step();
@@ -190,6 +213,9 @@ inline void LoadDBC(uint32& availableDbcLocales, BarGoLink& bar, StoreProblemLis
             if (!storage.LoadStringsFrom(dbc_filename_loc.c_str()))
                 availableDbcLocales &= ~(1 << i);           // mark as not available for speedup next checks
         }
+
+        if (!image_filename.empty() && !storage.SaveImage(image_filename.c_str(), sourceStamp))
+            sLog.outError("Can't write DBC store image '%s'.", image_filename.c_str());
     }
     else
     {
@@ -207,9 +233,11 @@ inline void LoadDBC(uint32& availableDbcLocales, BarGoLink& bar, StoreProblemLis
     }
 }
 
-void LoadDBCStores(const std::string& dataPath)
+void LoadDBCStores(const std::string& dataPath, const std::string& imagePath)
 {
     std::string dbcPath = dataPath + "dbc/";
+    dbcImagePath = imagePath;
+    dbcMappedImages = 0;
 
     const uint32 DBCFilesCount = 50;
 
@@ -507,6 +535,9 @@ void LoadDBCStores(const std::string& dataPath)
         exit(1);
     }
 
+    if (!dbcImagePath.empty())
+        sLog.outString(">> Mapped %u of %d data stores from images in %s", dbcMappedImages, DBCFilesCount, dbcImagePath.c_str());
+
     sLog.outString(">> Initialized %d data stores", DBCFilesCount);
     sLog.outString();
 }
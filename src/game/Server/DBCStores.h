@@ -124,7 +124,7 @@ extern DBCStorage <WMOAreaTableEntry>            sWMOAreaTableStore;
 // extern DBCStorage <WorldMapOverlayEntry>         sWorldMapOverlayStore;
 extern DBCStorage <WorldSafeLocsEntry>           sWorldSafeLocsStore;
 
-void LoadDBCStores(const std::string& dataPath);
+void LoadDBCStores(const std::string& dataPath, const std::string& imagePath);
 
 // script support functions
 DBCStorage <SoundEntriesEntry>          const* GetSoundEntriesStore();
@@ -0,0 +1,94 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Server/WorldPacketPool.h"
+#include "WorldPacket.h"
+#include "Utilities/LockFreeQueue.h"
+
+namespace
+{
+    // movement and other small opcodes, usual requests and chat, anything up to the client limit
+    size_t const PacketSizeClasses[] = { 64, 512, 0x2800 };
+    size_t const PacketSizeClassCount = sizeof(PacketSizeClasses) / sizeof(PacketSizeClasses[0]);
+
+    // free packets kept per size class
+    size_t const PooledPacketsPerClass = 4096;
+
+    struct PacketFreeLists
+    {
+        typedef MaNGOS::LockFreeQueue<std::unique_ptr<WorldPacket>> FreeList;
+
+        PacketFreeLists()
+        {
+            for (size_t i = 0; i < PacketSizeClassCount; ++i)
+                lists[i].reset(new FreeList(PooledPacketsPerClass));
+        }
+
+        std::unique_ptr<FreeList> lists[PacketSizeClassCount];
+    };
+
+    PacketFreeLists& GetFreeLists()
+    {
+        static PacketFreeLists freeLists;
+        return freeLists;
+    }
+}
+
+std::unique_ptr<WorldPacket> WorldPacketPool::Acquire(uint16 opcode, size_t size)
+{
+    for (size_t i = 0; i < PacketSizeClassCount; ++i)
+    {
+        if (size > PacketSizeClasses[i])
+            continue;
+
+        std::unique_ptr<WorldPacket> packet;
+        if (GetFreeLists().lists[i]->Pop(packet))
+        {
+            packet->Initialize(opcode, PacketSizeClasses[i]);
+            return packet;
+        }
+
+        // reserve the full class size so the packet returns to the same class
+        return std::unique_ptr<WorldPacket>(new WorldPacket(opcode, PacketSizeClasses[i]));
+    }
+
+    return std::unique_ptr<WorldPacket>(new WorldPacket(opcode, size));
+}
+
+void WorldPacketPool::Release(std::unique_ptr<WorldPacket> packet)
+{
+    if (!packet)
+        return;
+
+    size_t const capacity = packet->capacity();
+
+    // do not hoard packets that grew far past the biggest class
+    if (capacity > 2 * PacketSizeClasses[PacketSizeClassCount - 1])
+        return;
+
+    // biggest class the packet storage can serve
+    for (size_t i = PacketSizeClassCount; i > 0; --i)
+    {
+        if (capacity < PacketSizeClasses[i - 1])
+            continue;
+
+        // dropped (freed) when the class is full
+        GetFreeLists().lists[i - 1]->Push(std::move(packet));
+        return;
+    }
+}
@@ -0,0 +1,45 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _WORLDPACKETPOOL_H
+#define _WORLDPACKETPOOL_H
+
+#include "Common.h"
+
+#include <memory>
+
+class WorldPacket;
+
+/**
+ * Pool of incoming packets, so the network threads do not allocate a packet
+ * and its storage for every client message. Packets are kept in a few size
+ * classes (movement sized, common requests, up to the client limit) in lock
+ * free free-lists, acquired by the network threads and released by the world
+ * and map threads once handled.
+ */
+class WorldPacketPool
+{
+    public:
+        // an empty packet with at least size bytes reserved
+        static std::unique_ptr<WorldPacket> Acquire(uint16 opcode, size_t size);
+
+        // keep the packet storage for later use, packets not fitting any class are freed
+        static void Release(std::unique_ptr<WorldPacket> packet);
+};
+
+#endif
@@ -37,6 +37,7 @@
 #include "BattleGround/BattleGroundMgr.h"
 #include "Social/SocialMgr.h"
 #include "Loot/LootMgr.h"
+#include "Server/WorldPacketPool.h"
 
 #include <mutex>
 #include <deque>
@@ -95,7 +96,7 @@ WorldSession::WorldSession(uint32 id, WorldSocket* sock, AccountTypes sec, time_
     m_inQueue(false), m_playerLoading(false), m_playerLogout(false), m_playerRecentlyLogout(false), m_playerSave(false),
     m_sessionDbcLocale(sWorld.GetAvailableDbcLocale(locale)), m_sessionDbLocaleIndex(sObjectMgr.GetIndexForLocale(locale)),
     m_latency(0), m_clientTimeDelay(0), m_tutorialState(TUTORIALDATA_UNCHANGED), m_sessionState(WORLD_SESSION_STATE_CREATED),
-    m_requestSocket(nullptr) {}
+    m_requestSocket(nullptr), m_recvQueue(RECV_QUEUE_SIZE), m_recvOverflowed(false) {}
 
 /// WorldSession destructor
 WorldSession::~WorldSession()
@@ -151,7 +152,7 @@ void WorldSession::SetOnline()
 
 bool WorldSession::RequestNewSocket(WorldSocket* socket)
 {
-    std::lock_guard<std::mutex> guard(m_recvQueueLock);
+    std::lock_guard<std::mutex> guard(m_requestSocketLock);
     if (m_requestSocket)
         return false;
 
@@ -174,6 +175,12 @@ char const* WorldSession::GetPlayerName() const
 
 /// Send a packet to the client
 void WorldSession::SendPacket(WorldPacket const& packet, bool forcedSend /*= false*/) const
+{
+    SharedPacketContents contents;
+    SendPacket(packet, contents, forcedSend);
+}
+
+void WorldSession::SendPacket(WorldPacket const& packet, SharedPacketContents& contents, bool forcedSend /*= false*/) const
 {
 #ifdef BUILD_PLAYERBOT
     // Send packet to bot AI
@@ -228,14 +235,49 @@ void WorldSession::SendPacket(WorldPacket const& packet, bool forcedSend /*= fal
 
 #endif                                                  // !MANGOS_DEBUG
 
-    m_Socket->SendPacket(packet);
+    m_Socket->SendPacket(packet, contents);
 }
 
-/// Add an incoming packet to the queue
+/// Add an incoming packet to the queue, called by the single producer of this session only
 void WorldSession::QueuePacket(std::unique_ptr<WorldPacket> new_packet)
 {
-    std::lock_guard<std::mutex> guard(m_recvQueueLock);
-    m_recvQueue.push_back(std::move(new_packet));
+    // once the ring overflowed keep using the overflow queue until it is drained, to preserve packet order
+    if (!m_recvOverflowed.load(std::memory_order_acquire) && m_recvQueue.Push(std::move(new_packet)))
+        return;
+
+    std::lock_guard<std::mutex> guard(m_recvOverflowLock);
+    m_recvOverflow.push_back(std::move(new_packet));
+    m_recvOverflowed.store(true, std::memory_order_release);
+}
+
+/// Take the next incoming packet, overflowed packets are always newer than the ones in the ring
+/// as long as only one thread pushes: a second producer could still fill a ring slot freed after the first overflowed
+bool WorldSession::NextQueuedPacket(std::unique_ptr<WorldPacket>& packet)
+{
+    // left by the other updater, it is older than anything still queued
+    if (m_recvDeferred)
+    {
+        packet = std::move(m_recvDeferred);
+        return true;
+    }
+
+    if (m_recvQueue.Pop(packet))
+        return true;
+
+    if (!m_recvOverflowed.load(std::memory_order_acquire))
+        return false;
+
+    std::lock_guard<std::mutex> guard(m_recvOverflowLock);
+    if (m_recvOverflow.empty())
+        return false;
+
+    packet = std::move(m_recvOverflow.front());
+    m_recvOverflow.pop_front();
+
+    if (m_recvOverflow.empty())
+        m_recvOverflowed.store(false, std::memory_order_release);
+
+    return true;
 }
 
 /// Logging helper for unexpected opcodes
@@ -259,21 +301,25 @@ void WorldSession::LogUnprocessedTail(WorldPacket const& packet) const
 /// Update the WorldSession (triggered by World update)
 bool WorldSession::Update(PacketFilter& updater)
 {
-    std::lock_guard<std::mutex> guard(m_recvQueueLock);
-
     ///- Retrieve packets from the receive queue and call the appropriate handlers
     /// not process packets if socket already closed
-    while (m_Socket && !m_Socket->IsClosed() && !m_recvQueue.empty())
+    std::unique_ptr<WorldPacket> packet;
+    while (m_Socket && !m_Socket->IsClosed() && NextQueuedPacket(packet))
     {
-        auto const packet = std::move(m_recvQueue.front());
-        m_recvQueue.pop_front();
-
         /*#if 1
         sLog.outError( "MOEP: %s (0x%.4X)",
                         packet->GetOpcodeName(),
                         packet->GetOpcode());
         #endif*/
 
+        // stop at the first packet this updater may not process, it and everything after it is left
+        // to the other one (Map::Update or World::UpdateSessions) to keep the packet order
+        if (!updater.Process(*packet))
+        {
+            m_recvDeferred = std::move(packet);
+            break;
+        }
+
         OpcodeHandler const& opHandle = opcodeTable[packet->GetOpcode()];
         try
         {
@@ -362,6 +408,8 @@ bool WorldSession::Update(PacketFilter& updater)
                 KickPlayer();
             }
         }
+
+        WorldPacketPool::Release(std::move(packet));
     }
 
 #ifdef BUILD_PLAYERBOT
@@ -376,15 +424,12 @@ bool WorldSession::Update(PacketFilter& updater)
         {
             Player* const botPlayer = itr->second;
             WorldSession* const pBotWorldSession = botPlayer->GetSession();
-            while(!pBotWorldSession->m_recvQueue.empty())
+            std::unique_ptr<WorldPacket> botpacket;
+            while (pBotWorldSession->NextQueuedPacket(botpacket))
             {
-                auto const botpacket = std::move(pBotWorldSession->m_recvQueue.front());
-                pBotWorldSession->m_recvQueue.pop_front();
-
                 OpcodeHandler const& opHandle = opcodeTable[botpacket->GetOpcode()];
                 pBotWorldSession->ExecuteOpcode(opHandle, *botpacket);
             }
-            pBotWorldSession->m_recvQueue.clear();
         }
     }
 #endif
@@ -397,6 +442,7 @@ bool WorldSession::Update(PacketFilter& updater)
         {
             case WORLD_SESSION_STATE_CREATED:
             {
+                std::lock_guard<std::mutex> guard(m_requestSocketLock);
                 if (m_requestSocket)
                 {
                     if (!IsOffline())
@@ -453,6 +499,8 @@ bool WorldSession::Update(PacketFilter& updater)
                 if (ShouldDisconnect(time(nullptr)))   // check if delayed logout is fired
                 {
                     LogoutPlayer(true);
+
+                    std::lock_guard<std::mutex> guard(m_requestSocketLock);
                     if (!m_requestSocket && (!m_Socket || m_Socket->IsClosed()))
                         return false;
                 }
@@ -485,6 +533,9 @@ void WorldSession::LogoutPlayer(bool save)
 
     if (_player)
     {
+        // keep the logout writes ordered with the saves of this character
+        SqlAsyncRoute dbRoute(CharacterDatabase, _player->GetGUIDLow());
+
 #ifdef BUILD_PLAYERBOT
         // Log out all player bots owned by this toon
         if (_player->GetPlayerbotMgr())
@@ -29,7 +29,9 @@
 #include "AuctionHouse/AuctionHouseMgr.h"
 #include "Entities/Item.h"
 #include "Server/WorldSocket.h"
+#include "Utilities/LockFreeQueue.h"
 
+#include <atomic>
 #include <deque>
 #include <mutex>
 #include <memory>
@@ -74,6 +76,9 @@ enum PartyResult
     ERR_IGNORING_YOU_S                  = 8
 };
 
+// incoming packets held in the lock free ring of a session, more go to the overflow queue
+#define RECV_QUEUE_SIZE 256
+
 enum TutorialDataState
 {
     TUTORIALDATA_UNCHANGED = 0,
@@ -151,6 +156,8 @@ class WorldSession
         void SizeError(WorldPacket const& packet, uint32 size) const;
 
         void SendPacket(WorldPacket const& packet, bool forcedSend = false) const;
+        // for packets sent to many sessions, the contents are copied by the first socket and shared by the others
+        void SendPacket(WorldPacket const& packet, SharedPacketContents& contents, bool forcedSend = false) const;
         void SendExpectedSpamRecords();
         void SendMotd(Player* currChar);
         void SendNotification(const char* format, ...) const ATTR_PRINTF(2, 3);
@@ -200,6 +207,7 @@ class WorldSession
         void LogoutPlayer(bool save);
         void KickPlayer();
 
+        // single producer: only the session's socket thread (or, for a bot session, its bot AI) may call this
         void QueuePacket(std::unique_ptr<WorldPacket> new_packet);
 
         bool Update(PacketFilter& updater);
@@ -711,8 +719,20 @@ class WorldSession
         uint32 m_Tutorials[8];
         TutorialDataState m_tutorialState;
 
-        std::mutex m_recvQueueLock;
-        std::deque<std::unique_ptr<WorldPacket>> m_recvQueue;
+        // single producer, single consumer: filled only by the session's own socket thread (bot sessions only by their AI),
+        // drained by either World::UpdateSessions or Map::Update, never both at once. The ring itself would take more
+        // producers, but packet order across ring and overflow queue relies on there being only one.
+        MaNGOS::LockFreeQueue<std::unique_ptr<WorldPacket>> m_recvQueue;
+        // takes packets while the ring is full, then keeps them ordered until drained
+        std::mutex m_recvOverflowLock;
+        std::deque<std::unique_ptr<WorldPacket>> m_recvOverflow;
+        std::atomic<bool> m_recvOverflowed;
+        // consumer side only: the packet the last updater's filter rejected, returned first by NextQueuedPacket
+        std::unique_ptr<WorldPacket> m_recvDeferred;
+
+        std::mutex m_requestSocketLock;
+
+        bool NextQueuedPacket(std::unique_ptr<WorldPacket>& packet);
 };
 #endif
 /// @}
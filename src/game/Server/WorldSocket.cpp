@@ -31,6 +31,8 @@
 #include "Server/WorldSession.h"
 #include "Log.h"
 #include "Server/DBCStores.h"
+#include "Entities/UpdateData.h"
+#include "Server/WorldPacketPool.h"
 
 #include <chrono>
 #include <functional>
@@ -56,11 +58,21 @@ struct ServerPktHeader
 #endif
 
 WorldSocket::WorldSocket(boost::asio::io_service& service, std::function<void (Socket*)> closeHandler) : Socket(service, std::move(closeHandler)), m_lastPingTime(std::chrono::system_clock::time_point::min()), m_overSpeedPings(0), m_existingHeader(),
-    m_useExistingHeader(false), m_session(nullptr), m_seed(urand())
+    m_useExistingHeader(false), m_session(nullptr), m_seed(urand()), m_service(service)
+{
+}
+
+WorldSocket::~WorldSocket()
 {
 }
 
 void WorldSocket::SendPacket(const WorldPacket& pct, bool immediate)
+{
+    SharedPacketContents contents;
+    SendPacket(pct, contents, immediate);
+}
+
+void WorldSocket::SendPacket(const WorldPacket& pct, SharedPacketContents& contents, bool immediate)
 {
     if (IsClosed())
         return;
@@ -68,25 +80,90 @@ void WorldSocket::SendPacket(const WorldPacket& pct, bool immediate)
     // Dump outgoing packet.
     sLog.outWorldPacketDump(GetRemoteEndpoint().c_str(), pct.GetOpcode(), pct.GetOpcodeName(), pct, false);
 
+    // the contents are copied once, the header is encrypted per socket once queued
+    if (!contents && pct.size() > 0)
+    {
+        contents = AcquireOutBuffer();
+        contents->assign(pct.contents(), pct.contents() + pct.size());
+    }
+
+    if (!sWorld.getConfig(CONFIG_BOOL_COMPRESSION_OFFLOAD))
+    {
+        SendPacketToSocket(pct.GetOpcode(), contents, immediate);
+        return;
+    }
+
+    // all packets have to go through the queue to keep them ordered for the header encryption
+    bool scheduled;
+    {
+        std::lock_guard<std::mutex> guard(m_sendQueueLock);
+        scheduled = !m_sendQueue.empty();
+
+        QueuedPacket queued;
+        queued.opcode = pct.GetOpcode();
+        queued.contents = contents;
+        queued.immediate = immediate;
+        m_sendQueue.push_back(queued);
+    }
+
+    if (!scheduled)
+    {
+        std::shared_ptr<WorldSocket> self = shared<WorldSocket>();
+        m_service.post([self]() { self->SendQueuedPackets(); });
+    }
+}
+
+void WorldSocket::SendQueuedPackets()
+{
+    std::deque<QueuedPacket> queue;
+    {
+        std::lock_guard<std::mutex> guard(m_sendQueueLock);
+        queue.swap(m_sendQueue);
+    }
+
+    for (auto& queued : queue)
+    {
+        if (IsClosed())
+            return;
+
+        size_t size = queued.contents ? queued.contents->size() : 0;
+        if (!UpdateData::IsCompressible(queued.opcode, size))
+        {
+            SendPacketToSocket(queued.opcode, queued.contents, queued.immediate);
+            continue;
+        }
+
+        WorldPacket compressed;
+        if (UpdateData::CompressPacket(queued.contents->data(), size, compressed))
+        {
+            OutBuffer contents = AcquireOutBuffer();
+            contents->assign(compressed.contents(), compressed.contents() + compressed.size());
+            SendPacketToSocket(compressed.GetOpcode(), contents, queued.immediate);
+        }
+    }
+}
+
+void WorldSocket::SendPacketToSocket(uint16 opcode, OutBuffer const& contents, bool immediate)
+{
     ServerPktHeader header;
 
-    header.cmd = pct.GetOpcode();
+    header.cmd = opcode;
     EndianConvert(header.cmd);
 
-    header.size = static_cast<uint16>(pct.size() + 2);
+    header.size = static_cast<uint16>((contents ? contents->size() : 0) + 2);
     EndianConvertReverse(header.size);
 
-    m_crypt.EncryptSend(reinterpret_cast<uint8*>(&header), sizeof(header));
-
-    if (pct.size() > 0)
-        Write(reinterpret_cast<const char*>(&header), sizeof(header), reinterpret_cast<const char*>(pct.contents()), pct.size());
-    else
-        Write(reinterpret_cast<const char*>(&header), sizeof(header));
+    Write(reinterpret_cast<const char*>(&header), sizeof(header), contents);
 
     if (immediate)
         ForceFlushOut();
 }
 
+void WorldSocket::EncryptHeader(uint8* header, size_t size)
+{
+    m_crypt.EncryptSend(header, size);
+}
+
 bool WorldSocket::Open()
 {
     if (!Socket::Open())
@@ -169,7 +246,7 @@ bool WorldSocket::ProcessIncomingData()
     if (IsClosed())
         return false;
 
-    std::unique_ptr<WorldPacket> pct(new WorldPacket(opcode, validBytesRemaining));
+    std::unique_ptr<WorldPacket> pct = WorldPacketPool::Acquire(opcode, validBytesRemaining);
 
     if (validBytesRemaining)
     {
@@ -31,11 +31,19 @@
 #include "Network/Socket.hpp"
 
 #include <chrono>
+#include <deque>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 class WorldPacket;
 class WorldSession;
 
+// contents of a packet sent to several sessions, copied once by the first socket and queued by all of them
+typedef std::shared_ptr<std::vector<uint8>> SharedPacketContents;
+
 /**
  * WorldSocket.
  *
@@ -112,9 +120,31 @@ class WorldSocket : public MaNGOS::Socket
 
         BigNumber m_s;
 
+        boost::asio::io_service& m_service;
+
+        struct QueuedPacket
+        {
+            uint16 opcode;
+            OutBuffer contents;                             // nullptr for empty packets
+            bool immediate;
+        };
+
+        /// Packets waiting to be compressed and sent by the network thread (Compression.Offload)
+        std::deque<QueuedPacket> m_sendQueue;
+        std::mutex m_sendQueueLock;
+
+        /// Encrypt the header and queue it with the contents on the socket
+        void SendPacketToSocket(uint16 opcode, OutBuffer const& contents, bool immediate);
+
+        /// Called in the network thread to flush m_sendQueue
+        void SendQueuedPackets();
+
         /// process one incoming packet.
         virtual bool ProcessIncomingData() override;
 
+        /// Encrypt an outgoing header in place, called in send order by the socket.
+        virtual void EncryptHeader(uint8* header, size_t size) override;
+
         /// Called by ProcessIncoming() on CMSG_AUTH_SESSION.
         bool HandleAuthSession(WorldPacket& recvPacket);
 
@@ -123,9 +153,12 @@ class WorldSocket : public MaNGOS::Socket
 
     public:
         WorldSocket(boost::asio::io_service& service, std::function<void (Socket*)> closeHandler);
+        ~WorldSocket();
 
         // send a packet \o/
         void SendPacket(const WorldPacket& pct, bool immediate = false);
+        // send a packet also sent to other sockets, contents are filled at the first call and shared afterwards
+        void SendPacket(const WorldPacket& pct, SharedPacketContents& contents, bool immediate = false);
 
         void FinalizeSession() { m_session = nullptr; }
 
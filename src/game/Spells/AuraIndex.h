@@ -0,0 +1,184 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _AURA_INDEX_H_INCLUDED
+#define _AURA_INDEX_H_INCLUDED
+
+#include "Platform/Define.h"
+#include "Spells/SpellAuraDefines.h"
+#include "Errors.h"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+class Aura;
+
+/**
+ * Auras of one aura type in apply order, stored contiguously.
+ *
+ * Iterators hold a position instead of a pointer, so auras added while a list is walked
+ * (triggered spells, handlers applying other auras) do not invalidate running loops, and
+ * end() stays the end of the list when it grows. The aura an iterator points to must not
+ * be removed before the iterator is moved past it; loops removing auras restart at begin()
+ * or walk a copy of the list.
+ */
+class ModAuraList
+{
+    public:
+        class const_iterator
+        {
+            public:
+                typedef std::forward_iterator_tag iterator_category;
+                typedef Aura* value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef Aura* const* pointer;
+                typedef Aura* const& reference;
+
+                const_iterator() : m_list(nullptr), m_pos(0) {}
+                const_iterator(ModAuraList const* list, size_t pos) : m_list(list), m_pos(pos) {}
+
+                reference operator*() const { return m_list->m_auras[m_pos]; }
+                pointer operator->() const { return &m_list->m_auras[m_pos]; }
+
+                const_iterator& operator++() { ++m_pos; return *this; }
+                const_iterator operator++(int) { const_iterator itr = *this; ++m_pos; return itr; }
+
+                bool operator==(const_iterator const& other) const
+                {
+                    bool atEnd = IsAtEnd();
+                    return atEnd == other.IsAtEnd() && (atEnd || m_pos == other.m_pos);
+                }
+                bool operator!=(const_iterator const& other) const { return !(*this == other); }
+
+            private:
+                friend class ModAuraList;
+
+                bool IsAtEnd() const { return !m_list || m_pos >= m_list->m_auras.size(); }
+
+                ModAuraList const* m_list;
+                size_t m_pos;
+        };
+        typedef const_iterator iterator;
+        typedef std::vector<Aura*>::const_reverse_iterator const_reverse_iterator; // only for loops not changing the list
+
+        // sums and extremes of m_amount over the list, kept until the list or an amount in it changes
+        struct Totals
+        {
+            int32 total;
+            float multiplier;
+            int32 maxPositive;
+            int32 maxNegative;
+        };
+
+        ModAuraList() : m_totalsValid(false) {}
+
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, size_t(-1)); }
+        const_reverse_iterator rbegin() const { return m_auras.rbegin(); }
+        const_reverse_iterator rend() const { return m_auras.rend(); }
+
+        bool empty() const { return m_auras.empty(); }
+        size_t size() const { return m_auras.size(); }
+        Aura* front() const { return m_auras.front(); }
+
+        void push_back(Aura* aura) { m_auras.push_back(aura); m_totalsValid = false; }
+        void remove(Aura* aura)
+        {
+            m_auras.erase(std::remove(m_auras.begin(), m_auras.end(), aura), m_auras.end());
+            m_totalsValid = false;
+        }
+        void erase(const_iterator itr)
+        {
+            MANGOS_ASSERT(itr.m_list == this && !itr.IsAtEnd());
+            m_auras.erase(m_auras.begin() + itr.m_pos);
+            m_totalsValid = false;
+        }
+        void clear() { m_auras.clear(); m_totalsValid = false; }
+
+        // empty lists have constant totals and are never written, the shared empty list of ModAuraIndex is read by all threads
+        bool HasTotals() const { return m_totalsValid || m_auras.empty(); }
+        Totals const& GetTotals() const { return m_auras.empty() ? GetEmptyTotals() : m_totals; }
+        void SetTotals(Totals const& totals) const { m_totals = totals; m_totalsValid = true; }
+        void InvalidateTotals() { m_totalsValid = false; }
+
+    private:
+        static Totals const& GetEmptyTotals()
+        {
+            static Totals const emptyTotals = { 0, 1.0f, 0, 0 };
+            return emptyTotals;
+        }
+
+        std::vector<Aura*> m_auras;
+
+        mutable Totals m_totals;
+        mutable bool m_totalsValid;
+};
+
+/**
+ * Per aura type lists of a unit.
+ *
+ * A unit has auras of only a few of the TOTAL_AURAS types at a time, so lists are only
+ * created for types that got an aura, and looked up through a byte per type. Created lists
+ * are kept for the lifetime of the unit as callers hold references to them across removals.
+ */
+class ModAuraIndex
+{
+    public:
+        ModAuraIndex() { std::fill(std::begin(m_slotOfType), std::end(m_slotOfType), 0); }
+
+        // types without a list share one empty list
+        ModAuraList const& operator[](AuraType type) const
+        {
+            uint8 slot = m_slotOfType[type];
+            return slot ? *m_slots[slot - 1] : GetEmptyList();
+        }
+
+        // creates the list of the type if it has none yet
+        ModAuraList& operator[](AuraType type)
+        {
+            uint8& slot = m_slotOfType[type];
+            if (!slot)
+            {
+                MANGOS_ASSERT(m_slots.size() < 0xFF);
+                m_slots.push_back(std::unique_ptr<ModAuraList>(new ModAuraList));
+                slot = uint8(m_slots.size());
+            }
+            return *m_slots[slot - 1];
+        }
+
+        // to be called when m_amount of an aura of the type changed in place
+        void InvalidateTotals(AuraType type)
+        {
+            if (uint8 slot = m_slotOfType[type])
+                m_slots[slot - 1]->InvalidateTotals();
+        }
+
+    private:
+        static ModAuraList const& GetEmptyList()
+        {
+            static ModAuraList const emptyList;
+            return emptyList;
+        }
+
+        uint8 m_slotOfType[TOTAL_AURAS];                    // 1-based index in m_slots, 0 for types without list
+        std::vector<std::unique_ptr<ModAuraList>> m_slots;
+};
+
+#endif //_AURA_INDEX_H_INCLUDED
@@ -639,7 +639,12 @@ void Aura::ApplyModifier(bool apply, bool Real)
     AuraType aura = m_modifier.m_auraname;
 
     if (aura < TOTAL_AURAS)
+    {
+        // handlers and their callers may change m_amount in place
+        GetTarget()->InvalidateAuraTotals(aura);
         (*this.*AuraHandler [aura])(apply, Real);
+        GetTarget()->InvalidateAuraTotals(aura);
+    }
 }
 
 bool Aura::isAffectedOnSpell(SpellEntry const* spell) const
@@ -2212,6 +2212,9 @@ class SpellMgr
             return nullptr;
         }
 
+        // changed by each (re)load of spell_proc_event, units rebuild their proc holder lists on change
+        uint32 GetSpellProcEventGeneration() const { return mSpellProcEventGeneration; }
+
         // Spell procs from item enchants
         float GetItemEnchantProcChance(uint32 spellid) const
         {
@@ -2563,6 +2566,7 @@ class SpellMgr
         SpellElixirMap     mSpellElixirs;
         SpellThreatMap     mSpellThreatMap;
         SpellProcEventMap  mSpellProcEventMap;
+        uint32             mSpellProcEventGeneration;
         SpellProcItemEnchantMap mSpellProcItemEnchantMap;
         SpellBonusMap      mSpellBonusMap;
         SkillLineAbilityMap mSkillLineAbilityMapBySpellId;
@@ -393,20 +393,31 @@ void Unit::ProcDamageAndSpellFor(ProcSystemArguments& argData, bool isVictim)
 {
     ProcExecutionData execData(argData, isVictim);
 
+    // spell_proc_event was reloaded since the flags were taken
+    if (m_procHoldersGeneration != sSpellMgr.GetSpellProcEventGeneration())
+        RebuildProcHolders();
+
+    // No holder can react to these flags
+    if (!(execData.procFlags & m_procHoldersFlags))
+        return;
+
     RemoveSpellList removedSpells;
     ProcTriggeredList procTriggered;
     // Fill procTriggered list
-    for (SpellAuraHolderMap::const_iterator itr = GetSpellAuraHolderMap().begin(); itr != GetSpellAuraHolderMap().end(); ++itr)
+    for (ProcHolderEntry const& entry : m_procHolders)
     {
+        if (!(entry.procFlags & execData.procFlags))
+            continue;
+
         // skip deleted auras (possible at recursive triggered call
-        if (itr->second->GetState() != SPELLAURAHOLDER_STATE_READY || itr->second->IsDeleted())
+        if (entry.holder->GetState() != SPELLAURAHOLDER_STATE_READY || entry.holder->IsDeleted())
             continue;
 
         SpellProcEventEntry const* spellProcEvent = nullptr;
-        if (!IsTriggeredAtSpellProcEvent(execData, itr->second, spellProcEvent))
+        if (!IsTriggeredAtSpellProcEvent(execData, entry.holder, spellProcEvent))
             continue;
 
-        procTriggered.push_back(ProcTriggeredData(spellProcEvent, itr->second));
+        procTriggered.push_back(ProcTriggeredData(spellProcEvent, entry.holder));
     }
 
     // Nothing found
@@ -490,6 +501,51 @@ void Unit::ProcDamageAndSpellFor(ProcSystemArguments& argData, bool isVictim)
     }
 }
 
+void Unit::AddProcHolder(SpellAuraHolder* holder)
+{
+    SpellEntry const* spellProto = holder->GetSpellProto();
+    SpellProcEventEntry const* spellProcEvent = sSpellMgr.GetSpellProcEvent(spellProto->Id);
+
+    // same flags as used in IsTriggeredAtSpellProcEvent
+    ProcHolderEntry entry;
+    entry.holder = holder;
+    entry.procFlags = spellProcEvent && spellProcEvent->procFlags ? spellProcEvent->procFlags : spellProto->procFlags;
+    if (!entry.procFlags)
+        return;
+
+    // keep spell id order of the holder map, new holders after holders of the same spell
+    auto itr = std::upper_bound(m_procHolders.begin(), m_procHolders.end(), holder->GetId(),
+                                [](uint32 spellId, ProcHolderEntry const& other) { return spellId < other.holder->GetId(); });
+    m_procHolders.insert(itr, entry);
+    m_procHoldersFlags |= entry.procFlags;
+}
+
+void Unit::RemoveProcHolder(SpellAuraHolder* holder)
+{
+    for (auto itr = m_procHolders.begin(); itr != m_procHolders.end(); ++itr)
+    {
+        if (itr->holder == holder)
+        {
+            m_procHolders.erase(itr);
+
+            m_procHoldersFlags = 0;
+            for (ProcHolderEntry const& entry : m_procHolders)
+                m_procHoldersFlags |= entry.procFlags;
+            return;
+        }
+    }
+}
+
+void Unit::RebuildProcHolders()
+{
+    m_procHolders.clear();
+    m_procHoldersFlags = 0;
+    m_procHoldersGeneration = sSpellMgr.GetSpellProcEventGeneration();
+
+    for (SpellAuraHolderMap::const_iterator itr = m_spellAuraHolders.begin(); itr != m_spellAuraHolders.end(); ++itr)
+        AddProcHolder(itr->second);
+}
+
 bool Unit::IsTriggeredAtSpellProcEvent(ProcExecutionData& data, SpellAuraHolder* holder, SpellProcEventEntry const*& spellProcEvent)
 {
     SpellEntry const* spellProto = holder->GetSpellProto();
@@ -1038,6 +1038,7 @@ enum MangosStrings
     // FREE IDS                           1700-9999
     LANG_NPC_THREAT_PLAYER              = 1702,
     LANG_NPC_THREAT_SELECTED_CREATURE   = 1703,
+    LANG_PLAYER_SAVED_STATEMENTS        = 1704,
 
     // Use for not-in-official-sources patches
     //                                    10000-10999
@@ -486,6 +486,8 @@ void WorldSession::HandleAcceptTradeOpcode(WorldPacket& recvPacket)
         trader->m_trade = nullptr;
 
         // desynchronized with the other saves here (SaveInventoryAndGoldToDB() not have own transaction guards)
+        // but ordered with the pending saves of both characters
+        SqlAsyncRoute dbRoute(CharacterDatabase, _player->GetGUIDLow(), trader->GetGUIDLow());
         CharacterDatabase.BeginTransaction();
         _player->SaveInventoryAndGoldToDB();
         trader->SaveInventoryAndGoldToDB();
@@ -21,6 +21,7 @@
 */
 
 #include "World/World.h"
+#include "World/WorldLoader.h"
 #include "Database/DatabaseEnv.h"
 #include "Config/Config.h"
 #include "Platform/Define.h"
@@ -466,6 +467,8 @@ void World::LoadConfigSettings(bool reload)
 
     ///- Read other configuration items from the config file
     setConfigMinMax(CONFIG_UINT32_COMPRESSION, "Compression", 1, 1, 9);
+    if (configNoReload(reload, CONFIG_BOOL_COMPRESSION_OFFLOAD, "Compression.Offload", false))
+        setConfig(CONFIG_BOOL_COMPRESSION_OFFLOAD, "Compression.Offload", false);
     setConfig(CONFIG_BOOL_ADDON_CHANNEL, "AddonChannel", true);
     setConfig(CONFIG_BOOL_CLEAN_CHARACTER_DB, "CleanCharacterDB", true);
     setConfig(CONFIG_BOOL_GRID_UNLOAD, "GridUnload", true);
@@ -493,6 +496,23 @@ void World::LoadConfigSettings(bool reload)
     if (reload)
         sMapMgr.SetMapUpdateInterval(getConfig(CONFIG_UINT32_INTERVAL_MAPUPDATE));
 
+    if (configNoReload(reload, CONFIG_UINT32_NUM_MAP_THREADS, "MapUpdate.Threads", 0))
+        setConfig(CONFIG_UINT32_NUM_MAP_THREADS, "MapUpdate.Threads", 0);
+
+    if (configNoReload(reload, CONFIG_UINT32_NUM_MAP_REGION_THREADS, "MapUpdate.ContinentRegionThreads", 0))
+        setConfig(CONFIG_UINT32_NUM_MAP_REGION_THREADS, "MapUpdate.ContinentRegionThreads", 0);
+
+    if (configNoReload(reload, CONFIG_UINT32_NUM_GRID_PRELOAD_THREADS, "MapUpdate.GridPreloadThreads", 0))
+        setConfig(CONFIG_UINT32_NUM_GRID_PRELOAD_THREADS, "MapUpdate.GridPreloadThreads", 0);
+
+    setConfig(CONFIG_UINT32_GRID_PRELOAD_LOOKAHEAD, "MapUpdate.GridPreloadLookahead", 10 * IN_MILLISECONDS);
+
+    if (configNoReload(reload, CONFIG_UINT32_NUM_PATHFINDING_THREADS, "MapUpdate.PathfindingThreads", 0))
+        setConfig(CONFIG_UINT32_NUM_PATHFINDING_THREADS, "MapUpdate.PathfindingThreads", 0);
+
+    if (configNoReload(reload, CONFIG_UINT32_NUM_LOAD_THREADS, "WorldLoad.Threads", 0))
+        setConfig(CONFIG_UINT32_NUM_LOAD_THREADS, "WorldLoad.Threads", 0);
+
     setConfig(CONFIG_UINT32_INTERVAL_CHANGEWEATHER, "ChangeWeatherInterval", 10 * MINUTE * IN_MILLISECONDS);
 
     if (configNoReload(reload, CONFIG_UINT32_PORT_WORLD, "WorldServerPort", DEFAULT_WORLDSERVER_PORT))
@@ -814,6 +834,19 @@ void World::LoadConfigSettings(bool reload)
         sLog.outString("Using DataDir %s", m_dataPath.c_str());
     }
 
+    ///- Read the DBC store image directory, empty to always load the stores from the dbc files
+    std::string dbcImagePath = sConfig.GetStringDefault("DBC.ImageDir", "");
+    if (!dbcImagePath.empty() && dbcImagePath.at(dbcImagePath.length() - 1) != '/' && dbcImagePath.at(dbcImagePath.length() - 1) != '\\')
+        dbcImagePath.append("/");
+
+    if (reload)
+    {
+        if (dbcImagePath != m_dbcImagePath)
+            sLog.outError("DBC.ImageDir option can't be changed at mangosd.conf reload, using current value (%s).", m_dbcImagePath.c_str());
+    }
+    else
+        m_dbcImagePath = dbcImagePath;
+
     setConfig(CONFIG_BOOL_VMAP_INDOOR_CHECK, "vmap.enableIndoorCheck", true);
     bool enableLOS = sConfig.GetBoolDefault("vmap.enableLOS", false);
     bool enableHeight = sConfig.GetBoolDefault("vmap.enableHeight", false);
@@ -887,360 +920,196 @@ void World::SetInitialWorldSettings()
     ///- Remove the bones (they should not exist in DB though) and old corpses after a restart
     CharacterDatabase.PExecute("DELETE FROM corpse WHERE corpse_type = '0' OR time < (UNIX_TIMESTAMP()-'%u')", 3 * DAY);
 
+    ///- Static data and dynamic data tables are loaded as dependent tasks, independent ones run concurrently with WorldLoad.Threads
+    WorldLoader loader;
+
     /// load spell_dbc first! dbc's need them
-    sLog.outString("Loading spell_template...");
-    sObjectMgr.LoadSpellTemplate();
+    uint32 spellTemplate = loader.AddTask("Loading spell_template", []() { sObjectMgr.LoadSpellTemplate(); });
 
     ///- Load the DBC files
-    sLog.outString("Initialize DBC data stores...");
-    LoadDBCStores(m_dataPath);
-    DetectDBCLang();
-    sObjectMgr.SetDBCLocaleIndex(GetDefaultDbcLocale());    // Get once for all the locale index of DBC language (console/broadcasts)
+    uint32 dbc = loader.AddTask("Initialize DBC data stores", [this]()
+    {
+        LoadDBCStores(m_dataPath, m_dbcImagePath);
+        DetectDBCLang();
+        sObjectMgr.SetDBCLocaleIndex(GetDefaultDbcLocale());    // Get once for all the locale index of DBC language (console/broadcasts)
+    }, { spellTemplate });
 
     // Loading cameras for characters creation cinematic
-    sLog.outString("Loading cinematic...");
-    LoadM2Cameras(m_dataPath);
-
-    sLog.outString("Loading Script Names...");
-    sScriptDevAIMgr.LoadScriptNames();
+    loader.AddTask("Loading cinematic", [this]() { LoadM2Cameras(m_dataPath); }, { dbc });
 
-    sLog.outString("Loading WorldTemplate...");
-    sObjectMgr.LoadWorldTemplate();
+    uint32 scriptNames = loader.AddTask("Loading Script Names", []() { sScriptDevAIMgr.LoadScriptNames(); });
 
-    sLog.outString("Loading InstanceTemplate...");
-    sObjectMgr.LoadInstanceTemplate();
-
-    sLog.outString("Loading SkillLineAbilityMultiMaps Data...");
-    sSpellMgr.LoadSkillLineAbilityMaps();
-
-    sLog.outString("Loading SkillRaceClassInfoMultiMap Data...");
-    sSpellMgr.LoadSkillRaceClassInfoMap();
+    loader.AddTask("Loading WorldTemplate", []() { sObjectMgr.LoadWorldTemplate(); }, { dbc, scriptNames });
+    loader.AddTask("Loading InstanceTemplate", []() { sObjectMgr.LoadInstanceTemplate(); }, { dbc, scriptNames });
+    uint32 skillLineAbility = loader.AddTask("Loading SkillLineAbilityMultiMaps Data", []() { sSpellMgr.LoadSkillLineAbilityMaps(); }, { dbc });
+    uint32 skillRaceClass = loader.AddTask("Loading SkillRaceClassInfoMultiMap Data", []() { sSpellMgr.LoadSkillRaceClassInfoMap(); }, { dbc });
 
     ///- Clean up and pack instances
-    sLog.outString("Cleaning up instances...");
-    sMapPersistentStateMgr.CleanupInstances();              // must be called before `creature_respawn`/`gameobject_respawn` tables
-
-    sLog.outString("Packing instances...");
-    sMapPersistentStateMgr.PackInstances();
-
-    sLog.outString("Packing groups...");
-    sObjectMgr.PackGroupIds();                              // must be after CleanupInstances
-
-    ///- Init highest guids before any guid using table loading to prevent using not initialized guids in some code.
-    sObjectMgr.SetHighestGuids();                           // must be after packing instances
-    sLog.outString();
-
-    sLog.outString("Loading Page Texts...");
-    sObjectMgr.LoadPageTexts();
-
-    sLog.outString("Loading Game Object Templates...");     // must be after LoadPageTexts
-    sObjectMgr.LoadGameobjectInfo();
-
-    sLog.outString("Loading GameObject models...");
-    LoadGameObjectModelList();
-    sLog.outString();
-
-    sLog.outString("Loading Spell Chain Data...");
-    sSpellMgr.LoadSpellChains();
-
-    sLog.outString("Checking Spell Cone Data...");
-    sObjectMgr.CheckSpellCones();
-
-    sLog.outString("Loading Spell Elixir types...");
-    sSpellMgr.LoadSpellElixirs();
-
-    sLog.outString("Loading Spell Facing Flags...");
-    sSpellMgr.LoadFacingCasterFlags();
-
-    sLog.outString("Loading Spell Learn Skills...");
-    sSpellMgr.LoadSpellLearnSkills();                       // must be after LoadSpellChains
-
-    sLog.outString("Loading Spell Learn Spells...");
-    sSpellMgr.LoadSpellLearnSpells();
-
-    sLog.outString("Loading Spell Proc Event conditions...");
-    sSpellMgr.LoadSpellProcEvents();
-
-    sLog.outString("Loading Spell Bonus Data...");
-    sSpellMgr.LoadSpellBonuses();
-
-    sLog.outString("Loading Spell Proc Item Enchant...");
-    sSpellMgr.LoadSpellProcItemEnchant();                   // must be after LoadSpellChains
-
-    sLog.outString("Loading Aggro Spells Definitions...");
-    sSpellMgr.LoadSpellThreats();
-
-    sLog.outString("Loading NPC Texts...");
-    sObjectMgr.LoadGossipText();
-
-    sLog.outString("Loading Item Random Enchantments Table...");
-    LoadRandomEnchantmentsTable();
-
-    sLog.outString("Loading Item Templates...");            // must be after LoadRandomEnchantmentsTable and LoadPageTexts
-    sObjectMgr.LoadItemPrototypes();
-
-    sLog.outString("Loading Item Texts...");
-    sObjectMgr.LoadItemTexts();
-
-    sLog.outString("Loading Creature Model Based Info Data...");
-    sObjectMgr.LoadCreatureModelInfo();
-
-    sLog.outString("Loading Equipment templates...");
-    sObjectMgr.LoadEquipmentTemplates();
-
-    sLog.outString("Loading Creature Stats...");
-    sObjectMgr.LoadCreatureClassLvlStats();
-
-    sLog.outString("Loading Creature templates...");
-    sObjectMgr.LoadCreatureTemplates();
-
-    sLog.outString("Loading Creature template spells...");
-    sObjectMgr.LoadCreatureTemplateSpells();
-
-    sLog.outString("Loading ItemRequiredTarget...");
-    sObjectMgr.LoadItemRequiredTarget();
-
-    sLog.outString("Loading Reputation Reward Rates...");
-    sObjectMgr.LoadReputationRewardRate();
-
-    sLog.outString("Loading Creature Reputation OnKill Data...");
-    sObjectMgr.LoadReputationOnKill();
-
-    sLog.outString("Loading Reputation Spillover Data...");
-    sObjectMgr.LoadReputationSpilloverTemplate();
-
-    sLog.outString("Loading Points Of Interest Data...");
-    sObjectMgr.LoadPointsOfInterest();
-
-    sLog.outString("Loading Pet Create Spells...");
-    sObjectMgr.LoadPetCreateSpells();
-
-    sLog.outString("Loading Creature Conditional Spawn Data...");  // must be after LoadCreatureTemplates and before LoadCreatures
-    sObjectMgr.LoadCreatureConditionalSpawn();
-
-    sLog.outString("Loading Creature Data...");
-    sObjectMgr.LoadCreatures();
-
-    sLog.outString("Loading SpellsScriptTarget...");
-    sSpellMgr.LoadSpellScriptTarget();                      // must be after LoadCreatureTemplates, LoadCreatures and LoadGameobjectInfo
-
-    sLog.outString("Loading Creature Addon Data...");
-    sObjectMgr.LoadCreatureAddons();                        // must be after LoadCreatureTemplates() and LoadCreatures()
-    sLog.outString(">>> Creature Addon Data loaded");
-    sLog.outString();
-
-    sLog.outString("Loading Gameobject Data...");
-    sObjectMgr.LoadGameObjects();
-
-    sLog.outString("Loading CreatureLinking Data...");      // must be after Creatures
-    sCreatureLinkingMgr.LoadFromDB();
-
-    sLog.outString("Loading Objects Pooling Data...");
-    sPoolMgr.LoadFromDB();
-
-    sLog.outString("Loading Weather Data...");
-    sWeatherMgr.LoadWeatherZoneChances();
-
-    sLog.outString("Loading Quests...");
-    sObjectMgr.LoadQuests();                                // must be loaded after DBCs, creature_template, item_template, gameobject tables
-
-    sLog.outString("Loading Quests Relations...");
-    sObjectMgr.LoadQuestRelations();                        // must be after quest load
-    sLog.outString(">>> Quests Relations loaded");
-    sLog.outString();
-
-    sLog.outString("Loading Game Event Data...");           // must be after sPoolMgr.LoadFromDB and quests to properly load pool events and quests for events
-    sGameEventMgr.LoadFromDB();
-    sLog.outString(">>> Game Event Data loaded");
-    sLog.outString();
-
-    sLog.outString("Loading Dungeon Encounters...");
-    sObjectMgr.LoadDungeonEncounters();                     // Load DungeonEncounter.dbc from DB
-
-    sLog.outString("Loading Conditions...");                // Load Conditions
-    sObjectMgr.LoadConditions();
-
-    sLog.outString("Creating map persistent states for non-instanceable maps...");     // must be after PackInstances(), LoadCreatures(), sPoolMgr.LoadFromDB(), sGameEventMgr.LoadFromDB();
-    sMapPersistentStateMgr.InitWorldMaps();
-    sLog.outString();
-
-    sLog.outString("Loading Creature Respawn Data...");     // must be after LoadCreatures(), and sMapPersistentStateMgr.InitWorldMaps()
-    sMapPersistentStateMgr.LoadCreatureRespawnTimes();
-
-    sLog.outString("Loading Gameobject Respawn Data...");   // must be after LoadGameObjects(), and sMapPersistentStateMgr.InitWorldMaps()
-    sMapPersistentStateMgr.LoadGameobjectRespawnTimes();
-
-    sLog.outString("Loading SpellArea Data...");            // must be after quest load
-    sSpellMgr.LoadSpellAreas();
-
-    sLog.outString("Loading AreaTrigger definitions...");
-    sObjectMgr.LoadAreaTriggerTeleports();                  // must be after item template load
-
-    sLog.outString("Loading Quest Area Triggers...");
-    sObjectMgr.LoadQuestAreaTriggers();                     // must be after LoadQuests
-
-    sLog.outString("Loading Tavern Area Triggers...");
-    sObjectMgr.LoadTavernAreaTriggers();
-
-    sLog.outString("Loading AreaTrigger script names...");
-    sScriptDevAIMgr.LoadAreaTriggerScripts();
-
-    sLog.outString("Loading event id script names...");
-    sScriptDevAIMgr.LoadEventIdScripts();
-
-    sLog.outString("Loading Graveyard-zone links...");
-    sObjectMgr.LoadGraveyardZones();
-
-    sLog.outString("Loading taxi flight shortcuts...");
-    sObjectMgr.LoadTaxiShortcuts();
-
-    sLog.outString("Loading spell target destination coordinates...");
-    sSpellMgr.LoadSpellTargetPositions();
-
-    sLog.outString("Loading SpellAffect definitions...");
-    sSpellMgr.LoadSpellAffects();
-
-    sLog.outString("Loading spell pet auras...");
-    sSpellMgr.LoadSpellPetAuras();
-
-    sLog.outString("Loading Player Create Info & Level Stats...");
-    sObjectMgr.LoadPlayerInfo();
-    sLog.outString(">>> Player Create Info & Level Stats loaded");
-    sLog.outString();
-
-    sLog.outString("Loading Exploration BaseXP Data...");
-    sObjectMgr.LoadExplorationBaseXP();
-
-    sLog.outString("Loading Pet Name Parts...");
-    sObjectMgr.LoadPetNames();
-
-    CharacterDatabaseCleaner::CleanDatabase();
-    sLog.outString();
-
-    sLog.outString("Loading the max pet number...");
-    sObjectMgr.LoadPetNumber();
-
-    sLog.outString("Loading pet level stats...");
-    sObjectMgr.LoadPetLevelInfo();
-
-    sLog.outString("Loading Player Corpses...");
-    sObjectMgr.LoadCorpses();
-
-    sLog.outString("Loading Loot Tables...");
-    LoadLootTables();
-    sLog.outString(">>> Loot Tables loaded");
-    sLog.outString();
-
-    sLog.outString("Loading Skill Fishing base level requirements...");
-    sObjectMgr.LoadFishingBaseSkillLevel();
-
-    sLog.outString("Loading Instance encounters data...");  // must be after Creature loading
-    sObjectMgr.LoadInstanceEncounters();
-
-    sLog.outString("Loading Npc Text Id...");
-    sObjectMgr.LoadNpcGossips();                            // must be after load Creature and LoadGossipText
-
-    sLog.outString("Loading Scripts random templates...");  // must be before String calls
-    sScriptMgr.LoadDbScriptRandomTemplates();
+    uint32 highestGuids = loader.AddTask("Cleaning up and packing instances", []()
+    {
+        sMapPersistentStateMgr.CleanupInstances();          // must be called before `creature_respawn`/`gameobject_respawn` tables
+        sMapPersistentStateMgr.PackInstances();
+        sObjectMgr.PackGroupIds();                          // must be after CleanupInstances
+
+        ///- Init highest guids before any guid using table loading to prevent using not initialized guids in some code.
+        sObjectMgr.SetHighestGuids();                       // must be after packing instances
+    }, { dbc });
+
+    uint32 pageTexts = loader.AddTask("Loading Page Texts", []() { sObjectMgr.LoadPageTexts(); }, { dbc });
+    uint32 goInfo = loader.AddTask("Loading Game Object Templates", []() { sObjectMgr.LoadGameobjectInfo(); }, { pageTexts, scriptNames });
+    loader.AddTask("Loading GameObject models", []() { LoadGameObjectModelList(); });
+
+    uint32 spellChains = loader.AddTask("Loading Spell Chain Data", []() { sSpellMgr.LoadSpellChains(); }, { dbc });
+    loader.AddTask("Checking Spell Cone Data", []() { sObjectMgr.CheckSpellCones(); }, { spellChains });
+    loader.AddTask("Loading Spell Elixir types", []() { sSpellMgr.LoadSpellElixirs(); }, { dbc });
+    loader.AddTask("Loading Spell Facing Flags", []() { sSpellMgr.LoadFacingCasterFlags(); }, { dbc });
+    loader.AddTask("Loading Spell Learn Skills", []() { sSpellMgr.LoadSpellLearnSkills(); }, { spellChains });
+    loader.AddTask("Loading Spell Learn Spells", []() { sSpellMgr.LoadSpellLearnSpells(); }, { spellChains });
+    loader.AddTask("Loading Spell Proc Event conditions", []() { sSpellMgr.LoadSpellProcEvents(); }, { spellChains });
+    loader.AddTask("Loading Spell Bonus Data", []() { sSpellMgr.LoadSpellBonuses(); }, { spellChains });
+    loader.AddTask("Loading Spell Proc Item Enchant", []() { sSpellMgr.LoadSpellProcItemEnchant(); }, { spellChains });
+    loader.AddTask("Loading Aggro Spells Definitions", []() { sSpellMgr.LoadSpellThreats(); }, { spellChains });
+
+    uint32 gossipText = loader.AddTask("Loading NPC Texts", []() { sObjectMgr.LoadGossipText(); });
+    uint32 randomEnchants = loader.AddTask("Loading Item Random Enchantments Table", []() { LoadRandomEnchantmentsTable(); }, { dbc });
+    uint32 items = loader.AddTask("Loading Item Templates", []() { sObjectMgr.LoadItemPrototypes(); }, { randomEnchants, pageTexts, scriptNames });
+    loader.AddTask("Loading Item Texts", []() { sObjectMgr.LoadItemTexts(); }, { highestGuids });
+
+    uint32 creatureModels = loader.AddTask("Loading Creature Model Based Info Data", []() { sObjectMgr.LoadCreatureModelInfo(); }, { dbc });
+    uint32 equipment = loader.AddTask("Loading Equipment templates", []() { sObjectMgr.LoadEquipmentTemplates(); }, { items });
+    uint32 creatureStats = loader.AddTask("Loading Creature Stats", []() { sObjectMgr.LoadCreatureClassLvlStats(); });
+    uint32 creatureTemplates = loader.AddTask("Loading Creature templates", []() { sObjectMgr.LoadCreatureTemplates(); },
+    { creatureModels, equipment, creatureStats, scriptNames });
+    loader.AddTask("Loading Creature template spells", []() { sObjectMgr.LoadCreatureTemplateSpells(); }, { creatureTemplates });
+
+    loader.AddTask("Loading ItemRequiredTarget", []() { sObjectMgr.LoadItemRequiredTarget(); }, { items, creatureTemplates });
+    loader.AddTask("Loading Reputation Reward Rates", []() { sObjectMgr.LoadReputationRewardRate(); }, { dbc });
+    loader.AddTask("Loading Creature Reputation OnKill Data", []() { sObjectMgr.LoadReputationOnKill(); }, { creatureTemplates });
+    loader.AddTask("Loading Reputation Spillover Data", []() { sObjectMgr.LoadReputationSpilloverTemplate(); }, { dbc });
+    uint32 pointsOfInterest = loader.AddTask("Loading Points Of Interest Data", []() { sObjectMgr.LoadPointsOfInterest(); }, { dbc });
+    loader.AddTask("Loading Pet Create Spells", []() { sObjectMgr.LoadPetCreateSpells(); }, { creatureTemplates });
+
+    uint32 conditionalSpawn = loader.AddTask("Loading Creature Conditional Spawn Data", []() { sObjectMgr.LoadCreatureConditionalSpawn(); }, { creatureTemplates });
+    // creatures, gameobjects and corpses share the cell guid store and the terrain lookups, keep them in one chain
+    uint32 creatures = loader.AddTask("Loading Creature Data", []() { sObjectMgr.LoadCreatures(); }, { conditionalSpawn, highestGuids });
+    loader.AddTask("Loading SpellsScriptTarget", []() { sSpellMgr.LoadSpellScriptTarget(); }, { creatures, goInfo });
+    loader.AddTask("Loading Creature Addon Data", []() { sObjectMgr.LoadCreatureAddons(); }, { creatures });
+    uint32 gameObjects = loader.AddTask("Loading Gameobject Data", []() { sObjectMgr.LoadGameObjects(); }, { goInfo, creatures });
+    loader.AddTask("Loading CreatureLinking Data", []() { sCreatureLinkingMgr.LoadFromDB(); }, { creatures });
+    uint32 pools = loader.AddTask("Loading Objects Pooling Data", []() { sPoolMgr.LoadFromDB(); }, { gameObjects });
+    loader.AddTask("Loading Weather Data", []() { sWeatherMgr.LoadWeatherZoneChances(); });
+
+    uint32 quests = loader.AddTask("Loading Quests", []() { sObjectMgr.LoadQuests(); }, { creatureTemplates, goInfo, items, spellChains });
+    uint32 questRelations = loader.AddTask("Loading Quests Relations", []() { sObjectMgr.LoadQuestRelations(); }, { quests });
+    uint32 gameEvents = loader.AddTask("Loading Game Event Data", []() { sGameEventMgr.LoadFromDB(); }, { pools, questRelations });
+    uint32 dungeonEncounters = loader.AddTask("Loading Dungeon Encounters", []() { sObjectMgr.LoadDungeonEncounters(); }, { dbc });
+    uint32 conditions = loader.AddTask("Loading Conditions", []() { sObjectMgr.LoadConditions(); }, { gameEvents });
+
+    uint32 worldMaps = loader.AddTask("Creating map persistent states for non-instanceable maps", []() { sMapPersistentStateMgr.InitWorldMaps(); }, { gameEvents });
+    // respawn times and group binds can create persistent states, keep them in one chain
+    uint32 creatureRespawns = loader.AddTask("Loading Creature Respawn Data", []() { sMapPersistentStateMgr.LoadCreatureRespawnTimes(); }, { worldMaps });
+    uint32 gameObjectRespawns = loader.AddTask("Loading Gameobject Respawn Data", []() { sMapPersistentStateMgr.LoadGameobjectRespawnTimes(); }, { creatureRespawns });
+
+    loader.AddTask("Loading SpellArea Data", []() { sSpellMgr.LoadSpellAreas(); }, { conditions });
+    uint32 areaTriggers = loader.AddTask("Loading AreaTrigger definitions", []() { sObjectMgr.LoadAreaTriggerTeleports(); }, { conditions });
+    loader.AddTask("Loading Quest Area Triggers", []() { sObjectMgr.LoadQuestAreaTriggers(); }, { quests });
+    loader.AddTask("Loading Tavern Area Triggers", []() { sObjectMgr.LoadTavernAreaTriggers(); }, { dbc });
+    loader.AddTask("Loading AreaTrigger script names", []() { sScriptDevAIMgr.LoadAreaTriggerScripts(); }, { dbc, scriptNames });
+    loader.AddTask("Loading event id script names", []() { sScriptDevAIMgr.LoadEventIdScripts(); }, { scriptNames });
+    loader.AddTask("Loading Graveyard-zone links", []() { sObjectMgr.LoadGraveyardZones(); }, { dbc });
+    loader.AddTask("Loading taxi flight shortcuts", []() { sObjectMgr.LoadTaxiShortcuts(); }, { dbc });
+    loader.AddTask("Loading spell target destination coordinates", []() { sSpellMgr.LoadSpellTargetPositions(); }, { dbc });
+    loader.AddTask("Loading SpellAffect definitions", []() { sSpellMgr.LoadSpellAffects(); }, { spellChains });
+    loader.AddTask("Loading spell pet auras", []() { sSpellMgr.LoadSpellPetAuras(); }, { dbc });
+    loader.AddTask("Loading Player Create Info & Level Stats", []() { sObjectMgr.LoadPlayerInfo(); }, { items, skillLineAbility, skillRaceClass, spellChains });
+    loader.AddTask("Loading Exploration BaseXP Data", []() { sObjectMgr.LoadExplorationBaseXP(); });
+    loader.AddTask("Loading Pet Name Parts", []() { sObjectMgr.LoadPetNames(); });
+    loader.AddTask("Checking character database", []() { CharacterDatabaseCleaner::CleanDatabase(); }, { skillLineAbility, highestGuids });
+    loader.AddTask("Loading the max pet number", []() { sObjectMgr.LoadPetNumber(); }, { highestGuids });
+    loader.AddTask("Loading pet level stats", []() { sObjectMgr.LoadPetLevelInfo(); }, { creatureTemplates });
+    loader.AddTask("Loading Player Corpses", []() { sObjectMgr.LoadCorpses(); }, { worldMaps });
+
+    uint32 loot = loader.AddTask("Loading Loot Tables", []() { LoadLootTables(); }, { conditions });
+    loader.AddTask("Loading Skill Fishing base level requirements", []() { sObjectMgr.LoadFishingBaseSkillLevel(); }, { dbc });
+    loader.AddTask("Loading Instance encounters data", []() { sObjectMgr.LoadInstanceEncounters(); }, { creatureTemplates, dungeonEncounters });
+    loader.AddTask("Loading Npc Text Id", []() { sObjectMgr.LoadNpcGossips(); }, { creatures, gossipText });
+
+    uint32 scriptTemplates = loader.AddTask("Loading Scripts random templates", []() { sScriptMgr.LoadDbScriptRandomTemplates(); });  // must be before String calls
     ///- Load and initialize DBScripts Engine
-    sLog.outString("Loading DB-Scripts Engine...");
-    sScriptMgr.LoadRelayScripts();                          // must be first in dbscripts loading
-    sScriptMgr.LoadGossipScripts();                         // must be before gossip menu options
-    sScriptMgr.LoadQuestStartScripts();                     // must be after load Creature/Gameobject(Template/Data) and QuestTemplate
-    sScriptMgr.LoadQuestEndScripts();                       // must be after load Creature/Gameobject(Template/Data) and QuestTemplate
-    sScriptMgr.LoadSpellScripts();                          // must be after load Creature/Gameobject(Template/Data)
-    sScriptMgr.LoadGameObjectScripts();                     // must be after load Creature/Gameobject(Template/Data)
-    sScriptMgr.LoadGameObjectTemplateScripts();             // must be after load Creature/Gameobject(Template/Data)
-    sScriptMgr.LoadEventScripts();                          // must be after load Creature/Gameobject(Template/Data)
-    sScriptMgr.LoadCreatureDeathScripts();                  // must be after load Creature/Gameobject(Template/Data)
-    sScriptMgr.LoadCreatureMovementScripts();               // before loading from creature_movement
-    sObjectMgr.LoadAreatriggerLocales();
-    sLog.outString(">>> Scripts loaded");
-    sLog.outString();
-
-    sLog.outString("Loading Scripts text locales...");      // must be after Load*Scripts calls
-    sScriptMgr.LoadDbScriptStrings();
-
-    sLog.outString("Loading Gossip Menus...");
-    sObjectMgr.LoadGossipMenus();
-
-    sLog.outString("Loading Vendors...");
-    sObjectMgr.LoadVendorTemplates();                       // must be after load ItemTemplate
-    sObjectMgr.LoadVendors();                               // must be after load CreatureTemplate, VendorTemplate, and ItemTemplate
-
-    sLog.outString("Loading Trainers...");
-    sObjectMgr.LoadTrainerTemplates();                      // must be after load CreatureTemplate
-    sObjectMgr.LoadTrainers();                              // must be after load CreatureTemplate, TrainerTemplate
-
-    sLog.outString("Loading Waypoint scripts...");
-
-    sLog.outString("Loading Waypoints...");
-    sWaypointMgr.Load();
-
-    sLog.outString("Loading ReservedNames...");
-    sObjectMgr.LoadReservedPlayersNames();
-
-    sLog.outString("Loading GameObjects for quests...");
-    sObjectMgr.LoadGameObjectForQuests();
-
-    sLog.outString("Loading BattleMasters...");
-    sBattleGroundMgr.LoadBattleMastersEntry();
-
-    sLog.outString("Loading BattleGround event indexes...");
-    sBattleGroundMgr.LoadBattleEventIndexes();
-
-    sLog.outString("Loading GameTeleports...");
-    sObjectMgr.LoadGameTele();
-
-    sLog.outString("Loading Questgiver Greetings...");
-    sObjectMgr.LoadQuestgiverGreeting();
-
-    sLog.outString("Loading Trainer Greetings...");
-    sObjectMgr.LoadTrainerGreetings();
+    uint32 dbScripts = loader.AddTask("Loading DB-Scripts Engine", []()
+    {
+        sScriptMgr.LoadRelayScripts();                      // must be first in dbscripts loading
+        sScriptMgr.LoadGossipScripts();                     // must be before gossip menu options
+        sScriptMgr.LoadQuestStartScripts();                 // must be after load Creature/Gameobject(Template/Data) and QuestTemplate
+        sScriptMgr.LoadQuestEndScripts();                   // must be after load Creature/Gameobject(Template/Data) and QuestTemplate
+        sScriptMgr.LoadSpellScripts();                      // must be after load Creature/Gameobject(Template/Data)
+        sScriptMgr.LoadGameObjectScripts();                 // must be after load Creature/Gameobject(Template/Data)
+        sScriptMgr.LoadGameObjectTemplateScripts();         // must be after load Creature/Gameobject(Template/Data)
+        sScriptMgr.LoadEventScripts();                      // must be after load Creature/Gameobject(Template/Data)
+        sScriptMgr.LoadCreatureDeathScripts();              // must be after load Creature/Gameobject(Template/Data)
+        sScriptMgr.LoadCreatureMovementScripts();           // before loading from creature_movement
+        sObjectMgr.LoadAreatriggerLocales();
+    }, { scriptTemplates, gameObjects, questRelations, conditions, areaTriggers });
+
+    uint32 scriptStrings = loader.AddTask("Loading Scripts text locales", []() { sScriptMgr.LoadDbScriptStrings(); }, { dbScripts });  // must be after Load*Scripts calls
+    uint32 gossipMenus = loader.AddTask("Loading Gossip Menus", []() { sObjectMgr.LoadGossipMenus(); }, { dbScripts, gossipText, pointsOfInterest });
+
+    loader.AddTask("Loading Vendors", []()
+    {
+        sObjectMgr.LoadVendorTemplates();                   // must be after load ItemTemplate
+        sObjectMgr.LoadVendors();                           // must be after load CreatureTemplate, VendorTemplate, and ItemTemplate
+    }, { conditions });
+
+    loader.AddTask("Loading Trainers", []()
+    {
+        sObjectMgr.LoadTrainerTemplates();                  // must be after load CreatureTemplate
+        sObjectMgr.LoadTrainers();                          // must be after load CreatureTemplate, TrainerTemplate
+    }, { conditions, skillLineAbility });
+
+    loader.AddTask("Loading Waypoints", []() { sWaypointMgr.Load(); }, { dbScripts });
+    loader.AddTask("Loading ReservedNames", []() { sObjectMgr.LoadReservedPlayersNames(); });
+    loader.AddTask("Loading GameObjects for quests", []() { sObjectMgr.LoadGameObjectForQuests(); }, { loot });
+    loader.AddTask("Loading BattleMasters", []() { sBattleGroundMgr.LoadBattleMastersEntry(); }, { dbc });
+    loader.AddTask("Loading BattleGround event indexes", []() { sBattleGroundMgr.LoadBattleEventIndexes(); }, { gameObjects });
+    loader.AddTask("Loading GameTeleports", []() { sObjectMgr.LoadGameTele(); }, { dbc });
+    uint32 questgiverGreetings = loader.AddTask("Loading Questgiver Greetings", []() { sObjectMgr.LoadQuestgiverGreeting(); }, { creatureTemplates, goInfo });
+    uint32 trainerGreetings = loader.AddTask("Loading Trainer Greetings", []() { sObjectMgr.LoadTrainerGreetings(); }, { creatureTemplates });
 
     ///- Loading localization data
-    sLog.outString("Loading Localization strings...");
-    sObjectMgr.LoadCreatureLocales();                       // must be after CreatureInfo loading
-    sObjectMgr.LoadGameObjectLocales();                     // must be after GameobjectInfo loading
-    sObjectMgr.LoadItemLocales();                           // must be after ItemPrototypes loading
-    sObjectMgr.LoadQuestLocales();                          // must be after QuestTemplates loading
-    sObjectMgr.LoadGossipTextLocales();                     // must be after LoadGossipText
-    sObjectMgr.LoadPageTextLocales();                       // must be after PageText loading
-    sObjectMgr.LoadGossipMenuItemsLocales();                // must be after gossip menu items loading
-    sObjectMgr.LoadPointOfInterestLocales();                // must be after POI loading
-    sObjectMgr.LoadQuestgiverGreetingLocales();
-    sObjectMgr.LoadTrainerGreetingLocales();                // must be after CreatureInfo loading
-    sLog.outString(">>> Localization strings loaded");
-    sLog.outString();
+    loader.AddTask("Loading Localization strings", []()
+    {
+        sObjectMgr.LoadCreatureLocales();                   // must be after CreatureInfo loading
+        sObjectMgr.LoadGameObjectLocales();                 // must be after GameobjectInfo loading
+        sObjectMgr.LoadItemLocales();                       // must be after ItemPrototypes loading
+        sObjectMgr.LoadQuestLocales();                      // must be after QuestTemplates loading
+        sObjectMgr.LoadGossipTextLocales();                 // must be after LoadGossipText
+        sObjectMgr.LoadPageTextLocales();                   // must be after PageText loading
+        sObjectMgr.LoadGossipMenuItemsLocales();            // must be after gossip menu items loading
+        sObjectMgr.LoadPointOfInterestLocales();            // must be after POI loading
+        sObjectMgr.LoadQuestgiverGreetingLocales();
+        sObjectMgr.LoadTrainerGreetingLocales();            // must be after CreatureInfo loading
+    }, { quests, gossipMenus, questgiverGreetings, trainerGreetings });
 
     ///- Load dynamic data tables from the database
-    sLog.outString("Loading Auctions...");
-    sAuctionMgr.LoadAuctionItems();
-    sAuctionMgr.LoadAuctions();
-    sLog.outString(">>> Auctions loaded");
-    sLog.outString();
-
-    sLog.outString("Loading Guilds...");
-    sGuildMgr.LoadGuilds();
-
-    sLog.outString("Loading Groups...");
-    sObjectMgr.LoadGroups();
-
-    sLog.outString("Returning old mails...");
-    sObjectMgr.ReturnOrDeleteOldMails(false);
+    loader.AddTask("Loading Auctions", []()
+    {
+        sAuctionMgr.LoadAuctionItems();
+        sAuctionMgr.LoadAuctions();
+    }, { items, highestGuids });
 
-    sLog.outString("Loading GM tickets...");
-    sTicketMgr.LoadGMTickets();
+    loader.AddTask("Loading Guilds", []() { sGuildMgr.LoadGuilds(); }, { highestGuids });
+    loader.AddTask("Loading Groups", []() { sObjectMgr.LoadGroups(); }, { gameObjectRespawns });
+    loader.AddTask("Returning old mails", []() { sObjectMgr.ReturnOrDeleteOldMails(false); }, { items, highestGuids });
+    loader.AddTask("Loading GM tickets", []() { sTicketMgr.LoadGMTickets(); });
 
     ///- Load and initialize EventAI Scripts
-    sLog.outString("Loading CreatureEventAI Texts...");
-    sEventAIMgr.LoadCreatureEventAI_Texts(false);           // false, will checked in LoadCreatureEventAI_Scripts
+    // texts are stored with the db script strings in the shared mangos string map
+    uint32 eventAITexts = loader.AddTask("Loading CreatureEventAI Texts", []() { sEventAIMgr.LoadCreatureEventAI_Texts(false); }, { scriptStrings });
+    uint32 eventAISummons = loader.AddTask("Loading CreatureEventAI Summons", []() { sEventAIMgr.LoadCreatureEventAI_Summons(false); }, { dbc });
+    loader.AddTask("Loading CreatureEventAI Scripts", []() { sEventAIMgr.LoadCreatureEventAI_Scripts(); }, { eventAITexts, eventAISummons, quests, conditions });
 
-    sLog.outString("Loading CreatureEventAI Summons...");
-    sEventAIMgr.LoadCreatureEventAI_Summons(false);         // false, will checked in LoadCreatureEventAI_Scripts
-
-    sLog.outString("Loading CreatureEventAI Scripts...");
-    sEventAIMgr.LoadCreatureEventAI_Scripts();
+    loader.Run(getConfig(CONFIG_UINT32_NUM_LOAD_THREADS));
+    sLog.outString();
 
     ///- Load and initialize scripting library
     sLog.outString("Initializing Scripting Library...");
@@ -1350,6 +1219,8 @@ void World::SetInitialWorldSettings()
     sLog.outString("---------------------------------------");
     sLog.outString();
 
+    loader.ReportTimes();
+
     uint32 uStartInterval = WorldTimer::getMSTimeDiff(uStartTime, WorldTimer::getMSTime());
     sLog.outString("SERVER STARTUP TIME: %i minutes %i seconds", uStartInterval / 60000, (uStartInterval % 60000) / 1000);
     sLog.outString();
@@ -1622,13 +1493,14 @@ void World::SendWorldTextToAboveSecurity(uint32 securityLevel, int32 string_id,
 /// Sends a packet to all players with optional team and instance restrictions
 void World::SendGlobalMessage(WorldPacket const& packet) const
 {
+    SharedPacketContents contents;
     for (const auto& m_session : m_sessions)
     {
         if (WorldSession* session = m_session.second)
         {
             Player* player = session->GetPlayer();
             if (player && player->IsInWorld())
-                session->SendPacket(packet);
+                session->SendPacket(packet, contents);
         }
     }
 }
@@ -87,6 +87,12 @@ enum eConfigUInt32Values
     CONFIG_UINT32_INTERVAL_SAVE,
     CONFIG_UINT32_INTERVAL_GRIDCLEAN,
     CONFIG_UINT32_INTERVAL_MAPUPDATE,
+    CONFIG_UINT32_NUM_MAP_THREADS,
+    CONFIG_UINT32_NUM_MAP_REGION_THREADS,
+    CONFIG_UINT32_NUM_GRID_PRELOAD_THREADS,
+    CONFIG_UINT32_GRID_PRELOAD_LOOKAHEAD,
+    CONFIG_UINT32_NUM_PATHFINDING_THREADS,
+    CONFIG_UINT32_NUM_LOAD_THREADS,
     CONFIG_UINT32_INTERVAL_CHANGEWEATHER,
     CONFIG_UINT32_PORT_WORLD,
     CONFIG_UINT32_GAME_TYPE,
@@ -354,6 +360,7 @@ enum eConfigBoolValues
     CONFIG_BOOL_PLAYER_COMMANDS,
     CONFIG_BOOL_PATH_FIND_OPTIMIZE,
     CONFIG_BOOL_PATH_FIND_NORMALIZE_Z,
+    CONFIG_BOOL_COMPRESSION_OFFLOAD,
     CONFIG_BOOL_VALUE_COUNT,
 	CONFIG_BOOL_CAN_RES_PLAYERS,
 	CONFIG_BOOL_GOLD_ACCOUNT_WIDE,
@@ -680,6 +687,7 @@ class World
         bool m_allowMovement;
         std::string m_motd;
         std::string m_dataPath;
+        std::string m_dbcImagePath;
 
         // for max speed access
         static float m_MaxVisibleDistanceOnContinents;
@@ -0,0 +1,178 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "World/WorldLoader.h"
+#include "Database/DatabaseEnv.h"
+#include "ProgressBar.h"
+#include "Timer.h"
+#include "Log.h"
+#include "Errors.h"
+
+#include <algorithm>
+#include <thread>
+
+// number of slowest tasks listed at normal log level, the full list is written at detail level
+#define WORLD_LOADER_REPORTED_TASKS 10
+
+uint32 WorldLoader::AddTask(char const* name, LoadFunc const& func, std::vector<uint32> const& dependsOn)
+{
+    uint32 id = uint32(m_tasks.size());
+
+    Task task;
+    task.name = name;
+    task.func = func;
+    task.dependsOn = dependsOn;
+    task.waitingFor = uint32(dependsOn.size());
+    task.duration = 0;
+
+    for (uint32 dep : dependsOn)
+    {
+        MANGOS_ASSERT(dep < id);                            // also rules out cycles
+        m_tasks[dep].dependents.push_back(id);
+    }
+
+    m_tasks.push_back(task);
+    return id;
+}
+
+void WorldLoader::Execute(uint32 id)
+{
+    Task& task = m_tasks[id];
+
+    sLog.outString("%s...", task.name.c_str());
+
+    uint32 startTime = WorldTimer::getMSTime();
+    task.func();
+    task.duration = WorldTimer::getMSTimeDiff(startTime, WorldTimer::getMSTime());
+}
+
+void WorldLoader::Run(uint32 threads)
+{
+    uint32 startTime = WorldTimer::getMSTime();
+
+    if (threads <= 1)
+    {
+        for (uint32 id = 0; id < m_tasks.size(); ++id)
+            Execute(id);
+    }
+    else
+    {
+        // progress bars of concurrent tasks would overwrite each other
+        bool showProgress = BarGoLink::GetOutputState();
+        BarGoLink::SetOutputState(false);
+
+        m_done = 0;
+        for (uint32 id = 0; id < m_tasks.size(); ++id)
+            if (!m_tasks[id].waitingFor)
+                m_ready.insert(id);
+
+        std::vector<std::thread> workerThreads;
+        workerThreads.reserve(threads);
+        for (uint32 i = 0; i < threads; ++i)
+            workerThreads.push_back(std::thread(&WorldLoader::WorkerThread, this));
+
+        for (auto& thread : workerThreads)
+            thread.join();
+
+        BarGoLink::SetOutputState(showProgress);
+    }
+
+    m_wallTime = WorldTimer::getMSTimeDiff(startTime, WorldTimer::getMSTime());
+}
+
+void WorldLoader::WorkerThread()
+{
+    WorldDatabase.ThreadStart();                            // let thread do safe mySQL requests (one connection call enough)
+
+    std::unique_lock<std::mutex> guard(m_lock);
+    while (true)
+    {
+        m_condition.wait(guard, [this] { return m_done == m_tasks.size() || !m_ready.empty(); });
+
+        if (m_ready.empty())                                // all tasks done
+            break;
+
+        uint32 id = *m_ready.begin();
+        m_ready.erase(m_ready.begin());
+
+        guard.unlock();
+        Execute(id);
+        guard.lock();
+
+        ++m_done;
+        for (uint32 dependent : m_tasks[id].dependents)
+            if (--m_tasks[dependent].waitingFor == 0)
+                m_ready.insert(dependent);
+
+        m_condition.notify_all();
+    }
+
+    WorldDatabase.ThreadEnd();                              // free mySQL thread resources
+}
+
+void WorldLoader::ReportTimes() const
+{
+    if (m_tasks.empty())
+        return;
+
+    // longest chain of dependent tasks ending at each task, in declaration (topological) order
+    std::vector<uint32> pathTime(m_tasks.size(), 0);
+    std::vector<int32> pathPrev(m_tasks.size(), -1);
+    uint32 last = 0;
+    uint32 totalTime = 0;
+
+    for (uint32 id = 0; id < m_tasks.size(); ++id)
+    {
+        Task const& task = m_tasks[id];
+        for (uint32 dep : task.dependsOn)
+        {
+            if (pathPrev[id] < 0 || pathTime[dep] > pathTime[pathPrev[id]])
+                pathPrev[id] = int32(dep);
+        }
+
+        pathTime[id] = task.duration + (pathPrev[id] < 0 ? 0 : pathTime[pathPrev[id]]);
+        if (pathTime[id] > pathTime[last])
+            last = id;
+
+        totalTime += task.duration;
+    }
+
+    std::vector<uint32> byDuration(m_tasks.size());
+    for (uint32 id = 0; id < m_tasks.size(); ++id)
+        byDuration[id] = id;
+    std::stable_sort(byDuration.begin(), byDuration.end(), [this](uint32 a, uint32 b) { return m_tasks[a].duration > m_tasks[b].duration; });
+
+    sLog.outString("World load steps: %u in %u ms (%u ms summed over all steps)", uint32(m_tasks.size()), m_wallTime, totalTime);
+    for (uint32 i = 0; i < byDuration.size(); ++i)
+    {
+        Task const& task = m_tasks[byDuration[i]];
+        if (i < WORLD_LOADER_REPORTED_TASKS)
+            sLog.outString("  %7u ms  %s", task.duration, task.name.c_str());
+        else
+            sLog.outDetail("  %7u ms  %s", task.duration, task.name.c_str());
+    }
+
+    std::vector<uint32> path;
+    for (int32 id = int32(last); id >= 0; id = pathPrev[id])
+        path.push_back(uint32(id));
+
+    sLog.outString("World load critical path: %u ms", pathTime[last]);
+    for (auto itr = path.rbegin(); itr != path.rend(); ++itr)
+        sLog.outString("  %7u ms  %s", m_tasks[*itr].duration, m_tasks[*itr].name.c_str());
+    sLog.outString();
+}
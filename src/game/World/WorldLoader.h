@@ -0,0 +1,79 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _WORLD_LOADER_H_INCLUDED
+#define _WORLD_LOADER_H_INCLUDED
+
+#include "Platform/Define.h"
+
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <set>
+#include <string>
+#include <vector>
+
+/**
+ * Startup load steps declared as tasks with explicit dependencies.
+ *
+ * Tasks can only depend on tasks added before them, so the declaration order is always
+ * a valid serial order. With more than one thread every task whose dependencies are done
+ * is started on a worker thread, lowest id first. The wall time of each task is kept for
+ * the report printed at the end of the startup, together with the critical path.
+ */
+class WorldLoader
+{
+    public:
+        typedef std::function<void()> LoadFunc;
+
+        WorldLoader() : m_done(0), m_wallTime(0) {}
+
+        // name is printed as "<name>..." when the task starts, returns the id used for dependencies
+        uint32 AddTask(char const* name, LoadFunc const& func, std::vector<uint32> const& dependsOn = std::vector<uint32>());
+
+        // runs all tasks, returns once they are done; 0 or 1 thread runs them in declaration order in the caller thread
+        void Run(uint32 threads);
+
+        // per task wall time (slowest first) and the chain of dependent tasks limiting the total time
+        void ReportTimes() const;
+
+    private:
+        struct Task
+        {
+            std::string name;
+            LoadFunc func;
+            std::vector<uint32> dependsOn;
+            std::vector<uint32> dependents;
+            uint32 waitingFor;                              // dependencies not done yet
+            uint32 duration;
+        };
+
+        void Execute(uint32 id);
+        void WorkerThread();
+
+        std::vector<Task> m_tasks;
+
+        std::mutex m_lock;
+        std::condition_variable m_condition;
+        std::set<uint32> m_ready;                           // runnable task ids, lowest id is taken first
+        uint32 m_done;
+
+        uint32 m_wallTime;
+};
+
+#endif //_WORLD_LOADER_H_INCLUDED
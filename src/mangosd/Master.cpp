@@ -134,6 +134,9 @@ int Master::Run()
     WorldDatabase.AllowAsyncTransactions();
     LoginDatabase.AllowAsyncTransactions();
 
+    ///- Hand logging over to the writer thread, if configured
+    sLog.StartAsyncWriter();
+
     ///- Catch termination signals
     _HookSignals();
 
@@ -216,12 +219,13 @@ int Master::Run()
 
     {
         int32 networkThreadWorker = sConfig.GetIntDefault("Network.Threads", 1);
-        if (networkThreadWorker <= 0)
+        if (networkThreadWorker < 0)
         {
-            sLog.outError("Invalid network tread workers setting in mangosd.conf. (%d) should be > 0", networkThreadWorker);
+            sLog.outError("Invalid network tread workers setting in mangosd.conf. (%d) should be >= 0", networkThreadWorker);
             networkThreadWorker = 1;
         }
         MaNGOS::Listener<WorldSocket> listener(sConfig.GetStringDefault("BindIP", "0.0.0.0"), int32(sWorld.getConfig(CONFIG_UINT32_PORT_WORLD)), networkThreadWorker);
+        sLog.outString("Using %u network threads for world sockets", uint32(listener.GetWorkerCount()));
 
         std::unique_ptr<MaNGOS::Listener<RASocket>> raListener;
         if (sConfig.GetBoolDefault("Ra.Enable", false))
@@ -234,6 +238,13 @@ int Master::Run()
         // wait for shut down and then let things go out of scope to close them down
         while (!World::IsStopped())
             std::this_thread::sleep_for(std::chrono::seconds(1));
+
+        for (size_t i = 0; i < listener.GetWorkerCount(); ++i)
+        {
+            MaNGOS::NetworkThreadStats stats = listener.GetWorkerStats(i);
+            sLog.outString("Network thread %u: %u sockets (peak %u), " UI64FMTD " accepted, " UI64FMTD " closed",
+                           uint32(i), uint32(stats.sockets), uint32(stats.peakSockets), stats.accepted, stats.closed);
+        }
     }
 
     ///- Stop freeze protection before shutdown tasks
@@ -264,6 +275,8 @@ int Master::Run()
     WorldDatabase.HaltDelayThread();
     LoginDatabase.HaltDelayThread();
 
+    sLog.StopAsyncWriter();
+
     sLog.outString("Halting process...");
 
     if (cliThread)
@@ -352,6 +365,7 @@ bool Master::_StartDB()
 
     dbstring = sConfig.GetStringDefault("CharacterDatabaseInfo");
     nConnections = sConfig.GetIntDefault("CharacterDatabaseConnections", 1);
+    int nAsyncConnections = sConfig.GetIntDefault("CharacterDatabaseAsyncConnections", 1);
     if (dbstring.empty())
     {
         sLog.outError("Character Database not specified in configuration file");
@@ -360,10 +374,10 @@ bool Master::_StartDB()
         WorldDatabase.HaltDelayThread();
         return false;
     }
-    sLog.outString("Character Database total connections: %i", nConnections + 1);
+    sLog.outString("Character Database total connections: %i", nConnections + nAsyncConnections);
 
     ///- Initialise the Character database
-    if (!CharacterDatabase.Initialize(dbstring.c_str(), nConnections))
+    if (!CharacterDatabase.Initialize(dbstring.c_str(), nConnections, nAsyncConnections))
     {
         sLog.outError("Cannot connect to Character database %s", dbstring.c_str());
 
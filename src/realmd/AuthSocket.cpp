@@ -913,10 +913,12 @@ void AuthSocket::LoadRealmlist(ByteBuffer& pkt, uint32 acctid)
         case 6005:                                          // 1.12.2
         case 6141:                                          // 1.12.3
         {
+            RealmList::RealmMapPtr realms = sRealmList.GetRealms();
+
             pkt << uint32(0);                               // unused value
-            pkt << uint8(sRealmList.size());
+            pkt << uint8(realms->size());
 
-            for (const auto& i : sRealmList)
+            for (const auto& i : *realms)
             {
                 uint8 AmountOfCharacters;
 
@@ -974,10 +976,12 @@ void AuthSocket::LoadRealmlist(ByteBuffer& pkt, uint32 acctid)
         case 12340:                                         // 3.3.5a
         default:                                            // and later
         {
+            RealmList::RealmMapPtr realms = sRealmList.GetRealms();
+
             pkt << uint32(0);                               // unused value
-            pkt << uint16(sRealmList.size());
+            pkt << uint16(realms->size());
 
-            for (const auto& i : sRealmList)
+            for (const auto& i : *realms)
             {
                 uint8 AmountOfCharacters;
 
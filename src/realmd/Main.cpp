@@ -222,8 +222,14 @@ int main(int argc, char* argv[])
     LoginDatabase.Execute("DELETE FROM ip_banned WHERE unbandate<=UNIX_TIMESTAMP() AND unbandate<>bandate");
     LoginDatabase.CommitTransaction();
 
-    // FIXME - more intelligent selection of thread count is needed here.  config option?
-    MaNGOS::Listener<AuthSocket> listener(sConfig.GetStringDefault("BindIP", "0.0.0.0"), sConfig.GetIntDefault("RealmServerPort", DEFAULT_REALMSERVER_PORT), 1);
+    int32 networkThreadWorker = sConfig.GetIntDefault("Network.Threads", 1);
+    if (networkThreadWorker < 0)
+    {
+        sLog.outError("Invalid network tread workers setting in realmd.conf. (%d) should be >= 0", networkThreadWorker);
+        networkThreadWorker = 1;
+    }
+    MaNGOS::Listener<AuthSocket> listener(sConfig.GetStringDefault("BindIP", "0.0.0.0"), sConfig.GetIntDefault("RealmServerPort", DEFAULT_REALMSERVER_PORT), networkThreadWorker);
+    sLog.outString("Using %u network threads for auth sockets", uint32(listener.GetWorkerCount()));
 
     ///- Catch termination signals
     HookSignals();
@@ -297,6 +303,13 @@ int main(int argc, char* argv[])
 #endif
     }
 
+    for (size_t i = 0; i < listener.GetWorkerCount(); ++i)
+    {
+        MaNGOS::NetworkThreadStats stats = listener.GetWorkerStats(i);
+        sLog.outString("Network thread %u: %u sockets (peak %u), " UI64FMTD " accepted, " UI64FMTD " closed",
+                       uint32(i), uint32(stats.sockets), uint32(stats.peakSockets), stats.accepted, stats.closed);
+    }
+
     ///- Wait for the delay thread to exit
     LoginDatabase.HaltDelayThread();
 
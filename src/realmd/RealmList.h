@@ -25,6 +25,8 @@
 
 #include "Common.h"
 #include <array>
+#include <memory>
+#include <mutex>
 
 struct RealmBuildInfo
 {
@@ -60,6 +62,7 @@ class RealmList
 {
     public:
         typedef std::map<std::string, Realm> RealmMap;
+        typedef std::shared_ptr<RealmMap const> RealmMapPtr;
 
         static RealmList& Instance();
 
@@ -70,14 +73,16 @@ class RealmList
 
         void UpdateIfNeed();
 
-        RealmMap::const_iterator begin() const { return m_realms.begin(); }
-        RealmMap::const_iterator end() const { return m_realms.end(); }
-        uint32 size() const { return m_realms.size(); }
+        // the list is replaced as a whole at update, so a snapshot stays valid while network threads iterate it
+        RealmMapPtr GetRealms() const;
+        uint32 size() const { return GetRealms()->size(); }
     private:
         void UpdateRealms(bool init);
-        void UpdateRealm(uint32 ID, const std::string& name, const std::string& address, uint32 port, uint8 icon, RealmFlags realmflags, uint8 timezone, AccountTypes allowedSecurityLevel, float popu, const std::string& builds);
+        void UpdateRealm(RealmMap& realms, uint32 ID, const std::string& name, const std::string& address, uint32 port, uint8 icon, RealmFlags realmflags, uint8 timezone, AccountTypes allowedSecurityLevel, float popu, const std::string& builds);
     private:
-        RealmMap m_realms;                                  ///< Internal map of realms
+        RealmMapPtr m_realms;                               ///< Internal map of realms
+        mutable std::mutex m_realmsLock;                    ///< Guards m_realms pointer swap
+        std::mutex m_updateLock;                            ///< Only one network thread reloads the list
         uint32   m_UpdateInterval;
         time_t   m_NextUpdateTime;
 };
@@ -19,9 +19,27 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unordered_map>
 
 #include "DBCFileLoader.h"
 
+#if PLATFORM == PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#define DBC_IMAGE_MAGIC         0x49434244                  // 'DBCI'
+#define DBC_IMAGE_VERSION       1
+#define DBC_IMAGE_PAGE_SIZE     4096
+#define DBC_IMAGE_BASE_START    uint64(0x600000000000)      // 64 bit: user space region reserved for images
+#define DBC_IMAGE_BASE_SLOTS    4096
+#define DBC_IMAGE_BASE_SLOT     uint64(64 * 1024 * 1024)
+
 DBCFileLoader::DBCFileLoader()
 {
     data = nullptr;
@@ -313,3 +331,289 @@ char* DBCFileLoader::AutoProduceStrings(const char* format, char* dataTable)
 
     return stringPool;
 }
+
+static uint64 AlignImageOffset(uint64 offset, uint64 alignment)
+{
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+static uint64 HashImageBytes(uint64 hash, void const* bytes, size_t size)
+{
+    // FNV-1a
+    unsigned char const* itr = static_cast<unsigned char const*>(bytes);
+    for (size_t i = 0; i < size; ++i)
+        hash = (hash ^ itr[i]) * uint64(0x100000001B3);
+    return hash;
+}
+
+// record offsets of the string fields, in the layout built by AutoProduceData
+static std::vector<uint32> GetImageStringFields(char const* format)
+{
+    std::vector<uint32> fields;
+    uint32 offset = 0;
+    for (uint32 x = 0; format[x]; ++x)
+    {
+        switch (format[x])
+        {
+            case FT_FLOAT:
+            case FT_IND:
+            case FT_INT:
+                offset += sizeof(uint32);
+                break;
+            case FT_BYTE:
+                offset += sizeof(uint8);
+                break;
+            case FT_STRING:
+                fields.push_back(offset);
+                offset += sizeof(char*);
+                break;
+            default:
+                break;
+        }
+    }
+    return fields;
+}
+
+uint64 DBCImageFile::GetFileStamp(char const* filename)
+{
+    struct stat st;
+    if (stat(filename, &st) != 0)
+        return 0;
+
+    uint64 size = uint64(st.st_size);
+    uint64 mtime = uint64(st.st_mtime);
+    uint64 hash = HashImageBytes(uint64(0xCBF29CE484222325), &size, sizeof(size));
+    return HashImageBytes(hash, &mtime, sizeof(mtime));
+}
+
+uint32 DBCImageFile::GetFormatHash(char const* format, uint32 recordSize)
+{
+    uint32 pointerSize = sizeof(char*);
+    uint64 hash = HashImageBytes(uint64(0xCBF29CE484222325), format, strlen(format));
+    hash = HashImageBytes(hash, &recordSize, sizeof(recordSize));
+    hash = HashImageBytes(hash, &pointerSize, sizeof(pointerSize));
+    return uint32(hash ^ (hash >> 32));
+}
+
+uint64 DBCImageFile::GetPreferredBase(char const* filename)
+{
+    if (sizeof(char*) < 8)
+        return 0;                                           // no room for a fixed region, images are always relocated
+
+    // every image gets its own slot, so several images can be mapped at their base at once
+    char const* name = filename;
+    for (char const* itr = filename; *itr; ++itr)
+        if (*itr == '/' || *itr == '\\')
+            name = itr + 1;
+
+    uint64 slot = HashImageBytes(uint64(0xCBF29CE484222325), name, strlen(name)) % DBC_IMAGE_BASE_SLOTS;
+    return DBC_IMAGE_BASE_START + slot * DBC_IMAGE_BASE_SLOT;
+}
+
+void DBCImageFile::RelocateStrings(char const* format, char* data, uint32 recordCount, uint32 recordSize, int64 delta)
+{
+    std::vector<uint32> fields = GetImageStringFields(format);
+    for (uint32 y = 0; y < recordCount; ++y)
+    {
+        char* record = data + size_t(y) * recordSize;
+        for (uint32 field : fields)
+        {
+            char** slot = reinterpret_cast<char**>(record + field);
+            if (*slot)
+                *slot += delta;
+        }
+    }
+}
+
+bool DBCImageFile::Write(char const* filename, char const* format, uint32 recordSize, uint64 sourceStamp, uint32 fieldCount,
+                         char const* data, uint32 recordCount, std::vector<uint32> const& index)
+{
+    DBCImageHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = DBC_IMAGE_MAGIC;
+    header.version = DBC_IMAGE_VERSION;
+    header.sourceStamp = sourceStamp;
+    header.formatHash = GetFormatHash(format, recordSize);
+    header.fieldCount = fieldCount;
+    header.recordCount = recordCount;
+    header.indexCount = uint32(index.size());
+    header.baseAddress = GetPreferredBase(filename);
+    header.indexOffset = AlignImageOffset(sizeof(header), 8);
+    header.dataOffset = AlignImageOffset(header.indexOffset + index.size() * sizeof(uint32), DBC_IMAGE_PAGE_SIZE);
+    header.stringOffset = AlignImageOffset(header.dataOffset + uint64(recordCount) * recordSize, 8);
+
+    // copy of the records with string pointers linked into the image string table, equal strings are stored once
+    std::vector<char> records(data, data + size_t(recordCount) * recordSize);
+    std::vector<char> strings;
+    std::unordered_map<std::string, uint64> stringOffsets;
+    std::vector<uint32> fields = GetImageStringFields(format);
+
+    for (uint32 y = 0; y < recordCount; ++y)
+    {
+        for (uint32 field : fields)
+        {
+            char** slot = reinterpret_cast<char**>(&records[size_t(y) * recordSize + field]);
+            if (!*slot)
+                continue;
+
+            auto itr = stringOffsets.find(*slot);
+            if (itr == stringOffsets.end())
+            {
+                itr = stringOffsets.insert(std::make_pair(std::string(*slot), uint64(strings.size()))).first;
+                strings.insert(strings.end(), *slot, *slot + strlen(*slot) + 1);
+            }
+
+            *slot = reinterpret_cast<char*>(header.baseAddress + header.stringOffset + itr->second);
+        }
+    }
+
+    header.fileSize = header.stringOffset + strings.size();
+
+    std::string tmpname = std::string(filename) + ".tmp";
+    FILE* f = fopen(tmpname.c_str(), "wb");
+    if (!f)
+        return false;
+
+    // sections are written at their offsets, the gaps in between are zero padding
+    uint64 written = 0;
+    auto writeAt = [f, &written](uint64 offset, void const* bytes, size_t size)
+    {
+        static char const padding[DBC_IMAGE_PAGE_SIZE] = {};
+        if (offset > written && fwrite(padding, size_t(offset - written), 1, f) != 1)
+            return false;
+        written = offset + size;
+        return !size || fwrite(bytes, size, 1, f) == 1;
+    };
+
+    bool ok = writeAt(0, &header, sizeof(header)) &&
+              writeAt(header.indexOffset, index.data(), index.size() * sizeof(uint32)) &&
+              writeAt(header.dataOffset, records.data(), records.size()) &&
+              writeAt(header.stringOffset, strings.data(), strings.size());
+    ok = fclose(f) == 0 && ok;
+
+    // replace the image only once complete, processes mapping the old one keep it
+    if (ok)
+    {
+        remove(filename);
+        ok = rename(tmpname.c_str(), filename) == 0;
+    }
+
+    if (!ok)
+        remove(tmpname.c_str());
+
+    return ok;
+}
+
+bool DBCImageFile::Map(char const* filename, char const* format, uint32 recordSize, uint64 sourceStamp)
+{
+    Unmap();
+
+    DBCImageHeader header;
+    FILE* f = fopen(filename, "rb");
+    if (!f)
+        return false;
+
+    bool valid = fread(&header, sizeof(header), 1, f) == 1;
+    fseek(f, 0, SEEK_END);
+    long fileSize = ftell(f);
+    fclose(f);
+
+    if (!valid || header.magic != DBC_IMAGE_MAGIC || header.version != DBC_IMAGE_VERSION ||
+            header.sourceStamp != sourceStamp || header.formatHash != GetFormatHash(format, recordSize) ||
+            fileSize < 0 || header.fileSize != uint64(fileSize))
+        return false;
+
+    // sections have to follow each other inside the file, a truncated or edited header is not trusted
+    if (header.indexOffset < sizeof(header) || header.indexOffset > header.dataOffset ||
+            header.dataOffset > header.stringOffset || header.stringOffset > header.fileSize ||
+            uint64(header.indexCount) * sizeof(uint32) > header.dataOffset - header.indexOffset ||
+            uint64(header.recordCount) * recordSize > header.stringOffset - header.dataOffset)
+        return false;
+
+    m_size = size_t(header.fileSize);
+    void* preferred = reinterpret_cast<void*>(header.baseAddress);
+
+#if PLATFORM == PLATFORM_WINDOWS
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping)
+        return false;
+
+    void* base = MapViewOfFileEx(mapping, FILE_MAP_COPY, 0, 0, m_size, preferred);
+    if (!base)                                              // preferred range in use
+        base = MapViewOfFileEx(mapping, FILE_MAP_COPY, 0, 0, m_size, nullptr);
+    CloseHandle(mapping);
+    if (!base)
+        return false;
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    // private writable mapping: pages are shared until a record is changed in memory
+    void* base = mmap(preferred, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+        return false;
+#endif
+
+    m_base = static_cast<char*>(base);
+    m_header = header;
+
+    if (!CheckLinks(format, recordSize))
+    {
+        Unmap();
+        return false;
+    }
+
+    if (uint64(reinterpret_cast<size_t>(m_base)) != header.baseAddress)
+        RelocateStrings(format, GetData(), header.recordCount, recordSize, int64(reinterpret_cast<size_t>(m_base)) - int64(header.baseAddress));
+
+    return true;
+}
+
+bool DBCImageFile::CheckLinks(char const* format, uint32 recordSize) const
+{
+    // index entries have to name a record
+    uint32 const* index = GetIndex();
+    for (uint32 i = 0; i < m_header.indexCount; ++i)
+        if (index[i] != DBC_IMAGE_NO_RECORD && index[i] >= m_header.recordCount)
+            return false;
+
+    // string pointers (still linked for the base address) have to point into the string table, which ends with a terminator
+    if (m_header.stringOffset < m_header.fileSize && m_base[m_header.fileSize - 1] != '\0')
+        return false;
+
+    std::vector<uint32> fields = GetImageStringFields(format);
+    char const* data = GetData();
+    for (uint32 y = 0; y < m_header.recordCount; ++y)
+    {
+        for (uint32 field : fields)
+        {
+            uint64 link = uint64(reinterpret_cast<size_t>(*reinterpret_cast<char* const*>(data + size_t(y) * recordSize + field)));
+            if (link && (link < m_header.baseAddress + m_header.stringOffset || link >= m_header.baseAddress + m_header.fileSize))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+void DBCImageFile::Unmap()
+{
+    if (!m_base)
+        return;
+
+#if PLATFORM == PLATFORM_WINDOWS
+    UnmapViewOfFile(m_base);
+#else
+    munmap(m_base, m_size);
+#endif
+
+    m_base = nullptr;
+    m_size = 0;
+}
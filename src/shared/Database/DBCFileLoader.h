@@ -21,6 +21,8 @@
 #include "Platform/Define.h"
 #include "Utilities/ByteConverter.h"
 #include <cassert>
+#include <string>
+#include <vector>
 
 enum FieldFormat
 {
@@ -106,4 +108,67 @@ class DBCFileLoader
         unsigned char* data;
         unsigned char* stringTable;
 };
+
+/// Header of a DBC store image, a DBCStorage table converted to its in-memory layout
+struct DBCImageHeader
+{
+    uint32 magic;                                           // 'DBCI'
+    uint32 version;
+    uint64 sourceStamp;                                     // size and modify time of the source dbc files
+    uint32 formatHash;                                      // format string, record size and pointer size
+    uint32 fieldCount;
+    uint32 recordCount;                                     // records in the data table
+    uint32 indexCount;                                      // entries in the index table (max id + 1)
+    uint64 baseAddress;                                     // address the string pointers are linked for
+    uint64 indexOffset;                                     // uint32 record number per id, DBC_IMAGE_NO_RECORD for none
+    uint64 dataOffset;                                      // page aligned records
+    uint64 stringOffset;
+    uint64 fileSize;
+};
+
+#define DBC_IMAGE_NO_RECORD 0xFFFFFFFF
+
+/**
+ * Copy-on-write mapping of a DBC store image.
+ *
+ * The image is mapped at its preferred base address when that range is free, so the
+ * string pointers stored in the records are valid as they are and the pages stay
+ * shared with every other process mapping the same image. Otherwise the string
+ * pointers are relocated, which only makes the pages holding them private.
+ */
+class DBCImageFile
+{
+    public:
+        DBCImageFile() : m_base(nullptr), m_size(0) {}
+        ~DBCImageFile() { Unmap(); }
+
+        bool Map(char const* filename, char const* format, uint32 recordSize, uint64 sourceStamp);
+        void Unmap();
+        bool IsMapped() const { return m_base != nullptr; }
+
+        char* GetData() const { return m_base + m_header.dataOffset; }
+        uint32 const* GetIndex() const { return reinterpret_cast<uint32 const*>(m_base + m_header.indexOffset); }
+        DBCImageHeader const& GetHeader() const { return m_header; }
+
+        // writes the image of a loaded table, string pointers of data are linked for the preferred base address of filename
+        static bool Write(char const* filename, char const* format, uint32 recordSize, uint64 sourceStamp, uint32 fieldCount,
+                          char const* data, uint32 recordCount, std::vector<uint32> const& index);
+
+        // size and modify time of a file, 0 if it does not exist
+        static uint64 GetFileStamp(char const* filename);
+
+    private:
+        static uint32 GetFormatHash(char const* format, uint32 recordSize);
+        static uint64 GetPreferredBase(char const* filename);
+        static void RelocateStrings(char const* format, char* data, uint32 recordCount, uint32 recordSize, int64 delta);
+        // index entries and string pointers of the mapped image stay inside of it
+        bool CheckLinks(char const* format, uint32 recordSize) const;
+
+        char* m_base;
+        size_t m_size;
+        DBCImageHeader m_header;
+
+        DBCImageFile(DBCImageFile const&);
+        DBCImageFile& operator=(DBCImageFile const&);
+};
 #endif
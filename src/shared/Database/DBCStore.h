@@ -26,7 +26,7 @@ class DBCStorage
 {
         typedef std::list<char*> StringPoolList;
     public:
-        explicit DBCStorage(const char* f) : nCount(0), fieldCount(0), fmt(f), indexTable(nullptr), m_dataTable(nullptr) { }
+        explicit DBCStorage(const char* f) : nCount(0), fieldCount(0), fmt(f), indexTable(nullptr), m_dataTable(nullptr), m_recordCount(0) { }
         ~DBCStorage() { Clear(); }
 
         T const* LookupEntry(uint32 id) const { return (id >= nCount) ? nullptr : indexTable[id]; }
@@ -42,6 +42,7 @@ class DBCStorage
                 return false;
 
             fieldCount = dbc.GetCols();
+            m_recordCount = dbc.GetNumRows();
 
             // load raw non-string data
             m_dataTable = (T*)dbc.AutoProduceData(fmt, nCount, (char**&)indexTable);
@@ -70,6 +71,44 @@ class DBCStorage
             return true;
         }
 
+        // maps the records from an image written by SaveImage, only the index table is built in memory
+        bool LoadImage(char const* fn, uint64 sourceStamp)
+        {
+            Clear();
+
+            if (!m_image.Map(fn, fmt, sizeof(T), sourceStamp))
+                return false;
+
+            DBCImageHeader const& header = m_image.GetHeader();
+            fieldCount = header.fieldCount;
+            m_recordCount = header.recordCount;
+            m_dataTable = (T*)m_image.GetData();
+
+            nCount = header.indexCount;
+            indexTable = (T**)(new char*[nCount]);
+            uint32 const* recordIndex = m_image.GetIndex();
+            for (uint32 i = 0; i < nCount; ++i)
+                indexTable[i] = recordIndex[i] < m_recordCount ? &m_dataTable[recordIndex[i]] : nullptr;
+
+            return true;
+        }
+
+        // stores the loaded records and strings (all locales) in an image for LoadImage, must be called before entries are changed
+        bool SaveImage(char const* fn, uint64 sourceStamp) const
+        {
+            if (!indexTable || m_image.IsMapped())
+                return false;
+
+            std::vector<uint32> recordIndex(nCount, DBC_IMAGE_NO_RECORD);
+            for (uint32 i = 0; i < nCount; ++i)
+                if (indexTable[i])
+                    recordIndex[i] = uint32(indexTable[i] - m_dataTable);
+
+            return DBCImageFile::Write(fn, fmt, sizeof(T), sourceStamp, fieldCount, (char const*)m_dataTable, m_recordCount, recordIndex);
+        }
+
+        bool IsMapped() const { return m_image.IsMapped(); }
+
         void Clear()
         {
             if (!indexTable)
@@ -77,7 +116,10 @@ class DBCStorage
 
             delete[]((char*)indexTable);
             indexTable = nullptr;
-            delete[]((char*)m_dataTable);
+            if (m_image.IsMapped())
+                m_image.Unmap();
+            else
+                delete[]((char*)m_dataTable);
             m_dataTable = nullptr;
 
             while (!m_stringPoolList.empty())
@@ -86,6 +128,7 @@ class DBCStorage
                 m_stringPoolList.pop_front();
             }
             nCount = 0;
+            m_recordCount = 0;
         }
 
         void EraseEntry(uint32 id) { assert(id < nCount && "To be erased entry must be in bounds!") ; indexTable[id] = nullptr; }
@@ -97,7 +140,9 @@ class DBCStorage
         char const* fmt;
         T** indexTable;
         T* m_dataTable;
+        uint32 m_recordCount;
         StringPoolList m_stringPoolList;
+        DBCImageFile m_image;
 };
 
 #endif
@@ -20,6 +20,7 @@
 #include "Config/Config.h"
 #include "Database/SqlOperations.h"
 
+#include <algorithm>
 #include <ctime>
 #include <iostream>
 #include <fstream>
@@ -97,7 +98,7 @@ Database::~Database()
     StopServer();
 }
 
-bool Database::Initialize(const char* infoString, int nConns /*= 1*/)
+bool Database::Initialize(const char* infoString, int nConns /*= 1*/, int nAsyncConns /*= 1*/)
 {
     // Enable logging of SQL commands (usually only GM commands)
     // (See method: PExecuteLog)
@@ -134,10 +135,21 @@ bool Database::Initialize(const char* infoString, int nConns /*= 1*/)
         m_pQueryConnections.push_back(pConn);
     }
 
-    // create and initialize connection for async requests
-    m_pAsyncConn = CreateConnection();
-    if (!m_pAsyncConn->Initialize(infoString))
-        return false;
+    // create and initialize connections for async requests
+    nAsyncConns = std::min(std::max(nAsyncConns, MIN_CONNECTION_POOL_SIZE), MAX_CONNECTION_POOL_SIZE);
+    for (int i = 0; i < nAsyncConns; ++i)
+    {
+        SqlConnection* pConn = CreateConnection();
+        if (!pConn->Initialize(infoString))
+        {
+            delete pConn;
+            return false;
+        }
+
+        m_pAsyncConnections.push_back(pConn);
+    }
+
+    m_pAsyncConn = m_pAsyncConnections[0];
 
     m_pResultQueue = new SqlResultQueue;
 
@@ -150,9 +162,11 @@ void Database::StopServer()
     HaltDelayThread();
 
     delete m_pResultQueue;
-    delete m_pAsyncConn;
+    for (auto& asyncConnection : m_pAsyncConnections)
+        delete asyncConnection;
 
     m_pResultQueue = nullptr;
+    m_pAsyncConnections.clear();
     m_pAsyncConn = nullptr;
 
     for (auto& m_pQueryConnection : m_pQueryConnections)
@@ -161,30 +175,112 @@ void Database::StopServer()
     m_pQueryConnections.clear();
 }
 
-SqlDelayThread* Database::CreateDelayThread()
+SqlDelayThread* Database::CreateDelayThread(SqlConnection* conn, bool pingDatabase)
 {
-    assert(m_pAsyncConn);
-    return new SqlDelayThread(this, m_pAsyncConn);
+    assert(conn);
+    return new SqlDelayThread(this, conn, pingDatabase);
 }
 
 void Database::InitDelayThread()
 {
-    assert(!m_delayThread);
+    assert(m_delayThreads.empty());
 
-    // New delay thread for delay execute
-    m_threadBody = CreateDelayThread();              // will deleted at m_delayThread delete
-    m_delayThread = new MaNGOS::Thread(m_threadBody);
+    // New delay thread for delay execute, one per async connection. only the first one pings the connections
+    for (size_t i = 0; i < m_pAsyncConnections.size(); ++i)
+    {
+        SqlDelayThread* threadBody = CreateDelayThread(m_pAsyncConnections[i], i == 0);   // will deleted at its thread delete
+        m_threadBodies.push_back(threadBody);
+        m_delayThreads.push_back(new MaNGOS::Thread(threadBody));
+    }
 }
 
 void Database::HaltDelayThread()
 {
-    if (!m_threadBody || !m_delayThread) return;
+    if (m_threadBodies.empty() || m_delayThreads.empty()) return;
+
+    for (auto threadBody : m_threadBodies)
+        threadBody->Stop();                                 // Stop event
+
+    for (auto delayThread : m_delayThreads)
+    {
+        delayThread->wait();                                // Wait for flush to DB
+        delete delayThread;                                 // This also deletes its thread body
+    }
+
+    m_delayThreads.clear();
+    m_threadBodies.clear();
+}
 
-    m_threadBody->Stop();                                   // Stop event
-    m_delayThread->wait();                                  // Wait for flush to DB
-    delete m_delayThread;                                   // This also deletes m_threadBody
-    m_delayThread = nullptr;
-    m_threadBody = nullptr;
+SqlDelayThread* Database::GetDelayThread() const
+{
+    if (m_threadBodies.empty())
+        return nullptr;
+
+    return m_threadBodies[SqlAsyncRoute::GetKey(*this) % m_threadBodies.size()];
+}
+
+bool Database::Delay(SqlOperation* request)
+{
+    SqlDelayThread* thread = GetDelayThread();
+
+    uint32 joinedKey;
+    if (!SqlAsyncRoute::GetJoinedKey(*this, joinedKey))
+        return thread->Delay(request);
+
+    SqlDelayThread* joinedThread = m_threadBodies[joinedKey % m_threadBodies.size()];
+    if (joinedThread == thread)
+        return thread->Delay(request);
+
+    // joined requests are queued in one order on all connections, else two of them could wait for each other
+    std::shared_ptr<SqlJoin> join = std::make_shared<SqlJoin>();
+    std::lock_guard<std::mutex> guard(m_joinLock);
+    joinedThread->Delay(new SqlJoinBarrier(join));
+    return thread->Delay(new SqlJoinedRequest(request, join));
+}
+
+namespace
+{
+    // active SqlAsyncRoute of the thread
+    thread_local Database const* t_routeDb = nullptr;
+    thread_local uint32 t_routeKey = 0;
+    thread_local bool t_routeJoined = false;
+    thread_local uint32 t_routeJoinedKey = 0;
+}
+
+SqlAsyncRoute::SqlAsyncRoute(Database const& db, uint32 key) : m_prevDb(t_routeDb), m_prevKey(t_routeKey),
+    m_prevJoined(t_routeJoined), m_prevJoinedKey(t_routeJoinedKey)
+{
+    t_routeDb = &db;
+    t_routeKey = key;
+    t_routeJoined = false;
+}
+
+SqlAsyncRoute::SqlAsyncRoute(Database const& db, uint32 key, uint32 joinedKey) : SqlAsyncRoute(db, key)
+{
+    t_routeJoined = true;
+    t_routeJoinedKey = joinedKey;
+}
+
+SqlAsyncRoute::~SqlAsyncRoute()
+{
+    t_routeDb = m_prevDb;
+    t_routeKey = m_prevKey;
+    t_routeJoined = m_prevJoined;
+    t_routeJoinedKey = m_prevJoinedKey;
+}
+
+uint32 SqlAsyncRoute::GetKey(Database const& db)
+{
+    return t_routeDb == &db ? t_routeKey : 0;
+}
+
+bool SqlAsyncRoute::GetJoinedKey(Database const& db, uint32& joinedKey)
+{
+    if (t_routeDb != &db || !t_routeJoined)
+        return false;
+
+    joinedKey = t_routeJoinedKey;
+    return true;
 }
 
 void Database::ThreadStart()
@@ -229,8 +325,9 @@ void Database::Ping()
 {
     const char* sql = "SELECT 1";
 
+    for (auto& asyncConnection : m_pAsyncConnections)
     {
-        SqlConnection::Lock guard(m_pAsyncConn);
+        SqlConnection::Lock guard(asyncConnection);
         delete guard->Query(sql);
     }
 
@@ -302,6 +399,25 @@ QueryResult* Database::PQuery(const char* format, ...)
     return Query(szQuery);
 }
 
+QueryResult* Database::PQueryBinary(const char* format, ...)
+{
+    if (!format) return nullptr;
+
+    va_list ap;
+    char szQuery [MAX_QUERY_LEN];
+    va_start(ap, format);
+    int res = vsnprintf(szQuery, MAX_QUERY_LEN, format, ap);
+    va_end(ap);
+
+    if (res == -1)
+    {
+        sLog.outError("SQL Query truncated (and not execute) for format: %s", format);
+        return nullptr;
+    }
+
+    return QueryBinary(szQuery);
+}
+
 QueryNamedResult* Database::PQueryNamed(const char* format, ...)
 {
     if (!format) return nullptr;
@@ -339,7 +455,7 @@ bool Database::Execute(const char* sql)
             return DirectExecute(sql);
 
         // Simple sql statement
-        m_threadBody->Delay(new SqlPlainRequest(sql));
+        Delay(new SqlPlainRequest(sql));
     }
 
     return true;
@@ -398,6 +514,12 @@ bool Database::BeginTransaction()
     return m_currentTransaction.get() != nullptr;
 }
 
+uint32 Database::GetTransactionSize() const
+{
+    SqlTransaction const* trans = m_currentTransaction.get();
+    return trans ? uint32(trans->Size()) : 0;
+}
+
 bool Database::CommitTransaction()
 {
     if (!m_pAsyncConn || !m_currentTransaction.get())
@@ -408,10 +530,18 @@ bool Database::CommitTransaction()
         return CommitTransactionDirect();
 
     // add SqlTransaction to the async queue
-    m_threadBody->Delay(m_currentTransaction.release());
+    Delay(m_currentTransaction.release());
     return true;
 }
 
+bool Database::CommitTransaction(std::shared_ptr<std::atomic<bool>> const& failed)
+{
+    if (m_currentTransaction.get())
+        m_currentTransaction->SetFailedFlag(failed);
+
+    return CommitTransaction();
+}
+
 bool Database::CommitTransactionDirect()
 {
     if (!m_pAsyncConn)
@@ -563,7 +693,7 @@ bool Database::ExecuteStmt(const SqlStatementID& id, SqlStmtParameters* params)
             return DirectExecuteStmt(id, params);
 
         // Simple sql statement
-        m_threadBody->Delay(new SqlPreparedRequest(id.ID(), params));
+        Delay(new SqlPreparedRequest(id.ID(), params));
     }
 
     return true;
@@ -29,6 +29,7 @@
 #include <atomic>
 
 class SqlTransaction;
+class SqlOperation;
 class SqlResultQueue;
 class SqlQueryHolder;
 class SqlStmtParameters;
@@ -47,6 +48,8 @@ class SqlConnection
         virtual bool Initialize(const char* infoString) = 0;
         // public methods for making queries
         virtual QueryResult* Query(const char* sql) = 0;
+        // fetched through the binary protocol of the DBMS into typed fields where supported
+        virtual QueryResult* QueryBinary(const char* sql) { return Query(sql); }
         virtual QueryNamedResult* QueryNamed(const char* sql) = 0;
 
         // public methods for making requests
@@ -104,10 +107,11 @@ class Database
     public:
         virtual ~Database();
 
-        virtual bool Initialize(const char* infoString, int nConns = 1);
-        // start worker thread for async DB request execution
+        // nAsyncConns connections (each with its own delay thread) execute async requests, see SqlAsyncRoute
+        virtual bool Initialize(const char* infoString, int nConns = 1, int nAsyncConns = 1);
+        // start worker threads for async DB request execution
         virtual void InitDelayThread();
-        // stop worker thread
+        // stop worker threads
         virtual void HaltDelayThread();
 
         /// Synchronous DB queries
@@ -117,6 +121,15 @@ class Database
             return guard->Query(sql);
         }
 
+        /// Synchronous DB query returning typed fields through the binary protocol of the DBMS, falling back to a text query.
+        /// Each call prepares, executes and closes a statement (extra round trips), so it only pays off for large result
+        /// sets of mostly numeric columns, like the tables loaded at startup.
+        inline QueryResult* QueryBinary(const char* sql)
+        {
+            SqlConnection::Lock guard(getQueryConnection());
+            return guard->QueryBinary(sql);
+        }
+
         inline QueryNamedResult* QueryNamed(const char* sql)
         {
             SqlConnection::Lock guard(getQueryConnection());
@@ -124,6 +137,7 @@ class Database
         }
 
         QueryResult* PQuery(const char* format, ...) ATTR_PRINTF(2, 3);
+        QueryResult* PQueryBinary(const char* format, ...) ATTR_PRINTF(2, 3);
         QueryNamedResult* PQueryNamed(const char* format, ...) ATTR_PRINTF(2, 3);
 
         bool DirectExecute(const char* sql) const
@@ -185,9 +199,13 @@ class Database
 
         bool BeginTransaction();
         bool CommitTransaction();
+        // commit, failed is set once the transaction is executed and rolled back
+        bool CommitTransaction(std::shared_ptr<std::atomic<bool>> const& failed);
         bool RollbackTransaction();
         // for sync transaction execution
         bool CommitTransactionDirect();
+        // number of statements queued so far in this thread's open transaction
+        uint32 GetTransactionSize() const;
 
         // PREPARED STATEMENT API
 
@@ -223,7 +241,7 @@ class Database
     protected:
         Database() :
             m_nQueryConnPoolSize(1), m_pAsyncConn(nullptr), m_pResultQueue(nullptr),
-            m_threadBody(nullptr), m_delayThread(nullptr), m_bAllowAsyncTransactions(false),
+            m_bAllowAsyncTransactions(false),
             m_iStmtIndex(-1), m_logSQL(false), m_pingIntervallms(0)
         {
             m_nQueryCounter = -1;
@@ -234,7 +252,7 @@ class Database
         // factory method to create SqlConnection objects
         virtual SqlConnection* CreateConnection() = 0;
         // factory method to create SqlDelayThread objects
-        virtual SqlDelayThread* CreateDelayThread();
+        virtual SqlDelayThread* CreateDelayThread(SqlConnection* conn, bool pingDatabase);
 
         // per-thread based storage for SqlTransaction object initialization - no locking is required
         boost::thread_specific_ptr<SqlTransaction> m_currentTransaction;
@@ -243,8 +261,12 @@ class Database
 
         // round-robin connection selection
         SqlConnection* getQueryConnection();
-        // for now return one single connection for async requests
+        // connection used for direct execution of async requests
         SqlConnection* getAsyncConnection() const { return m_pAsyncConn; }
+        // delay thread for async requests of the current thread, selected by its SqlAsyncRoute key
+        SqlDelayThread* GetDelayThread() const;
+        // queue an async request on the delay thread of the current route, joined with the thread of its joined key if any
+        bool Delay(SqlOperation* request);
 
         friend class SqlStatement;
         // PREPARED STATEMENT API
@@ -260,12 +282,14 @@ class Database
         typedef std::vector< SqlConnection* > SqlConnectionContainer;
         SqlConnectionContainer m_pQueryConnections;
 
-        // only one single DB connection for transactions
+        // connections for transactions and other async requests, first one also used for direct execution
+        SqlConnectionContainer m_pAsyncConnections;
         SqlConnection* m_pAsyncConn;
 
         SqlResultQueue*     m_pResultQueue;                 ///< Transaction queues from diff. threads
-        SqlDelayThread*     m_threadBody;                   ///< Pointer to delay sql executer (owned by m_delayThread)
-        MaNGOS::Thread*     m_delayThread;                  ///< Pointer to executer thread
+        std::vector<SqlDelayThread*> m_threadBodies;        ///< Delay sql executers, one per async connection (owned by m_delayThreads)
+        std::vector<MaNGOS::Thread*> m_delayThreads;        ///< Executer threads
+        std::mutex m_joinLock;                              ///< Queues both halves of joined requests in the same order on every connection
 
         bool m_bAllowAsyncTransactions;                     ///< flag which specifies if async transactions are enabled
 
@@ -286,4 +310,44 @@ class Database
         std::string m_logsDir;
         uint32 m_pingIntervallms;
 };
+
+/**
+ * Routes the async requests (statements, transactions, queries) issued by the current thread
+ * while in scope to the async connection owning key, e.g. a character guid. Requests for one
+ * key stay ordered, different keys commit in parallel when several async connections exist.
+ * Requests issued out of any route use the first connection.
+ *
+ * Keys are owners of rows: characters (saves, items, auctions, petitions), guilds and groups
+ * (their own rows). Keys of different kinds may select the same connection, that only costs
+ * parallelism.
+ *
+ * A route joined with a second key (items moved between two characters, rows of one key
+ * keyed by another one as group_member) also stops the connection of that key until each
+ * request is committed, so the requests stay ordered with the pending and later requests of
+ * both keys. The SqlJoinBarrier blocks the delay thread of the joined connection from the
+ * moment it reaches the barrier until the request was executed on the other one, i.e. for the
+ * remaining queue of the other connection plus the commit. Join only requests that write rows
+ * of both keys, and don't issue them per save or tick.
+ */
+class SqlAsyncRoute
+{
+    public:
+        SqlAsyncRoute(Database const& db, uint32 key);
+        SqlAsyncRoute(Database const& db, uint32 key, uint32 joinedKey);
+        ~SqlAsyncRoute();
+
+        SqlAsyncRoute(SqlAsyncRoute const&) = delete;
+        SqlAsyncRoute& operator=(SqlAsyncRoute const&) = delete;
+
+        // key of the active route for db on this thread, 0 if none
+        static uint32 GetKey(Database const& db);
+        // joined key of the active route for db on this thread, false if the route is not joined
+        static bool GetJoinedKey(Database const& db, uint32& joinedKey);
+
+    private:
+        Database const* m_prevDb;
+        uint32 m_prevKey;
+        bool m_prevJoined;
+        uint32 m_prevJoinedKey;
+};
 #endif
@@ -25,6 +25,7 @@
 
 #include "Database/Field.h"
 #include "Database/QueryResult.h"
+#include "Database/QueryResultBinary.h"
 
 #ifdef DO_POSTGRESQL
 #include "Database/QueryResultPostgre.h"
@@ -204,6 +204,183 @@ bool MySQLConnection::_Query(const char* sql, MYSQL_RES** pResult, MYSQL_FIELD**
     return true;
 }
 
+// enough for the text form of dates and decimals, whose max_length isn't reported as text length
+#define MAX_CONVERTED_TEXT_LENGTH 64
+
+bool MySQLConnection::_QueryBinary(const char* sql, QueryResult** pResult)
+{
+    *pResult = nullptr;
+
+    MYSQL_STMT* stmt = mysql_stmt_init(mMysql);
+    if (!stmt)
+        return false;
+
+    uint32 _s = WorldTimer::getMSTime();
+
+    // statements the server can't prepare, or that return no result set, go through the text protocol
+    if (mysql_stmt_prepare(stmt, sql, static_cast<unsigned long>(strlen(sql))) || !mysql_stmt_field_count(stmt))
+    {
+        mysql_stmt_close(stmt);
+        return false;
+    }
+
+    // let the client compute the widest value of each column, string buffers are sized after it
+    my_bool updateMaxLength = 1;
+    mysql_stmt_attr_set(stmt, STMT_ATTR_UPDATE_MAX_LENGTH, &updateMaxLength);
+
+    if (mysql_stmt_execute(stmt) || mysql_stmt_store_result(stmt))
+    {
+        sLog.outErrorDb("SQL: %s", sql);
+        sLog.outErrorDb("query ERROR: %s", mysql_stmt_error(stmt));
+        mysql_stmt_close(stmt);
+        return true;
+    }
+    DEBUG_FILTER_LOG(LOG_FILTER_SQL_TEXT, "[%u ms] SQL: %s", WorldTimer::getMSTimeDiff(_s, WorldTimer::getMSTime()), sql);
+
+    uint64 rowCount = mysql_stmt_num_rows(stmt);
+    MYSQL_RES* metadata = mysql_stmt_result_metadata(stmt);
+    if (!rowCount || !metadata)
+    {
+        if (metadata)
+            mysql_free_result(metadata);
+        mysql_stmt_free_result(stmt);
+        mysql_stmt_close(stmt);
+        return true;
+    }
+
+    uint32 fieldCount = mysql_num_fields(metadata);
+    MYSQL_FIELD* fields = mysql_fetch_fields(metadata);
+
+    QueryResultBinary* queryResult = new QueryResultBinary(rowCount, fieldCount);
+
+    std::vector<MYSQL_BIND> binds(fieldCount);
+    std::vector<Field::Value> numbers(fieldCount);
+    std::vector<float> floats(fieldCount);
+    std::vector<unsigned long> lengths(fieldCount);
+    std::vector<size_t> textOffsets(fieldCount);
+    std::unique_ptr<my_bool[]> nulls(new my_bool[fieldCount]);
+    std::vector<char> text;
+
+    memset(binds.data(), 0, sizeof(MYSQL_BIND) * fieldCount);
+
+    for (uint32 i = 0; i < fieldCount; ++i)
+    {
+        MYSQL_BIND& bind = binds[i];
+        bind.is_null = &nulls[i];
+        bind.length = &lengths[i];
+
+        Field::StorageTypes storage;
+        switch (fields[i].type)
+        {
+            case MYSQL_TYPE_TINY:
+            case MYSQL_TYPE_SHORT:
+            case MYSQL_TYPE_INT24:
+            case MYSQL_TYPE_LONG:
+            case MYSQL_TYPE_LONGLONG:
+            case MYSQL_TYPE_YEAR:
+                bind.buffer_type = MYSQL_TYPE_LONGLONG;
+                bind.buffer = &numbers[i];
+                bind.is_unsigned = (fields[i].flags & UNSIGNED_FLAG) != 0;
+                storage = bind.is_unsigned ? Field::STORAGE_UINT64 : Field::STORAGE_INT64;
+                break;
+            case MYSQL_TYPE_FLOAT:
+                bind.buffer_type = MYSQL_TYPE_FLOAT;
+                bind.buffer = &floats[i];
+                storage = Field::STORAGE_FLOAT;
+                break;
+            case MYSQL_TYPE_DOUBLE:
+                bind.buffer_type = MYSQL_TYPE_DOUBLE;
+                bind.buffer = &numbers[i];
+                storage = Field::STORAGE_DOUBLE;
+                break;
+            default:                                        // strings, blobs, decimals and dates are fetched as text
+                textOffsets[i] = text.size();
+                bind.buffer_type = MYSQL_TYPE_STRING;
+                bind.buffer_length = std::max<unsigned long>(fields[i].max_length, MAX_CONVERTED_TEXT_LENGTH) + 1;
+                text.resize(text.size() + bind.buffer_length);
+                storage = Field::STORAGE_TEXT;
+                break;
+        }
+
+        queryResult->SetColumn(i, QueryResultMysql::ConvertNativeType(fields[i].type), storage);
+    }
+
+    // text buffers are assigned once the arena stopped growing
+    for (uint32 i = 0; i < fieldCount; ++i)
+        if (binds[i].buffer_type == MYSQL_TYPE_STRING)
+            binds[i].buffer = &text[textOffsets[i]];
+
+    bool ok = !mysql_stmt_bind_result(stmt, binds.data());
+
+    uint64 fetched = 0;
+    while (ok)
+    {
+        int rc = mysql_stmt_fetch(stmt);
+        if (rc == MYSQL_NO_DATA)
+            break;
+
+        if (rc == 1)
+        {
+            ok = false;
+            break;
+        }
+
+        for (uint32 i = 0; i < fieldCount && ok; ++i)
+        {
+            if (nulls[i])
+                queryResult->AddNull(i);
+            else if (binds[i].buffer_type == MYSQL_TYPE_STRING)
+            {
+                if (lengths[i] < binds[i].buffer_length)
+                    queryResult->AddString(i, &text[textOffsets[i]], lengths[i]);
+                else
+                {
+                    // value longer than the reported max_length, fetch it again in full
+                    std::vector<char> value(lengths[i] + 1);
+                    MYSQL_BIND column = binds[i];
+                    column.buffer = value.data();
+                    column.buffer_length = static_cast<unsigned long>(value.size());
+                    if (mysql_stmt_fetch_column(stmt, &column, i, 0))
+                    {
+                        ok = false;
+                        break;
+                    }
+                    queryResult->AddString(i, value.data(), lengths[i]);
+                }
+            }
+            else if (binds[i].buffer_type == MYSQL_TYPE_FLOAT)
+            {
+                Field::Value value;
+                value.d = floats[i];
+                queryResult->AddValue(i, value);
+            }
+            else
+                queryResult->AddValue(i, numbers[i]);
+        }
+
+        if (ok)
+            ++fetched;
+    }
+
+    if (!ok || fetched != rowCount)
+    {
+        sLog.outErrorDb("SQL: %s", sql);
+        sLog.outErrorDb("query ERROR: %s", mysql_stmt_error(stmt));
+        delete queryResult;
+        queryResult = nullptr;
+    }
+
+    mysql_free_result(metadata);
+    mysql_stmt_free_result(stmt);
+    mysql_stmt_close(stmt);
+
+    if (queryResult)
+        queryResult->NextRow();
+
+    *pResult = queryResult;
+    return true;
+}
+
 QueryResult* MySQLConnection::Query(const char* sql)
 {
     MYSQL_RES* result = nullptr;
@@ -220,6 +397,15 @@ QueryResult* MySQLConnection::Query(const char* sql)
     return queryResult;
 }
 
+QueryResult* MySQLConnection::QueryBinary(const char* sql)
+{
+    QueryResult* queryResult;
+    if (_QueryBinary(sql, &queryResult))
+        return queryResult;
+
+    return Query(sql);
+}
+
 QueryNamedResult* MySQLConnection::QueryNamed(const char* sql)
 {
     MYSQL_RES* result = nullptr;
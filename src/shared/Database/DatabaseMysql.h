@@ -74,6 +74,7 @@ class MySQLConnection : public SqlConnection
         bool Initialize(const char* infoString) override;
 
         QueryResult* Query(const char* sql) override;
+        QueryResult* QueryBinary(const char* sql) override;
         QueryNamedResult* QueryNamed(const char* sql) override;
         bool Execute(const char* sql) override;
 
@@ -89,6 +90,8 @@ class MySQLConnection : public SqlConnection
     private:
         bool _TransactionCmd(const char* sql);
         bool _Query(const char* sql, MYSQL_RES** pResult, MYSQL_FIELD** pFields, uint64* pRowCount, uint32* pFieldCount);
+        // returns false when the statement can't go through the binary protocol and has to be run as text query
+        bool _QueryBinary(const char* sql, QueryResult** pResult);
 
         MYSQL* mMysql;
 };
@@ -133,6 +133,163 @@ bool PostgreSQLConnection::_Query(const char* sql, PGresult** pResult, uint64* p
     return true;
 }
 
+// binary values are sent in network byte order
+static uint64 ReadBigEndian(const char* data, int length)
+{
+    uint64 value = 0;
+    for (int i = 0; i < length; ++i)
+        value = (value << 8) | uint8(data[i]);
+    return value;
+}
+
+static bool IsBinaryDecodable(Oid type)
+{
+    switch (type)
+    {
+        case BOOLOID:
+        case CHAROID:
+        case INT2OID:
+        case INT4OID:
+        case INT8OID:
+        case OIDOID:
+        case FLOAT4OID:
+        case FLOAT8OID:
+        case NAMEOID:
+        case TEXTOID:
+        case BPCHAROID:
+        case VARCHAROID:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool PostgreSQLConnection::_QueryBinary(const char* sql, QueryResult** pResult)
+{
+    *pResult = nullptr;
+
+    uint32 _s = WorldTimer::getMSTime();
+
+    // describe the unnamed statement first, the result format can only be chosen for all columns at once
+    PGresult* prepared = PQprepare(mPGconn, "", sql, 0, nullptr);
+    bool usable = prepared && PQresultStatus(prepared) == PGRES_COMMAND_OK;
+    PQclear(prepared);
+    if (!usable)
+        return false;
+
+    PGresult* description = PQdescribePrepared(mPGconn, "");
+    usable = description && PQresultStatus(description) == PGRES_COMMAND_OK && PQnfields(description) > 0;
+    for (int i = 0; usable && i < PQnfields(description); ++i)
+        usable = IsBinaryDecodable(PQftype(description, i));
+    PQclear(description);
+    if (!usable)
+        return false;
+
+    PGresult* result = PQexecPrepared(mPGconn, "", 0, nullptr, nullptr, nullptr, 1);
+    if (!result || PQresultStatus(result) != PGRES_TUPLES_OK)
+    {
+        sLog.outErrorDb("SQL : %s", sql);
+        sLog.outErrorDb("SQL %s", PQerrorMessage(mPGconn));
+        PQclear(result);
+        return true;
+    }
+    DEBUG_FILTER_LOG(LOG_FILTER_SQL_TEXT, "[%u ms] SQL: %s", WorldTimer::getMSTimeDiff(_s, WorldTimer::getMSTime()), sql);
+
+    uint64 rowCount = PQntuples(result);
+    uint32 fieldCount = PQnfields(result);
+    if (!rowCount)
+    {
+        PQclear(result);
+        return true;
+    }
+
+    QueryResultBinary* queryResult = new QueryResultBinary(rowCount, fieldCount);
+
+    std::vector<Oid> types(fieldCount);
+    for (uint32 i = 0; i < fieldCount; ++i)
+    {
+        types[i] = PQftype(result, i);
+
+        Field::StorageTypes storage;
+        switch (types[i])
+        {
+            case BOOLOID:
+            case CHAROID:
+            case INT2OID:
+            case INT4OID:
+            case INT8OID:   storage = Field::STORAGE_INT64;  break;
+            case OIDOID:    storage = Field::STORAGE_UINT64; break;
+            case FLOAT4OID: storage = Field::STORAGE_FLOAT;  break;
+            case FLOAT8OID: storage = Field::STORAGE_DOUBLE; break;
+            default:        storage = Field::STORAGE_TEXT;   break;
+        }
+
+        queryResult->SetColumn(i, QueryResultPostgre::ConvertNativeType(types[i]), storage);
+    }
+
+    for (uint64 row = 0; row < rowCount; ++row)
+    {
+        for (uint32 i = 0; i < fieldCount; ++i)
+        {
+            const char* data = PQgetvalue(result, int(row), int(i));
+            int length = PQgetlength(result, int(row), int(i));
+
+            // same as the text result: empty values read as NULL
+            if (PQgetisnull(result, int(row), int(i)) || !length)
+            {
+                queryResult->AddNull(i);
+                continue;
+            }
+
+            Field::Value value;
+            switch (types[i])
+            {
+                case BOOLOID:
+                case CHAROID:
+                    value.i = int8(data[0]);
+                    break;
+                case INT2OID:
+                    value.i = int16(ReadBigEndian(data, 2));
+                    break;
+                case INT4OID:
+                    value.i = int32(ReadBigEndian(data, 4));
+                    break;
+                case INT8OID:
+                    value.i = int64(ReadBigEndian(data, 8));
+                    break;
+                case OIDOID:
+                    value.u = uint32(ReadBigEndian(data, 4));
+                    break;
+                case FLOAT4OID:
+                {
+                    uint32 bits = uint32(ReadBigEndian(data, 4));
+                    float f;
+                    memcpy(&f, &bits, sizeof(f));
+                    value.d = f;
+                    break;
+                }
+                case FLOAT8OID:
+                {
+                    uint64 bits = ReadBigEndian(data, 8);
+                    memcpy(&value.d, &bits, sizeof(value.d));
+                    break;
+                }
+                default:                                    // text types are sent as is
+                    queryResult->AddString(i, data, size_t(length));
+                    continue;
+            }
+
+            queryResult->AddValue(i, value);
+        }
+    }
+
+    PQclear(result);
+
+    queryResult->NextRow();
+    *pResult = queryResult;
+    return true;
+}
+
 QueryResult* PostgreSQLConnection::Query(const char* sql)
 {
     if (!mPGconn)
@@ -151,6 +308,18 @@ QueryResult* PostgreSQLConnection::Query(const char* sql)
     return queryResult;
 }
 
+QueryResult* PostgreSQLConnection::QueryBinary(const char* sql)
+{
+    if (!mPGconn)
+        return nullptr;
+
+    QueryResult* queryResult;
+    if (_QueryBinary(sql, &queryResult))
+        return queryResult;
+
+    return Query(sql);
+}
+
 QueryNamedResult* PostgreSQLConnection::QueryNamed(const char* sql)
 {
     if (!mPGconn)
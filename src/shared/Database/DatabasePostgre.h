@@ -41,6 +41,7 @@ class PostgreSQLConnection : public SqlConnection
         bool Initialize(const char* infoString) override;
 
         QueryResult* Query(const char* sql) override;
+        QueryResult* QueryBinary(const char* sql) override;
         QueryNamedResult* QueryNamed(const char* sql) override;
         bool Execute(const char* sql) override;
 
@@ -53,6 +54,8 @@ class PostgreSQLConnection : public SqlConnection
     private:
         bool _TransactionCmd(const char* sql);
         bool _Query(const char* sql, PGresult** pResult, uint64* pRowCount, uint32* pFieldCount) override;
+        // returns false when the result has columns without a binary decoder and has to be run as text query
+        bool _QueryBinary(const char* sql, QueryResult** pResult);
 
         PGconn* mPGconn;
 };
@@ -17,3 +17,30 @@
  */
 
 //#include "DatabaseEnv.h"
+
+#include "Field.h"
+
+#include <limits>
+
+const char* Field::FormatValue() const
+{
+    switch (mStorage)
+    {
+        case STORAGE_INT64:
+            snprintf(mText, sizeof(mText), SI64FMTD, mData.i);
+            break;
+        case STORAGE_UINT64:
+            snprintf(mText, sizeof(mText), UI64FMTD, mData.u);
+            break;
+        case STORAGE_FLOAT:
+            snprintf(mText, sizeof(mText), "%.*g", std::numeric_limits<float>::digits10, mData.d);
+            break;
+        case STORAGE_DOUBLE:
+            snprintf(mText, sizeof(mText), "%.*g", std::numeric_limits<double>::digits10, mData.d);
+            break;
+        default:
+            return mValue ? mValue : "";
+    }
+
+    return mText;
+}
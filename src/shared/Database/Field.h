@@ -34,31 +34,89 @@ class Field
             DB_TYPE_BOOL    = 0x04
         };
 
-        Field() : mValue(nullptr), mType(DB_TYPE_UNKNOWN) {}
-        Field(const char* value, enum DataTypes type) : mValue(value), mType(type) {}
+        // how the current value is held: text returned by the DBMS, or a value already decoded by a binary result set
+        enum StorageTypes
+        {
+            STORAGE_TEXT     = 0,
+            STORAGE_INT64    = 1,
+            STORAGE_UINT64   = 2,
+            STORAGE_FLOAT    = 3,                           // single precision column, held as double
+            STORAGE_DOUBLE   = 4
+        };
+
+        union Value
+        {
+            int64  i;
+            uint64 u;
+            double d;
+        };
+
+        Field() : mValue(nullptr), mType(DB_TYPE_UNKNOWN), mStorage(STORAGE_TEXT) {}
+        Field(const char* value, enum DataTypes type) : mValue(value), mType(type), mStorage(STORAGE_TEXT) {}
 
         ~Field() {}
 
         enum DataTypes GetType() const { return mType; }
-        bool IsNULL() const { return mValue == nullptr; }
+        bool IsNULL() const { return mStorage == STORAGE_TEXT && mValue == nullptr; }
 
         const char* GetString() const
         {
+            if (mStorage != STORAGE_TEXT)
+                return FormatValue();
+
             return mValue ? mValue : ""; // We need this null check as we do not always null check what we get back from the database everywhere
         }
         std::string GetCppString() const
         {
-            return mValue ? mValue : "";                    // std::string s = 0 have undefine result in C++
+            return GetString();                             // std::string s = 0 have undefine result in C++
+        }
+        float GetFloat() const
+        {
+            if (mStorage != STORAGE_TEXT)
+                return static_cast<float>(GetDoubleValue());
+            return mValue ? static_cast<float>(atof(mValue)) : 0.0f;
+        }
+        bool GetBool() const
+        {
+            if (mStorage != STORAGE_TEXT)
+                return static_cast<int32>(GetIntegerValue()) > 0;
+            return mValue ? atoi(mValue) > 0 : false;
+        }
+        int32 GetInt32() const
+        {
+            if (mStorage != STORAGE_TEXT)
+                return static_cast<int32>(GetIntegerValue());
+            return mValue ? static_cast<int32>(atol(mValue)) : int32(0);
+        }
+        uint8 GetUInt8() const
+        {
+            if (mStorage != STORAGE_TEXT)
+                return static_cast<uint8>(GetIntegerValue());
+            return mValue ? static_cast<uint8>(atol(mValue)) : uint8(0);
+        }
+        uint16 GetUInt16() const
+        {
+            if (mStorage != STORAGE_TEXT)
+                return static_cast<uint16>(GetIntegerValue());
+            return mValue ? static_cast<uint16>(atol(mValue)) : uint16(0);
+        }
+        int16 GetInt16() const
+        {
+            if (mStorage != STORAGE_TEXT)
+                return static_cast<int16>(GetIntegerValue());
+            return mValue ? static_cast<int16>(atol(mValue)) : int16(0);
+        }
+        uint32 GetUInt32() const
+        {
+            if (mStorage != STORAGE_TEXT)
+                return static_cast<uint32>(GetIntegerValue());
+            return mValue ? static_cast<uint32>(atoll(mValue)) : uint32(0);
         }
-        float GetFloat() const { return mValue ? static_cast<float>(atof(mValue)) : 0.0f; }
-        bool GetBool() const { return mValue ? atoi(mValue) > 0 : false; }
-        int32 GetInt32() const { return mValue ? static_cast<int32>(atol(mValue)) : int32(0); }
-        uint8 GetUInt8() const { return mValue ? static_cast<uint8>(atol(mValue)) : uint8(0); }
-        uint16 GetUInt16() const { return mValue ? static_cast<uint16>(atol(mValue)) : uint16(0); }
-        int16 GetInt16() const { return mValue ? static_cast<int16>(atol(mValue)) : int16(0); }
-        uint32 GetUInt32() const { return mValue ? static_cast<uint32>(atoll(mValue)) : uint32(0); }
         uint64 GetUInt64() const
         {
+            if (mStorage != STORAGE_TEXT)
+                return static_cast<uint64>(GetIntegerValue());
+
             uint64 value = 0;
             if (!mValue || sscanf(mValue, UI64FMTD, &value) == -1)
                 return 0;
@@ -69,13 +127,33 @@ class Field
         void SetType(enum DataTypes type) { mType = type; }
         // no need for memory allocations to store resultset field strings
         // all we need is to cache pointers returned by different DBMS APIs
-        void SetValue(const char* value) { mValue = value; }
+        void SetValue(const char* value) { mValue = value; mStorage = STORAGE_TEXT; }
+        // decoded value from a binary result set, NULL is still stored as SetValue(nullptr)
+        void SetValue(StorageTypes storage, Value value) { mData = value; mStorage = storage; }
 
     private:
         Field(Field const&);
         Field& operator=(Field const&);
 
+        int64 GetIntegerValue() const
+        {
+            return mStorage == STORAGE_FLOAT || mStorage == STORAGE_DOUBLE ? static_cast<int64>(mData.d) : mData.i;
+        }
+        double GetDoubleValue() const
+        {
+            switch (mStorage)
+            {
+                case STORAGE_INT64:  return static_cast<double>(mData.i);
+                case STORAGE_UINT64: return static_cast<double>(mData.u);
+                default:             return mData.d;
+            }
+        }
+        const char* FormatValue() const;
+
         const char* mValue;
+        Value mData;
         enum DataTypes mType;
+        StorageTypes mStorage;
+        mutable char mText[32];                             // text form of a decoded value, built on request
 };
 #endif
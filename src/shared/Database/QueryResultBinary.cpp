@@ -0,0 +1,105 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "QueryResultBinary.h"
+
+QueryResultBinary::QueryResultBinary(uint64 rowCount, uint32 fieldCount) :
+    QueryResult(rowCount, fieldCount), mColumns(fieldCount), mRowIndex(0)
+{
+    mCurrentRow = new Field[mFieldCount];
+
+    for (Column& column : mColumns)
+    {
+        column.storage = Field::STORAGE_TEXT;
+        column.values.reserve(size_t(rowCount));
+        column.nulls.reserve(size_t(rowCount));
+    }
+}
+
+QueryResultBinary::~QueryResultBinary()
+{
+    EndQuery();
+}
+
+void QueryResultBinary::SetColumn(uint32 column, Field::DataTypes type, Field::StorageTypes storage)
+{
+    mCurrentRow[column].SetType(type);
+    mColumns[column].storage = storage;
+}
+
+void QueryResultBinary::AddNull(uint32 column)
+{
+    Column& col = mColumns[column];
+    col.values.push_back(Field::Value());
+    col.nulls.push_back(true);
+}
+
+void QueryResultBinary::AddValue(uint32 column, Field::Value value)
+{
+    Column& col = mColumns[column];
+    col.values.push_back(value);
+    col.nulls.push_back(false);
+}
+
+void QueryResultBinary::AddString(uint32 column, const char* data, size_t length)
+{
+    Field::Value value;
+    value.u = mStrings.size();
+
+    mStrings.insert(mStrings.end(), data, data + length);
+    mStrings.push_back('\0');
+
+    Column& col = mColumns[column];
+    col.values.push_back(value);
+    col.nulls.push_back(false);
+}
+
+bool QueryResultBinary::NextRow()
+{
+    if (!mCurrentRow)
+        return false;
+
+    if (mRowIndex >= mRowCount)
+    {
+        EndQuery();
+        return false;
+    }
+
+    for (uint32 i = 0; i < mFieldCount; ++i)
+    {
+        Column const& col = mColumns[i];
+        if (col.nulls[mRowIndex])
+            mCurrentRow[i].SetValue(nullptr);
+        else if (col.storage == Field::STORAGE_TEXT)
+            mCurrentRow[i].SetValue(&mStrings[col.values[mRowIndex].u]);
+        else
+            mCurrentRow[i].SetValue(col.storage, col.values[mRowIndex]);
+    }
+    ++mRowIndex;
+
+    return true;
+}
+
+void QueryResultBinary::EndQuery()
+{
+    delete[] mCurrentRow;
+    mCurrentRow = nullptr;
+
+    std::vector<Column>().swap(mColumns);
+    std::vector<char>().swap(mStrings);
+}
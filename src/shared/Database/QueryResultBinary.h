@@ -0,0 +1,63 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef QUERYRESULTBINARY_H
+#define QUERYRESULTBINARY_H
+
+#include "Common.h"
+#include "QueryResult.h"
+
+/**
+ * Result set filled from a DBMS binary protocol.
+ *
+ * Numeric columns arrive already decoded and are stored column by column as Field::Value,
+ * strings are copied into one arena. NextRow() only points the current row fields at the
+ * stored values, so the getters don't have to parse text.
+ */
+class QueryResultBinary : public QueryResult
+{
+    public:
+        QueryResultBinary(uint64 rowCount, uint32 fieldCount);
+        ~QueryResultBinary();
+
+        // column description, must be set for every column before values are added
+        void SetColumn(uint32 column, Field::DataTypes type, Field::StorageTypes storage);
+
+        // append the next value of a column
+        void AddNull(uint32 column);
+        void AddValue(uint32 column, Field::Value value);
+        void AddString(uint32 column, const char* data, size_t length);
+
+        bool NextRow() override;
+
+    private:
+        struct Column
+        {
+            Field::StorageTypes storage;
+            std::vector<Field::Value> values;               // string columns keep arena offsets here
+            std::vector<bool> nulls;
+        };
+
+        void EndQuery();
+
+        std::vector<Column> mColumns;
+        std::vector<char> mStrings;
+        uint64 mRowIndex;
+};
+
+#endif
@@ -74,7 +74,7 @@ void QueryResultPostgre::EndQuery()
 }
 
 // see types in #include <postgre/pg_type.h>
-enum Field::DataTypes QueryResultPostgre::ConvertNativeType(Oid  pOid) const
+enum Field::DataTypes QueryResultPostgre::ConvertNativeType(Oid  pOid)
 {
     switch (pOid)
     {
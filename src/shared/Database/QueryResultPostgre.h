@@ -80,8 +80,9 @@ class QueryResultPostgre : public QueryResult
 
         bool NextRow() override;
 
+        static enum Field::DataTypes ConvertNativeType(Oid pOid);
+
     private:
-        enum Field::DataTypes ConvertNativeType(Oid pOid) const;
         void EndQuery() override;
 
         PGresult* mResult;
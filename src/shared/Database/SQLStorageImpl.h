@@ -211,7 +211,7 @@ void SQLStorageLoaderBase<DerivedLoader, StorageClass>::Load(StorageClass& store
         delete result;
     }
 
-    result = WorldDatabase.PQuery("SELECT * FROM %s", store.GetTableName());
+    result = WorldDatabase.PQueryBinary("SELECT * FROM %s", store.GetTableName());
 
     if (!result)
     {
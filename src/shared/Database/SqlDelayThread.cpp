@@ -20,7 +20,11 @@
 #include "Database/SqlOperations.h"
 #include "DatabaseEnv.h"
 
-SqlDelayThread::SqlDelayThread(Database* db, SqlConnection* conn) : m_dbEngine(db), m_dbConnection(conn), m_running(true)
+#include <algorithm>
+#include <chrono>
+
+SqlDelayThread::SqlDelayThread(Database* db, SqlConnection* conn, bool pingDatabase) : m_dbEngine(db), m_dbConnection(conn), m_running(true),
+    m_pingDatabase(pingDatabase)
 {
 }
 
@@ -36,23 +40,43 @@ void SqlDelayThread::run()
     mysql_thread_init();
 #endif
 
-    const uint32 loopSleepms = 10;
-
-    const uint32 pingEveryLoop = m_dbEngine->GetPingIntervall() / loopSleepms;
+    const std::chrono::milliseconds pingInterval(std::max(m_dbEngine->GetPingIntervall(), uint32(1000)));
+    std::chrono::steady_clock::time_point nextPing = std::chrono::steady_clock::now() + pingInterval;
 
-    uint32 loopCounter = 0;
-    while (m_running)
+    for (;;)
     {
+        // sleep until requests are queued, stop is requested or the connections need a ping
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            m_queueCondition.wait_until(lock, nextPing, [this] { return !m_running || !m_sqlQueue.empty(); });
+        }
+
         // if the running state gets turned off while sleeping
         // empty the queue before exiting
-        MaNGOS::Thread::Sleep(loopSleepms);
-
         ProcessRequests();
 
-        if ((loopCounter++) >= pingEveryLoop)
+        // requests queued while the queue was processed are executed before stopping as well
+        {
+            std::lock_guard<std::mutex> guard(m_queueMutex);
+            if (!m_running && m_sqlQueue.empty())
+                break;
+        }
+
+        if (std::chrono::steady_clock::now() >= nextPing)
         {
-            loopCounter = 0;
-            m_dbEngine->Ping();
+            nextPing = std::chrono::steady_clock::now() + pingInterval;
+            if (m_pingDatabase)
+                m_dbEngine->Ping();
+        }
+    }
+
+    // drop requests queued after the final flush now, a joined request waiting for one of them is released
+    {
+        std::lock_guard<std::mutex> guard(m_queueMutex);
+        if (!m_sqlQueue.empty())
+        {
+            sLog.outError("SqlDelayThread: %u async requests queued after the database connection was stopped are dropped", uint32(m_sqlQueue.size()));
+            m_sqlQueue = std::queue<std::unique_ptr<SqlOperation>>();
         }
     }
 
@@ -63,7 +87,11 @@ void SqlDelayThread::run()
 
 void SqlDelayThread::Stop()
 {
-    m_running = false;
+    {
+        std::lock_guard<std::mutex> guard(m_queueMutex);
+        m_running = false;
+    }
+    m_queueCondition.notify_one();
 }
 
 void SqlDelayThread::ProcessRequests()
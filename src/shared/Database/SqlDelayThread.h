@@ -22,6 +22,7 @@
 #include "Threading.h"
 #include "SqlOperations.h"
 
+#include <condition_variable>
 #include <mutex>
 #include <queue>
 #include <memory>
@@ -34,23 +35,28 @@ class SqlDelayThread : public MaNGOS::Runnable
 {
     private:
         std::mutex m_queueMutex;
+        std::condition_variable m_queueCondition;               ///< Signaled on new requests and stop
         std::queue<std::unique_ptr<SqlOperation>> m_sqlQueue;   ///< Queue of SQL statements
         Database* m_dbEngine;                                   ///< Pointer to used Database engine
         SqlConnection* m_dbConnection;                          ///< Pointer to DB connection
-        volatile bool m_running;
+        bool m_running;
+        bool m_pingDatabase;                                    ///< Ping all connections of m_dbEngine (done by one thread only)
 
         // process all enqueued requests
         void ProcessRequests();
 
     public:
-        SqlDelayThread(Database* db, SqlConnection* conn);
+        SqlDelayThread(Database* db, SqlConnection* conn, bool pingDatabase = true);
         ~SqlDelayThread();
 
         ///< Put sql statement to delay queue
         bool Delay(SqlOperation* sql)
         {
-            std::lock_guard<std::mutex> guard(m_queueMutex);
-            m_sqlQueue.push(std::unique_ptr<SqlOperation>(sql));
+            {
+                std::lock_guard<std::mutex> guard(m_queueMutex);
+                m_sqlQueue.push(std::unique_ptr<SqlOperation>(sql));
+            }
+            m_queueCondition.notify_one();
             return true;
         }
 
@@ -60,11 +60,20 @@ bool SqlTransaction::Execute(SqlConnection* conn)
         if (!pStmt->Execute(conn))
         {
             conn->RollbackTransaction();
+            if (m_failed)
+                *m_failed = true;
             return false;
         }
     }
 
-    return conn->CommitTransaction();
+    if (!conn->CommitTransaction())
+    {
+        if (m_failed)
+            *m_failed = true;
+        return false;
+    }
+
+    return true;
 }
 
 SqlPreparedRequest::SqlPreparedRequest(int nIndex, SqlStmtParameters* arg) : m_nIndex(nIndex), m_param(arg)
@@ -82,6 +91,54 @@ bool SqlPreparedRequest::Execute(SqlConnection* conn)
     return conn->ExecuteStmt(m_nIndex, *m_param);
 }
 
+/// ---- ASYNC REQUESTS JOINED ON TWO CONNECTIONS ----
+
+void SqlJoin::Arrive()
+{
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_arrived = true;
+    }
+    m_condition.notify_all();
+}
+
+void SqlJoin::Release()
+{
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_released = true;
+    }
+    m_condition.notify_all();
+}
+
+void SqlJoin::WaitArrival()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [this] { return m_arrived; });
+}
+
+void SqlJoin::WaitRelease()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [this] { return m_released; });
+}
+
+bool SqlJoinedRequest::Execute(SqlConnection* conn)
+{
+    // everything queued before on the joined connection is committed now
+    m_join->WaitArrival();
+    bool result = m_request->Execute(conn);
+    m_join->Release();
+    return result;
+}
+
+bool SqlJoinBarrier::Execute(SqlConnection* /*conn*/)
+{
+    m_join->Arrive();
+    m_join->WaitRelease();
+    return true;
+}
+
 /// ---- ASYNC QUERIES ----
 
 bool SqlQuery::Execute(SqlConnection* conn)
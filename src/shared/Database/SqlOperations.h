@@ -22,6 +22,8 @@
 #include "Common.h"
 #include "Utilities/Callback.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <queue>
 #include <vector>
 #include <mutex>
@@ -58,12 +60,15 @@ class SqlTransaction : public SqlOperation
 {
     private:
         std::vector<SqlOperation* > m_queue;
+        std::shared_ptr<std::atomic<bool>> m_failed;        ///< set when the transaction is rolled back, if any
 
     public:
         SqlTransaction() {}
         ~SqlTransaction();
 
         void DelayExecute(SqlOperation* sql) { m_queue.push_back(sql); }
+        size_t Size() const { return m_queue.size(); }
+        void SetFailedFlag(std::shared_ptr<std::atomic<bool>> const& failed) { m_failed = failed; }
 
         bool Execute(SqlConnection* conn) override;
 };
@@ -81,6 +86,53 @@ class SqlPreparedRequest : public SqlOperation
         SqlStmtParameters* m_param;
 };
 
+/// ---- ASYNC REQUESTS JOINED ON TWO CONNECTIONS ----
+
+// rendezvous of the two halves of a joined request, see SqlAsyncRoute
+class SqlJoin
+{
+    private:
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        bool m_arrived;                                     ///< the joined connection reached its SqlJoinBarrier
+        bool m_released;                                    ///< the request was executed (or dropped)
+
+    public:
+        SqlJoin() : m_arrived(false), m_released(false) {}
+
+        void Arrive();
+        void Release();
+        void WaitArrival();
+        void WaitRelease();
+};
+
+// executes the request once the joined connection reached the matching SqlJoinBarrier
+class SqlJoinedRequest : public SqlOperation
+{
+    private:
+        std::unique_ptr<SqlOperation> m_request;
+        std::shared_ptr<SqlJoin> m_join;
+
+    public:
+        SqlJoinedRequest(SqlOperation* request, std::shared_ptr<SqlJoin> const& join) : m_request(request), m_join(join) {}
+        ~SqlJoinedRequest() { m_join->Release(); }          // never leave the barrier waiting for a dropped request
+
+        bool Execute(SqlConnection* conn) override;
+};
+
+// holds the joined connection until the request is executed on the other one
+class SqlJoinBarrier : public SqlOperation
+{
+    private:
+        std::shared_ptr<SqlJoin> m_join;
+
+    public:
+        explicit SqlJoinBarrier(std::shared_ptr<SqlJoin> const& join) : m_join(join) {}
+        ~SqlJoinBarrier() { m_join->Arrive(); }             // never leave the request waiting for a dropped barrier
+
+        bool Execute(SqlConnection* conn) override;
+};
+
 /// ---- ASYNC QUERIES ----
 
 class SqlQuery;                                             /// contains a single async query
@@ -23,7 +23,9 @@
 #include "Util.h"
 #include "ByteBuffer.h"
 #include "ProgressBar.h"
+#include "Utilities/LockFreeQueue.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <thread>
@@ -65,9 +67,75 @@ enum LogType
 
 const int LogType_count = int(LogError) + 1;
 
+// destinations of queued records, resolved to the FILE* only when written
+enum LogSink
+{
+    LOG_SINK_STDOUT = 0,
+    LOG_SINK_STDERR,
+    LOG_SINK_MAIN,
+    LOG_SINK_GM,
+    LOG_SINK_GM_ACCOUNT,
+    LOG_SINK_CHAR,
+    LOG_SINK_DB_ERROR,
+    LOG_SINK_EVENT_AI_ERROR,
+    LOG_SINK_SCRIPT_ERROR,
+    LOG_SINK_RA,
+    LOG_SINK_WORLD,
+    LOG_SINK_CUSTOM
+};
+
+struct LogRecord
+{
+    LogRecord() : sink(LOG_SINK_STDOUT), color(-1), timestamp(false), account(0), time(0), sequence(0) {}
+
+    uint8 sink;
+    int8 color;                                             // console color, -1 for none
+    bool timestamp;                                         // prefix the time the record was queued at
+    uint32 account;                                         // owner of a per account gm log record
+    time_t time;
+    uint64 sequence;                                        // queue order over all threads, records of the rings are written in it
+    std::string text;                                       // complete text, including the line ends
+};
+
+// records of one thread, only that thread pushes
+struct LogRing
+{
+    explicit LogRing(size_t size) : queue(size) {}
+
+    MaNGOS::LockFreeQueue<LogRecord> queue;
+};
+
+// shared with Log::m_rings, a ring only held there belongs to a finished thread
+static thread_local std::shared_ptr<LogRing> t_logRing;
+
+// how long a producer waits for room in its full ring before the record is dropped
+#define LOG_ASYNC_MAX_WAIT_MS   10
+
+static std::string FormatLogText(const char* format, va_list ap)
+{
+    char buf[1024];
+
+    va_list copy;
+    va_copy(copy, ap);
+    int len = vsnprintf(buf, sizeof(buf), format, copy);
+    va_end(copy);
+
+    if (len < 0)
+        return std::string();
+
+    if (size_t(len) < sizeof(buf))
+        return std::string(buf, len);
+
+    std::string text(len, '\0');
+    vsnprintf(&text[0], len + 1, format, ap);
+    return text;
+}
+
 Log::Log() :
     raLogfile(nullptr), logfile(nullptr), gmLogfile(nullptr), charLogfile(nullptr), dberLogfile(nullptr),
-    eventAiErLogfile(nullptr), scriptErrLogFile(nullptr), worldLogfile(nullptr), customLogFile(nullptr), m_colored(false), m_includeTime(false), m_gmlog_per_account(false), m_scriptLibName(nullptr)
+    eventAiErLogfile(nullptr), scriptErrLogFile(nullptr), worldLogfile(nullptr), customLogFile(nullptr), m_colored(false), m_includeTime(false), m_gmlog_per_account(false), m_scriptLibName(nullptr),
+    m_asyncConfigured(false), m_asyncFlushInterval(100), m_asyncQueueSize(4096), m_asyncEnabled(false), m_asyncStop(false),
+    m_asyncSequence(0), m_asyncWritten(0), m_asyncStalls(0), m_asyncDropped(0), m_asyncReportedDrops(0)
 {
     Initialize();
 }
@@ -282,6 +350,11 @@ void Log::Initialize()
 
     // Char log settings
     m_charLog_Dump = sConfig.GetBoolDefault("CharLogDump", false);
+
+    // Async writer settings, the writer itself is started by the daemon once it is up
+    m_asyncConfigured = sConfig.GetBoolDefault("LogAsync", false);
+    m_asyncFlushInterval = std::max(1, sConfig.GetIntDefault("LogAsyncFlushInterval", 100));
+    m_asyncQueueSize = std::max(64, sConfig.GetIntDefault("LogAsyncQueueSize", 4096));
 }
 
 FILE* Log::openLogFile(char const* configFileName, char const* configTimeStampFlag, char const* mode)
@@ -355,6 +428,15 @@ std::string Log::GetTimestampStr()
 
 void Log::outString()
 {
+    if (IsAsync())
+    {
+        time_t t = time(nullptr);
+        QueueConsole(true, -1, t, "");
+        if (logfile)
+            QueueFile(LOG_SINK_MAIN, t, "");
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
     if (m_includeTime)
         outTime();
@@ -374,6 +456,15 @@ void Log::outString(const char* str, ...)
     if (!str)
         return;
 
+    if (IsAsync())
+    {
+        va_list ap;
+        va_start(ap, str);
+        QueueFormatted(LOG_LVL_MINIMAL, LogNormal, "", -1, 0, str, ap);
+        va_end(ap);
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
 
     if (m_colored)
@@ -413,6 +504,15 @@ void Log::outError(const char* err, ...)
     if (!err)
         return;
 
+    if (IsAsync())
+    {
+        va_list ap;
+        va_start(ap, err);
+        QueueFormatted(LOG_LVL_MINIMAL, LogError, "ERROR:", -1, 0, err, ap);
+        va_end(ap);
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
 
     if (m_colored)
@@ -449,6 +549,17 @@ void Log::outError(const char* err, ...)
 
 void Log::outErrorDb()
 {
+    if (IsAsync())
+    {
+        time_t t = time(nullptr);
+        QueueConsole(false, -1, t, "");
+        if (logfile)
+            QueueFile(LOG_SINK_MAIN, t, "ERROR:");
+        if (dberLogfile)
+            QueueFile(LOG_SINK_DB_ERROR, t, "");
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
 
     if (m_includeTime)
@@ -478,6 +589,15 @@ void Log::outErrorDb(const char* err, ...)
     if (!err)
         return;
 
+    if (IsAsync())
+    {
+        va_list ap;
+        va_start(ap, err);
+        QueueFormatted(LOG_LVL_MINIMAL, LogError, "ERROR:", dberLogfile ? LOG_SINK_DB_ERROR : -1, 0, err, ap);
+        va_end(ap);
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
 
     if (m_colored)
@@ -528,6 +648,17 @@ void Log::outErrorDb(const char* err, ...)
 
 void Log::outErrorEventAI()
 {
+    if (IsAsync())
+    {
+        time_t t = time(nullptr);
+        QueueConsole(false, -1, t, "");
+        if (logfile)
+            QueueFile(LOG_SINK_MAIN, t, "ERROR CreatureEventAI");
+        if (eventAiErLogfile)
+            QueueFile(LOG_SINK_EVENT_AI_ERROR, t, "");
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
 
     if (m_includeTime)
@@ -557,6 +688,15 @@ void Log::outErrorEventAI(const char* err, ...)
     if (!err)
         return;
 
+    if (IsAsync())
+    {
+        va_list ap;
+        va_start(ap, err);
+        QueueFormatted(LOG_LVL_MINIMAL, LogError, "ERROR CreatureEventAI: ", eventAiErLogfile ? LOG_SINK_EVENT_AI_ERROR : -1, 0, err, ap);
+        va_end(ap);
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
     if (m_colored)
         SetColor(false, m_colors[LogError]);
@@ -609,6 +749,15 @@ void Log::outBasic(const char* str, ...)
     if (!str)
         return;
 
+    if (IsAsync())
+    {
+        va_list ap;
+        va_start(ap, str);
+        QueueFormatted(LOG_LVL_BASIC, LogDetails, "", -1, 0, str, ap);
+        va_end(ap);
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
     if (m_logLevel >= LOG_LVL_BASIC)
     {
@@ -648,6 +797,15 @@ void Log::outDetail(const char* str, ...)
     if (!str)
         return;
 
+    if (IsAsync())
+    {
+        va_list ap;
+        va_start(ap, str);
+        QueueFormatted(LOG_LVL_DETAIL, LogDetails, "", -1, 0, str, ap);
+        va_end(ap);
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
     if (m_logLevel >= LOG_LVL_DETAIL)
     {
@@ -689,6 +847,15 @@ void Log::outDebug(const char* str, ...)
     if (!str)
         return;
 
+    if (IsAsync())
+    {
+        va_list ap;
+        va_start(ap, str);
+        QueueFormatted(LOG_LVL_DEBUG, LogDebug, "", -1, 0, str, ap);
+        va_end(ap);
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
     if (m_logLevel >= LOG_LVL_DEBUG)
     {
@@ -730,6 +897,15 @@ void Log::outCommand(uint32 account, const char* str, ...)
     if (!str)
         return;
 
+    if (IsAsync())
+    {
+        va_list ap;
+        va_start(ap, str);
+        QueueFormatted(LOG_LVL_DETAIL, LogDetails, "", m_gmlog_per_account ? LOG_SINK_GM_ACCOUNT : gmLogfile ? LOG_SINK_GM : -1, account, str, ap);
+        va_end(ap);
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
     if (m_logLevel >= LOG_LVL_DETAIL)
     {
@@ -794,6 +970,18 @@ void Log::outChar(const char* str, ...)
     if (!str)
         return;
 
+    if (IsAsync())
+    {
+        if (charLogfile)
+        {
+            va_list ap;
+            va_start(ap, str);
+            QueueFile(LOG_SINK_CHAR, time(nullptr), FormatLogText(str, ap));
+            va_end(ap);
+        }
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
     if (charLogfile)
     {
@@ -809,6 +997,17 @@ void Log::outChar(const char* str, ...)
 
 void Log::outErrorScriptLib()
 {
+    if (IsAsync())
+    {
+        time_t t = time(nullptr);
+        QueueConsole(false, -1, t, "");
+        if (logfile)
+            QueueFile(LOG_SINK_MAIN, t, m_scriptLibName ? std::string("<") + m_scriptLibName + " ERROR:> " : "<Scripting Library ERROR>: ");
+        if (scriptErrLogFile)
+            QueueFile(LOG_SINK_SCRIPT_ERROR, t, "");
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
     if (m_includeTime)
         outTime();
@@ -840,6 +1039,16 @@ void Log::outErrorScriptLib(const char* err, ...)
     if (!err)
         return;
 
+    if (IsAsync())
+    {
+        va_list ap;
+        va_start(ap, err);
+        QueueFormatted(LOG_LVL_MINIMAL, LogError, m_scriptLibName ? std::string("<") + m_scriptLibName + " ERROR>: " : "<Scripting Library ERROR>: ",
+                       scriptErrLogFile ? LOG_SINK_SCRIPT_ERROR : -1, 0, err, ap);
+        va_end(ap);
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
     if (m_colored)
         SetColor(false, m_colors[LogError]);
@@ -895,6 +1104,34 @@ void Log::outWorldPacketDump(const char* socket, uint32 opcode, char const* opco
     if (!worldLogfile)
         return;
 
+    if (IsAsync())
+    {
+        LogRecord record;
+        record.sink = LOG_SINK_WORLD;
+        record.timestamp = true;
+        record.time = time(nullptr);
+
+        char buf[256];
+        snprintf(buf, sizeof(buf), "\n%s:\nSOCKET: %s\nLENGTH: %u\nOPCODE: %s (0x%.4X)\nDATA:\n",
+                 incoming ? "CLIENT" : "SERVER", socket, static_cast<uint32>(packet.size()), opcodeName, opcode);
+        record.text = buf;
+
+        size_t p = 0;
+        while (p < packet.size())
+        {
+            for (size_t j = 0; j < 16 && p < packet.size(); ++j)
+            {
+                snprintf(buf, sizeof(buf), "%.2X ", packet[p++]);
+                record.text += buf;
+            }
+            record.text += "\n";
+        }
+        record.text += "\n\n";
+
+        QueueRecord(std::move(record));
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
 
     outTimestamp(worldLogfile);
@@ -918,6 +1155,19 @@ void Log::outWorldPacketDump(const char* socket, uint32 opcode, char const* opco
 
 void Log::outCharDump(const char* str, uint32 account_id, uint32 guid, const char* name)
 {
+    if (IsAsync())
+    {
+        if (charLogfile)
+        {
+            LogRecord record;
+            record.sink = LOG_SINK_CHAR;
+            record.text = "== START DUMP == (account: " + std::to_string(account_id) + " guid: " + std::to_string(guid) +
+                          " name: " + name + " )\n" + str + "\n== END DUMP ==\n";
+            QueueRecord(std::move(record));
+        }
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
 
     if (charLogfile)
@@ -932,6 +1182,18 @@ void Log::outRALog(const char* str, ...)
     if (!str)
         return;
 
+    if (IsAsync())
+    {
+        if (raLogfile)
+        {
+            va_list ap;
+            va_start(ap, str);
+            QueueFile(LOG_SINK_RA, time(nullptr), FormatLogText(str, ap));
+            va_end(ap);
+        }
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
     if (raLogfile)
     {
@@ -952,6 +1214,18 @@ void Log::outCustomLog(const char* str, ...)
     if (!str)
         return;
 
+    if (IsAsync())
+    {
+        if (customLogFile)
+        {
+            va_list ap;
+            va_start(ap, str);
+            QueueFile(LOG_SINK_CUSTOM, time(nullptr), FormatLogText(str, ap));
+            va_end(ap);
+        }
+        return;
+    }
+
     std::lock_guard<std::mutex> guard(m_worldLogMtx);
     if (customLogFile)
     {
@@ -969,6 +1243,8 @@ void Log::outCustomLog(const char* str, ...)
 
 void Log::WaitBeforeContinueIfNeed()
 {
+    sLog.Flush();
+
     int mode = sConfig.GetIntDefault("WaitAtStartupError", 0);
 
     if (mode < 0)
@@ -992,6 +1268,9 @@ void Log::WaitBeforeContinueIfNeed()
 
 void Log::setScriptLibraryErrorFile(char const* fname, char const* libName)
 {
+    // queued records resolve the file when written
+    std::lock_guard<std::mutex> guard(m_worldLogMtx);
+
     m_scriptLibName = libName;
 
     if (scriptErrLogFile)
@@ -1008,6 +1287,265 @@ void Log::setScriptLibraryErrorFile(char const* fname, char const* libName)
     scriptErrLogFile = fopen(fileName.c_str(), "a");
 }
 
+void Log::QueueConsole(bool stdout_stream, int colorIndex, time_t t, std::string const& text)
+{
+    LogRecord record;
+    record.sink = stdout_stream ? LOG_SINK_STDOUT : LOG_SINK_STDERR;
+    record.color = m_colored && colorIndex >= 0 ? int8(m_colors[colorIndex]) : -1;
+    record.timestamp = m_includeTime;
+    record.time = t;
+    record.text.reserve(text.size() + 1);
+    record.text.append(text).push_back('\n');
+    QueueRecord(std::move(record));
+}
+
+void Log::QueueFormatted(LogLevel level, int colorIndex, std::string const& filePrefix, int sink, uint32 account, const char* format, va_list ap)
+{
+    std::string text = FormatLogText(format, ap);
+    time_t t = time(nullptr);
+
+    if (m_logLevel >= level)
+        QueueConsole(colorIndex != LogError, colorIndex, t, text);
+    if (logfile && m_logFileLevel >= level)
+        QueueFile(LOG_SINK_MAIN, t, filePrefix.empty() ? text : filePrefix + text);
+    if (sink >= 0)
+        QueueFile(uint8(sink), t, text, account);
+}
+
+void Log::QueueFile(uint8 sink, time_t t, std::string const& text, uint32 account)
+{
+    LogRecord record;
+    record.sink = sink;
+    record.timestamp = true;
+    record.account = account;
+    record.time = t;
+    record.text.reserve(text.size() + 1);
+    record.text.append(text).push_back('\n');
+    QueueRecord(std::move(record));
+}
+
+void Log::QueueRecord(LogRecord&& record)
+{
+    LogRing* ring = GetThreadRing();
+    record.sequence = m_asyncSequence++;
+    if (!ring->queue.Push(std::move(record)))
+    {
+        // ring full: wake the writer and give it a moment, but never wait on it for long
+        ++m_asyncStalls;
+        bool queued = false;
+        for (int i = 0; i < LOG_ASYNC_MAX_WAIT_MS && !queued; ++i)
+        {
+            if (IsAsync())
+            {
+                m_asyncWake.notify_one();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            else
+                Flush();                                    // no writer left to make room
+
+            queued = ring->queue.Push(std::move(record));
+        }
+
+        if (!queued)
+        {
+            ++m_asyncDropped;
+            return;
+        }
+    }
+
+    // the writer may have stopped after the caller checked IsAsync(), its last drain then missed this record
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!IsAsync())
+        Flush();
+}
+
+LogRing* Log::GetThreadRing()
+{
+    if (!t_logRing)
+    {
+        t_logRing = std::make_shared<LogRing>(m_asyncQueueSize);
+
+        std::lock_guard<std::mutex> guard(m_ringsLock);
+        m_rings.push_back(t_logRing);
+    }
+
+    return t_logRing.get();
+}
+
+void Log::StartAsyncWriter()
+{
+    if (!m_asyncConfigured || m_asyncThread.joinable())
+        return;
+
+    m_asyncStop = false;
+    m_asyncEnabled = true;
+    m_asyncThread = std::thread(&Log::AsyncWriterLoop, this);
+
+    outString("Asynchronous logging enabled (flush interval %u ms, %u records per thread)", m_asyncFlushInterval, m_asyncQueueSize);
+}
+
+void Log::StopAsyncWriter()
+{
+    if (!m_asyncThread.joinable())
+        return;
+
+    m_asyncEnabled = false;
+    {
+        std::lock_guard<std::mutex> guard(m_asyncWakeMtx);
+        m_asyncStop = true;
+    }
+    m_asyncWake.notify_one();
+    m_asyncThread.join();
+
+    // anything queued while the writer was stopping, producers queueing later flush themselves (see QueueRecord)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    Flush();
+
+    LogAsyncStats stats = GetAsyncStats();
+    outString("Asynchronous logging stopped: " UI64FMTD " records written, " UI64FMTD " waits for a full queue, " UI64FMTD " records dropped",
+              stats.written, stats.stalls, stats.dropped);
+}
+
+void Log::Flush()
+{
+    std::lock_guard<std::mutex> guard(m_worldLogMtx);
+    WriteQueuedRecords();
+}
+
+LogAsyncStats Log::GetAsyncStats() const
+{
+    LogAsyncStats stats;
+    stats.written = m_asyncWritten;
+    stats.stalls = m_asyncStalls;
+    stats.dropped = m_asyncDropped;
+    return stats;
+}
+
+void Log::AsyncWriterLoop()
+{
+    std::unique_lock<std::mutex> lock(m_asyncWakeMtx);
+    while (!m_asyncStop)
+    {
+        m_asyncWake.wait_for(lock, std::chrono::milliseconds(m_asyncFlushInterval));
+        lock.unlock();
+
+        Flush();
+
+        lock.lock();
+    }
+}
+
+void Log::WriteQueuedRecords()
+{
+    std::vector<std::shared_ptr<LogRing> > rings;
+    {
+        std::lock_guard<std::mutex> guard(m_ringsLock);
+
+        // forget rings of finished threads once they are drained
+        m_rings.erase(std::remove_if(m_rings.begin(), m_rings.end(), [](std::shared_ptr<LogRing> const& ring)
+        {
+            return ring.use_count() == 1 && ring->queue.Empty();
+        }), m_rings.end());
+
+        rings = m_rings;
+    }
+
+    // each ring is in queue order, the records of all of them are merged by sequence. A record queued
+    // while the rings are drained may still be written after later ones of other threads, in the next flush
+    std::vector<LogRecord> records;
+    LogRecord record;
+    for (std::shared_ptr<LogRing> const& ring : rings)
+        while (ring->queue.Pop(record))
+            records.push_back(std::move(record));
+
+    std::sort(records.begin(), records.end(), [](LogRecord const& left, LogRecord const& right)
+    {
+        return left.sequence < right.sequence;
+    });
+
+    uint32 flushMask = 0;
+    for (LogRecord const& queued : records)
+    {
+        WriteRecord(queued, flushMask);
+        ++m_asyncWritten;
+    }
+
+    uint64 dropped = m_asyncDropped;
+    if (dropped != m_asyncReportedDrops)
+    {
+        LogRecord report;
+        report.sink = LOG_SINK_STDERR;
+        report.text = "Log: " + std::to_string(dropped - m_asyncReportedDrops) + " records dropped, the log queue of their thread was full\n";
+        WriteRecord(report, flushMask);
+        report.sink = LOG_SINK_MAIN;
+        report.timestamp = true;
+        report.time = time(nullptr);
+        WriteRecord(report, flushMask);
+        m_asyncReportedDrops = dropped;
+    }
+
+    FILE* const files[] = { stdout, stderr, logfile, gmLogfile, nullptr, charLogfile, dberLogfile, eventAiErLogfile, scriptErrLogFile, raLogfile, worldLogfile, customLogFile };
+    for (uint32 i = 0; i < sizeof(files) / sizeof(files[0]); ++i)
+        if ((flushMask & (1 << i)) && files[i])
+            fflush(files[i]);
+}
+
+void Log::WriteRecord(LogRecord const& record, uint32& flushMask)
+{
+    FILE* file = nullptr;
+    switch (record.sink)
+    {
+        case LOG_SINK_STDOUT:           file = stdout;              break;
+        case LOG_SINK_STDERR:           file = stderr;              break;
+        case LOG_SINK_MAIN:             file = logfile;             break;
+        case LOG_SINK_GM:               file = gmLogfile;           break;
+        case LOG_SINK_GM_ACCOUNT:       file = openGmlogPerAccount(record.account); break;
+        case LOG_SINK_CHAR:             file = charLogfile;         break;
+        case LOG_SINK_DB_ERROR:         file = dberLogfile;         break;
+        case LOG_SINK_EVENT_AI_ERROR:   file = eventAiErLogfile;    break;
+        case LOG_SINK_SCRIPT_ERROR:     file = scriptErrLogFile;    break;
+        case LOG_SINK_RA:               file = raLogfile;           break;
+        case LOG_SINK_WORLD:            file = worldLogfile;        break;
+        case LOG_SINK_CUSTOM:           file = customLogFile;       break;
+    }
+
+    if (!file)
+        return;
+
+    bool console = record.sink == LOG_SINK_STDOUT || record.sink == LOG_SINK_STDERR;
+    if (console)
+    {
+        if (record.color >= 0)
+            SetColor(record.sink == LOG_SINK_STDOUT, Color(record.color));
+
+        if (record.timestamp)
+        {
+            tm* aTm = localtime(&record.time);
+            fprintf(file, "%02d:%02d:%02d ", aTm->tm_hour, aTm->tm_min, aTm->tm_sec);
+        }
+
+        utf8printf(file, "%s", record.text.c_str());
+
+        if (record.color >= 0)
+            ResetColor(record.sink == LOG_SINK_STDOUT);
+    }
+    else
+    {
+        if (record.timestamp)
+        {
+            tm* aTm = localtime(&record.time);
+            fprintf(file, "%-4d-%02d-%02d %02d:%02d:%02d ", aTm->tm_year + 1900, aTm->tm_mon + 1, aTm->tm_mday, aTm->tm_hour, aTm->tm_min, aTm->tm_sec);
+        }
+
+        fwrite(record.text.data(), 1, record.text.size(), file);
+    }
+
+    if (record.sink == LOG_SINK_GM_ACCOUNT)
+        fclose(file);
+    else
+        flushMask |= 1 << record.sink;
+}
+
 void outstring_log()
 {
     sLog.outString();
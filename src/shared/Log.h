@@ -22,10 +22,18 @@
 #include "Common.h"
 #include "Policies/Singleton.h"
 
+#include <atomic>
+#include <cstdarg>
+#include <condition_variable>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 class Config;
 class ByteBuffer;
+struct LogRing;
+struct LogRecord;
 
 enum LogLevel
 {
@@ -92,6 +100,13 @@ enum Color
 
 const int Color_count = int(WHITE) + 1;
 
+struct LogAsyncStats
+{
+    uint64 written;                                         // records written by the writer thread
+    uint64 stalls;                                          // pushes that found the thread ring full and had to wait
+    uint64 dropped;                                         // records lost because the ring stayed full
+};
+
 class Log : public MaNGOS::Singleton<Log, MaNGOS::ClassLevelLockable<Log, std::mutex> >
 {
         friend class MaNGOS::OperatorNew<Log>;
@@ -99,6 +114,8 @@ class Log : public MaNGOS::Singleton<Log, MaNGOS::ClassLevelLockable<Log, std::m
 
         ~Log()
         {
+            StopAsyncWriter();
+
             if (logfile != nullptr)
                 fclose(logfile);
             logfile = nullptr;
@@ -187,6 +204,14 @@ class Log : public MaNGOS::Singleton<Log, MaNGOS::ClassLevelLockable<Log, std::m
 
         static void WaitBeforeContinueIfNeed();
 
+        // Asynchronous mode (LogAsync): callers only format their message and queue it into a ring owned by
+        // their thread, a writer thread puts the queued records to console and files every LogAsyncFlushInterval ms
+        void StartAsyncWriter();
+        void StopAsyncWriter();
+        void Flush();                                       // write all queued records now
+        bool IsAsync() const { return m_asyncEnabled.load(std::memory_order_relaxed); }
+        LogAsyncStats GetAsyncStats() const;
+
         // Set filename for scriptlibrary error output
         void setScriptLibraryErrorFile(char const* fname, char const* libName);
 
@@ -194,6 +219,18 @@ class Log : public MaNGOS::Singleton<Log, MaNGOS::ClassLevelLockable<Log, std::m
         FILE* openLogFile(char const* configFileName, char const* configTimeStampFlag, char const* mode);
         FILE* openGmlogPerAccount(uint32 account);
 
+        // async mode helpers, the text is queued without trailing new line
+        void QueueConsole(bool stdout_stream, int colorIndex, time_t t, std::string const& text);
+        // format the message once, queue it to the console and main log file as far as level allows (errors to stderr,
+        // filePrefix only in the main log file) and to sink (if not negative) without prefix
+        void QueueFormatted(LogLevel level, int colorIndex, std::string const& filePrefix, int sink, uint32 account, const char* format, va_list ap);
+        void QueueFile(uint8 sink, time_t t, std::string const& text, uint32 account = 0);
+        void QueueRecord(LogRecord&& record);
+        LogRing* GetThreadRing();
+        void AsyncWriterLoop();
+        void WriteQueuedRecords();                          // m_worldLogMtx must be held
+        void WriteRecord(LogRecord const& record, uint32& flushMask);
+
         FILE* raLogfile;
         FILE* logfile;
         FILE* gmLogfile;
@@ -225,6 +262,25 @@ class Log : public MaNGOS::Singleton<Log, MaNGOS::ClassLevelLockable<Log, std::m
         std::string m_gmlog_filename_format;
 
         char const* m_scriptLibName;
+
+        // async mode
+        bool m_asyncConfigured;
+        uint32 m_asyncFlushInterval;
+        uint32 m_asyncQueueSize;
+        std::atomic<bool> m_asyncEnabled;
+        bool m_asyncStop;
+        std::thread m_asyncThread;
+        std::mutex m_asyncWakeMtx;
+        std::condition_variable m_asyncWake;
+
+        std::mutex m_ringsLock;
+        std::vector<std::shared_ptr<LogRing> > m_rings;
+
+        std::atomic<uint64> m_asyncSequence;
+        std::atomic<uint64> m_asyncWritten;
+        std::atomic<uint64> m_asyncStalls;
+        std::atomic<uint64> m_asyncDropped;
+        uint64 m_asyncReportedDrops;
 };
 
 #define sLog MaNGOS::Singleton<Log>::Instance()
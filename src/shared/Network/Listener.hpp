@@ -23,6 +23,7 @@
 
 #include <boost/asio.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <thread>
 #include <vector>
@@ -65,14 +66,21 @@ namespace MaNGOS
             void OnAccept(NetworkThread<SocketType> *worker, std::shared_ptr<SocketType> const& socket, const boost::system::error_code &ec);
 
         public:
+            // workerThreads <= 0 starts one network thread per hardware thread
             Listener(std::string const& address, int port, int workerThreads);
             ~Listener();
+
+            size_t GetWorkerCount() const { return m_workerThreads.size(); }
+            NetworkThreadStats GetWorkerStats(size_t index) const { return m_workerThreads[index]->GetStats(); }
     };
 
     template <typename SocketType>
     Listener<SocketType>::Listener(std::string const& address, int port, int workerThreads)
         : m_service(new boost::asio::io_service()), m_acceptor(new boost::asio::ip::tcp::acceptor(*m_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::address::from_string(address), port)))
     {
+        if (workerThreads <= 0)
+            workerThreads = int(std::max(1u, std::thread::hardware_concurrency()));
+
         m_workerThreads.reserve(workerThreads);
         for (auto i = 0; i < workerThreads; ++i)
             m_workerThreads.push_back(std::unique_ptr<NetworkThread<SocketType>>(new NetworkThread<SocketType>));
@@ -113,7 +121,10 @@ namespace MaNGOS
         if (ec)
             worker->RemoveSocket(socket.get());
         else
+        {
+            worker->OnSocketAccepted();
             socket->Open();
+        }
 
         BeginAccept();
     }
@@ -23,20 +23,33 @@
 
 #include <boost/asio.hpp>
 
+#include <atomic>
 #include <thread>
 #include <mutex>
 #include <unordered_set>
 
 namespace MaNGOS
 {
+    struct NetworkThreadStats
+    {
+        size_t sockets;                                     // sockets currently owned by the thread, including the pending accept
+        size_t peakSockets;
+        uint64 accepted;                                    // connections accepted since startup
+        uint64 closed;                                      // accepted connections closed since startup
+    };
+
     template <typename SocketType>
     class NetworkThread
     {
         private:
             boost::asio::io_service m_service;
 
-            std::mutex m_socketLock;
+            mutable std::mutex m_socketLock;
             std::unordered_set<std::shared_ptr<SocketType>> m_sockets;
+            size_t m_peakSockets;
+
+            std::atomic<uint64> m_accepted;
+            std::atomic<uint64> m_closed;
 
             // note that the work member *must* be declared after the service member for the work constructor to function correctly
             std::unique_ptr<boost::asio::io_service::work> m_work;
@@ -44,7 +57,7 @@ namespace MaNGOS
             std::thread m_serviceThread;
 
         public:
-            NetworkThread() : m_work(new boost::asio::io_service::work(m_service)), m_serviceThread([this] { boost::system::error_code ec; this->m_service.run(ec); })
+            NetworkThread() : m_peakSockets(0), m_accepted(0), m_closed(0), m_work(new boost::asio::io_service::work(m_service)), m_serviceThread([this] { boost::system::error_code ec; this->m_service.run(ec); })
             {
                 m_serviceThread.detach();
             }
@@ -65,15 +78,40 @@ namespace MaNGOS
                 }
             }
 
-            size_t Size() const { return m_sockets.size(); }
+            size_t Size() const
+            {
+                std::lock_guard<std::mutex> guard(m_socketLock);
+                return m_sockets.size();
+            }
+
+            NetworkThreadStats GetStats() const
+            {
+                std::lock_guard<std::mutex> guard(m_socketLock);
+
+                NetworkThreadStats stats;
+                stats.sockets = m_sockets.size();
+                stats.peakSockets = m_peakSockets;
+                stats.accepted = m_accepted;
+                stats.closed = m_closed;
+                return stats;
+            }
 
             std::shared_ptr<SocketType> CreateSocket();
 
+            // called by the listener once the socket returned by CreateSocket is connected
+            void OnSocketAccepted() { ++m_accepted; }
+
             void RemoveSocket(Socket *socket)
             {
                 std::lock_guard<std::mutex> guard(m_socketLock);
                 m_sockets.erase(socket->shared<SocketType>());
             }
+
+            void OnSocketClosed(Socket *socket)
+            {
+                ++m_closed;
+                RemoveSocket(socket);
+            }
     };
 
     template <typename SocketType>
@@ -81,10 +119,13 @@ namespace MaNGOS
     {
         std::lock_guard<std::mutex> guard(m_socketLock);
 
-        auto const i = m_sockets.emplace(std::make_shared<SocketType>(m_service, [this] (Socket *socket) { this->RemoveSocket(socket); }));
+        auto const i = m_sockets.emplace(std::make_shared<SocketType>(m_service, [this] (Socket *socket) { this->OnSocketClosed(socket); }));
 
         MANGOS_ASSERT(i.second);
 
+        if (m_sockets.size() > m_peakSockets)
+            m_peakSockets = m_sockets.size();
+
         return *i.first;
     }
 }
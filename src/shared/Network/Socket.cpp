@@ -49,8 +49,6 @@ namespace MaNGOS
             return false;
         }
 
-        m_outBuffer.reset(new PacketBuffer);
-        m_secondaryOutBuffer.reset(new PacketBuffer);
         m_inBuffer.reset(new PacketBuffer);
 
         StartAsyncRead();
@@ -165,39 +163,65 @@ namespace MaNGOS
         return true;
     }
 
-    void Socket::Write(const char* header, int headerSize, const char* content, int contentSize)
+    Socket::OutBuffer Socket::AcquireOutBuffer()
     {
         std::lock_guard<std::mutex> guard(m_mutex);
 
-        // get the correct buffer depending on the current writing state
-        PacketBuffer* outBuffer = m_writeState == WriteState::Sending ? m_secondaryOutBuffer.get() : m_outBuffer.get();
+        if (m_freeOutBuffers.empty())
+            return std::make_shared<std::vector<uint8>>();
 
-        // write the header
-        outBuffer->Write(header, headerSize);
+        OutBuffer buffer = std::move(m_freeOutBuffers.back());
+        m_freeOutBuffers.pop_back();
+        buffer->clear();
+        return buffer;
+    }
 
-        // write the content
-        outBuffer->Write(content, contentSize);
+    void Socket::Write(const char* header, int headerSize, const char* content, int contentSize)
+    {
+        OutBuffer buffer = AcquireOutBuffer();
+        buffer->assign(content, content + contentSize);
 
-        // flush data if need
-        if (m_writeState == WriteState::Idle)
-            StartWriteFlushTimer();
+        Write(header, headerSize, buffer);
     }
 
     void Socket::Write(const char* buffer, int length)
     {
-        std::lock_guard<std::mutex> guard(m_mutex);
+        OutBuffer content = AcquireOutBuffer();
+        content->assign(buffer, buffer + length);
 
-        // get the correct buffer depending on the current writing state
-        PacketBuffer* outBuffer = m_writeState == WriteState::Sending ? m_secondaryOutBuffer.get() : m_outBuffer.get();
+        Write(nullptr, 0, content);
+    }
 
-        // write the header
-        outBuffer->Write(buffer, length);
+    void Socket::Write(const char* header, int headerSize, OutBuffer const& content)
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+
+        QueueOut(header, headerSize, content);
 
         // flush data if need
         if (m_writeState == WriteState::Idle)
             StartWriteFlushTimer();
     }
 
+// note that this function assumes that the socket mutex is locked
+    void Socket::QueueOut(const char* header, size_t headerSize, OutBuffer const& content)
+    {
+        MANGOS_ASSERT(headerSize <= MaxHeaderSize);
+
+        m_outQueue.emplace_back();
+        OutSegment& segment = m_outQueue.back();
+
+        segment.headerSize = headerSize;
+        segment.content = content;
+        segment.sent = 0;
+
+        if (headerSize)
+        {
+            memcpy(segment.header.data(), header, headerSize);
+            EncryptHeader(segment.header.data(), headerSize);
+        }
+    }
+
 // note that this function assumes that the socket mutex is locked
     void Socket::StartWriteFlushTimer()
     {
@@ -231,11 +255,38 @@ namespace MaNGOS
 
         assert(m_writeState == WriteState::Buffering);
 
-        // at this point we are guarunteed that there is data to send in the primary buffer.  send it.
+        // at this point we are guarunteed that there is data to send in the queue.  send it.
         m_writeState = WriteState::Sending;
 
+        SendOutQueue();
+    }
+
+// note that this function assumes that the socket mutex is locked
+    void Socket::SendOutQueue()
+    {
+        // gather headers and contents of the queued segments into one write, the segments
+        // are not touched by Write() while sending since it only appends to the queue
+        m_gatherBuffers.clear();
+
+        size_t count = 0;
+        for (auto itr = m_outQueue.begin(); itr != m_outQueue.end() && count < MaxGatherSegments; ++itr, ++count)
+        {
+            size_t offset = itr->sent;
+
+            if (offset < itr->headerSize)
+            {
+                m_gatherBuffers.push_back(boost::asio::buffer(itr->header.data() + offset, itr->headerSize - offset));
+                offset = 0;
+            }
+            else
+                offset -= itr->headerSize;
+
+            if (itr->content && offset < itr->content->size())
+                m_gatherBuffers.push_back(boost::asio::buffer(itr->content->data() + offset, itr->content->size() - offset));
+        }
+
         std::shared_ptr<Socket> ptr = shared<Socket>();
-        m_socket.async_write_some(boost::asio::buffer(m_outBuffer->m_buffer, m_outBuffer->m_writePosition),
+        m_socket.async_write_some(m_gatherBuffers,
                                   make_custom_alloc_handler(m_allocator,
         [ptr](const boost::system::error_code & error, size_t length) { ptr->OnWriteComplete(error, length); }));
     }
@@ -267,37 +318,36 @@ namespace MaNGOS
         std::lock_guard<std::mutex> guard(m_mutex);
 
         assert(m_writeState == WriteState::Sending);
-        assert(length <= m_outBuffer->m_writePosition);
 
-        // if there is data left to write, move it to the start of the buffer
-        if (length < m_outBuffer->m_writePosition)
+        // drop the fully written segments, the last one may be partially written
+        while (length > 0 && !m_outQueue.empty())
         {
-            memcpy(&(m_outBuffer->m_buffer[0]), &(m_outBuffer->m_buffer[length]), (m_outBuffer->m_writePosition - length) * sizeof(m_outBuffer->m_buffer[0]));
-            m_outBuffer->m_writePosition -= length;
-        }
-        // if not, reset the write pointer
-        else
-            m_outBuffer->m_writePosition = 0;
+            OutSegment& segment = m_outQueue.front();
+            const size_t remaining = segment.Size() - segment.sent;
 
-        // if there is data in the secondary buffer, append it to the primary buffer
-        if (m_secondaryOutBuffer->m_writePosition > 0)
-        {
-            // do we have enough space? if not, resize
-            if (m_outBuffer->m_buffer.size() < (m_outBuffer->m_writePosition + m_secondaryOutBuffer->m_writePosition))
-                m_outBuffer->m_buffer.resize(m_outBuffer->m_writePosition + m_secondaryOutBuffer->m_writePosition);
+            if (length < remaining)
+            {
+                segment.sent += length;
+                break;
+            }
+
+            length -= remaining;
 
-            memcpy(&(m_outBuffer->m_buffer[m_outBuffer->m_writePosition]), &(m_secondaryOutBuffer->m_buffer[0]), (m_secondaryOutBuffer->m_writePosition) * sizeof(m_secondaryOutBuffer->m_buffer[0]));
+            // keep the buffer for later packets if nobody else holds it
+            if (segment.content && segment.content.use_count() == 1 && m_freeOutBuffers.size() < MaxFreeOutBuffers &&
+                    segment.content->capacity() <= MaxFreeOutBufferCapacity)
+                m_freeOutBuffers.push_back(std::move(segment.content));
 
-            m_outBuffer->m_writePosition += m_secondaryOutBuffer->m_writePosition;
-            m_secondaryOutBuffer->m_writePosition = 0;
+            m_outQueue.pop_front();
         }
 
-        std::shared_ptr<Socket> ptr = shared<Socket>();
+        // drop segments with nothing to send (empty writes)
+        while (!m_outQueue.empty() && m_outQueue.front().Size() == 0)
+            m_outQueue.pop_front();
+
         // if there is any data to write, do so immediately
-        if (m_outBuffer->m_writePosition > 0)
-            m_socket.async_write_some(boost::asio::buffer(m_outBuffer->m_buffer, m_outBuffer->m_writePosition),
-                                      make_custom_alloc_handler(m_allocator,
-            [ptr](const boost::system::error_code & error, size_t length) { ptr->OnWriteComplete(error, length);}));
+        if (!m_outQueue.empty())
+            SendOutQueue();
         else
             m_writeState = WriteState::Idle;
     }
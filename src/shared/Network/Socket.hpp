@@ -25,15 +25,24 @@
 
 #include <boost/asio.hpp>
 
+#include <array>
+#include <deque>
 #include <memory>
 #include <string>
 #include <mutex>
 #include <functional>
+#include <vector>
 
 namespace MaNGOS
 {
     class Socket : public std::enable_shared_from_this<Socket>
     {
+        public:
+            // ref-counted output buffer, may be queued on several sockets at once
+            typedef std::shared_ptr<std::vector<uint8>> OutBuffer;
+
+            static const size_t MaxHeaderSize = 8;
+
         private:
             // buffer timeout period, in milliseconds.  higher values decrease responsiveness
             // ingame but increase bandwidth efficiency by reducing tcp overhead.
@@ -59,9 +68,29 @@ namespace MaNGOS
 
             std::function<void(Socket *)> m_closeHandler;
 
+            // a queued packet: its header is stored inline so it can be encrypted in place
+            struct OutSegment
+            {
+                std::array<uint8, MaxHeaderSize> header;
+                size_t headerSize;
+                OutBuffer content;
+                size_t sent;                                // bytes of header + content already written
+
+                size_t Size() const { return headerSize + (content ? content->size() : 0); }
+            };
+
+            // max segments handed to a single gather write
+            static const size_t MaxGatherSegments = 64;
+            // max idle buffers kept for reuse, and the biggest one worth keeping
+            static const size_t MaxFreeOutBuffers = 32;
+            static const size_t MaxFreeOutBufferCapacity = 65536;
+
             std::unique_ptr<PacketBuffer> m_inBuffer;
-            std::unique_ptr<PacketBuffer> m_outBuffer;
-            std::unique_ptr<PacketBuffer> m_secondaryOutBuffer;
+
+            // queued output, segments being sent are at the front and stay in place until written
+            std::deque<OutSegment> m_outQueue;
+            std::vector<boost::asio::const_buffer> m_gatherBuffers;
+            std::vector<OutBuffer> m_freeOutBuffers;
 
             std::mutex m_mutex;
             std::mutex m_closeMutex;
@@ -73,6 +102,8 @@ namespace MaNGOS
             void StartWriteFlushTimer();
             void OnWriteComplete(const boost::system::error_code &error, size_t length);
             void FlushOut();
+            void SendOutQueue();
+            void QueueOut(const char *header, size_t headerSize, OutBuffer const& content);
 
             void OnError(const boost::system::error_code &error);
 
@@ -88,6 +119,9 @@ namespace MaNGOS
 
             void ForceFlushOut();
 
+            // called with the socket mutex held when a header is queued, so the header cipher runs in send order
+            virtual void EncryptHeader(uint8* /*header*/, size_t /*size*/) {}
+
         public:
             Socket(boost::asio::io_service &service, std::function<void (Socket *)> closeHandler);
             virtual ~Socket() = default;
@@ -103,6 +137,11 @@ namespace MaNGOS
 
             void Write(const char *buffer, int length);
             void Write(const char *header, int headerSize, const char* content, int contentSize);
+            // queues content without copying it, the buffer must not be modified afterwards
+            void Write(const char *header, int headerSize, OutBuffer const& content);
+
+            // returns an empty buffer, reused from already sent packets when possible
+            OutBuffer AcquireOutBuffer();
 
             boost::asio::ip::tcp::socket &GetAsioSocket() { return m_socket; }
 
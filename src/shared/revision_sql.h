@@ -2,5 +2,5 @@
 #define __REVISION_SQL_H__
  #define REVISION_DB_REALMD "required_z2716_01_realmd_totp"
  #define REVISION_DB_CHARACTERS "required_z2737_00_characters_cooldown"
- #define REVISION_DB_MANGOS "required_z2738_01_mangos_quest_template"
+ #define REVISION_DB_MANGOS "required_z2739_01_mangos_mangos_string"
 #endif // __REVISION_SQL_H__